@@ -0,0 +1,168 @@
+/**
+ *	Copyright (c) 2025 Wenchao Huang <physhuangwenchao@gmail.com>
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+#include <algorithm>
+
+/*********************************************************************************
+******************************    BenchmarkReport    *****************************
+*********************************************************************************/
+
+/**
+ *	@brief		Collects timing samples and serializes them as JSON.
+ *	@details	Each result holds the distribution of the per-iteration time in nanoseconds, so regressions
+ *				can be tracked on the median while outliers stay visible in `max` and `p99`. A progress line
+ *				is printed to `stderr` for every result, keeping `stdout` free for the JSON document.
+ */
+class BenchmarkReport
+{
+
+public:
+
+	//!	@brief	Key/value pair describing the configuration of a result.
+	struct Param
+	{
+		std::string		key;
+		std::string		json;		// Value, already encoded as JSON
+
+		Param(const char * key, int value) : key(key), json(std::to_string(value)) {}
+
+		Param(const char * key, const char * value) : key(key), json(std::string("\"") + value + "\"") {}
+	};
+
+	struct Result
+	{
+		std::string				name;
+		std::vector<Param>		params;
+		size_t					iterations;
+		double					itemsPerIteration;
+		double					mean, median, p99, min, max;		// Nanoseconds per iteration
+	};
+
+public:
+
+	/**
+	 *	@brief		Runs `func` once for warm-up, then `iterations` times, and records the time of each call.
+	 *	@param[in]	itemsPerIteration - Work items processed per call (pixels, messages), used for `items_per_second`.
+	 */
+	template<typename Func> void run(const char * name, std::vector<Param> params, int iterations, double itemsPerIteration, Func && func)
+	{
+		std::vector<double> samples(iterations);
+
+		func();
+
+		for (int i = 0; i < iterations; i++)
+		{
+			auto t0 = std::chrono::steady_clock::now();
+
+			func();
+
+			auto t1 = std::chrono::steady_clock::now();
+
+			samples[i] = std::chrono::duration<double, std::nano>(t1 - t0).count();
+		}
+
+		this->add(name, std::move(params), std::move(samples), itemsPerIteration);
+	}
+
+	//!	@brief	Records samples (in nanoseconds) measured by the caller.
+	void add(const char * name, std::vector<Param> params, std::vector<double> samples, double itemsPerIteration = 1.0)
+	{
+		if (samples.empty())	return;
+
+		std::sort(samples.begin(), samples.end());
+
+		double sum = 0.0;
+
+		for (double sample : samples)		sum += sample;
+
+		Result result;
+		result.name = name;
+		result.params = std::move(params);
+		result.iterations = samples.size();
+		result.itemsPerIteration = itemsPerIteration;
+		result.mean = sum / samples.size();
+		result.median = samples[samples.size() / 2];
+		result.p99 = samples[(samples.size() * 99) / 100];
+		result.min = samples.front();
+		result.max = samples.back();
+
+		std::string config;
+
+		for (const Param & param : result.params)
+		{
+			config += " " + param.key + "=" + param.json;
+		}
+
+		fprintf(stderr, "%-24s%-40s median %12.1f ns\n", name, config.c_str(), result.median);
+
+		m_results.push_back(std::move(result));
+	}
+
+	//!	@brief	Returns the JSON document holding every result.
+	std::string toJson() const
+	{
+		std::string json = "{\n  \"library\": \"easywin32\",\n";
+
+	#ifdef NDEBUG
+		json += "  \"build\": \"release\",\n";
+	#else
+		json += "  \"build\": \"debug\",\n";
+	#endif
+
+		json += "  \"results\": [\n";
+
+		for (size_t i = 0; i < m_results.size(); i++)
+		{
+			const Result & result = m_results[i];
+
+			char numbers[512] = {};
+
+			snprintf(numbers, sizeof(numbers),
+					 "\"iterations\": %zu, \"mean_ns\": %.1f, \"median_ns\": %.1f, \"p99_ns\": %.1f, \"min_ns\": %.1f, \"max_ns\": %.1f, \"items_per_second\": %.1f",
+					 result.iterations, result.mean, result.median, result.p99, result.min, result.max,
+					 result.median > 0.0 ? result.itemsPerIteration * 1e9 / result.median : 0.0);
+
+			json += "    { \"name\": \"" + result.name + "\", \"params\": {";
+
+			for (size_t k = 0; k < result.params.size(); k++)
+			{
+				json += (k == 0 ? " \"" : ", \"") + result.params[k].key + "\": " + result.params[k].json;
+			}
+
+			json += std::string(result.params.empty() ? "}, " : " }, ") + numbers + (i + 1 < m_results.size() ? " },\n" : " }\n");
+		}
+
+		json += "  ]\n}\n";
+
+		return json;
+	}
+
+private:
+
+	std::vector<Result>		m_results;
+};
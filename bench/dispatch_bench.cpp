@@ -0,0 +1,94 @@
+/**
+ *	Copyright (c) 2025 Wenchao Huang <physhuangwenchao@gmail.com>
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include <easywin32.h>
+#include "benchmark.h"
+
+/*********************************************************************************
+******************************    dispatchBench    *******************************
+*********************************************************************************/
+
+/**
+ *	@brief		Measures the cost of dispatching one message to each kind of callback.
+ *	@details	Messages are sent with `SendMessage` in batches, which enters the window procedure directly.
+ *				The `posted` case goes through `PostMessage` and `processEvents` to include the message queue.
+ *				Every case is run once without a callback as a baseline for the cost of the callback itself.
+ */
+void dispatchBench(BenchmarkReport & report)
+{
+	const int batchSize = 1000;
+	const int iterations = 200;
+
+	EzWindow window;
+	window.open("EasyWin32-Bench", 320, 240);
+
+	HWND hWnd = window.nativeHandle();
+
+	int counter = 0;
+
+	auto sendBatch = [&](const char * callback, bool installed, UINT message, WPARAM wParam, LPARAM lParam)
+	{
+		report.run("dispatch", { { "callback", callback }, { "installed", installed ? 1 : 0 } }, iterations, batchSize, [&]()
+		{
+			for (int i = 0; i < batchSize; i++)
+			{
+				::SendMessage(hWnd, message, wParam, lParam);
+			}
+		});
+	};
+
+	for (int installed = 0; installed < 2; installed++)
+	{
+		if (installed != 0)
+		{
+			window.onKeyboardPress = [&](EzKey, EzKeyAction) { counter++;	return 0; };
+			window.onInputCharacter = [&](wchar_t) { counter++;		return 0; };
+			window.onMouseMove = [&](int, int, EzMouseStateFlags) { counter++;	return 0; };
+			window.onMouseClick = [&](EzMouseButton, EzMouseAction, EzMouseStateFlags) { counter++;	return 0; };
+			window.onWheelScroll = [&](int, int, EzMouseStateFlags) { counter++;	return 0; };
+		}
+
+		sendBatch("onKeyboardPress", installed != 0, WM_KEYDOWN, 'A', 0);
+		sendBatch("onInputCharacter", installed != 0, WM_CHAR, 'a', 0);
+		sendBatch("onMouseMove", installed != 0, WM_MOUSEMOVE, 0, MAKELPARAM(10, 10));
+		sendBatch("onMouseClick", installed != 0, WM_LBUTTONDOWN, MK_LBUTTON, MAKELPARAM(10, 10));
+		sendBatch("onWheelScroll", installed != 0, WM_MOUSEWHEEL, MAKEWPARAM(0, WHEEL_DELTA), 0);
+
+		report.run("dispatch", { { "callback", "posted" }, { "installed", installed } }, iterations, batchSize, [&]()
+		{
+			for (int i = 0; i < batchSize; i++)
+			{
+				::PostMessage(hWnd, WM_KEYDOWN, 'A', 0);
+			}
+
+			window.processEvents();
+		});
+	}
+
+	window.onWheelScroll = nullptr;
+	window.onMouseClick = nullptr;
+	window.onMouseMove = nullptr;
+	window.onInputCharacter = nullptr;
+	window.onKeyboardPress = nullptr;
+
+	window.close();
+}
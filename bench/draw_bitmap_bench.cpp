@@ -0,0 +1,94 @@
+/**
+ *	Copyright (c) 2025 Wenchao Huang <physhuangwenchao@gmail.com>
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include <vector>
+#include <easywin32.h>
+#include "benchmark.h"
+
+/*********************************************************************************
+*****************************    drawBitmapBench    ******************************
+*********************************************************************************/
+
+/**
+ *	@brief		Measures `drawBitmap` throughput for each pixel format at several resolutions.
+ *	@details	Every iteration invalidates the whole client area and repaints it synchronously with
+ *				`UpdateWindow`, followed by `GdiFlush` so batched GDI work is included in the measurement.
+ */
+void drawBitmapBench(BenchmarkReport & report)
+{
+	const EzSize resolutions[] = { { 640, 480 }, { 1280, 720 }, { 1920, 1080 }, { 3840, 2160 } };
+
+	for (const EzSize & resolution : resolutions)
+	{
+		const int width = resolution.cx;
+		const int height = resolution.cy;
+		const size_t count = static_cast<size_t>(width) * height;
+
+		std::vector<EzColorRGB> rgb(count, EzColorRGB{ 100, 200, 255 });
+		std::vector<EzColorRGBA> rgba(count, EzColorRGBA{ { 100, 200, 255 }, 255 });
+		std::vector<EzColorBGRA> bgra(count, EzColorBGRA{ 255, 200, 100, 255 });
+
+		const char * const formats[] = { "rgb", "rgba", "bgra" };
+
+		int format = 0;
+
+		EzWindow window;
+		window.open("EasyWin32-Bench", EzRect{ 0, 0, width, height }, EzStyle::PopupWindow);
+		window.show();
+
+		window.onPaint = [&]()
+		{
+			if (format == 0)			window.drawBitmap(rgb.data(), width, height);
+			else if (format == 1)		window.drawBitmap(rgba.data(), width, height, size_t(0));
+			else						window.drawBitmap(bgra.data(), width, height, size_t(0));
+
+			return 0;
+		};
+
+		window.processEvents();
+
+		// The visible client area may be smaller than requested on small screens
+		const EzSize extent = window.getClientExtent();
+
+		const int extentX = static_cast<int>(extent.cx);
+		const int extentY = static_cast<int>(extent.cy);
+
+		const int iterations = count > 4000000 ? 50 : 200;
+
+		for (format = 0; format < 3; format++)
+		{
+			report.run("drawBitmap", { { "format", formats[format] }, { "width", extentX }, { "height", extentY } }, iterations,
+					   static_cast<double>(extentX) * extentY, [&]()
+			{
+				::InvalidateRect(window.nativeHandle(), nullptr, FALSE);
+
+				::UpdateWindow(window.nativeHandle());
+
+				::GdiFlush();
+			});
+		}
+
+		window.onPaint = nullptr;
+
+		window.close();
+	}
+}
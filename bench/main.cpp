@@ -0,0 +1,69 @@
+/**
+ *	Copyright (c) 2025 Wenchao Huang <physhuangwenchao@gmail.com>
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include <fstream>
+#include "benchmark.h"
+
+/*********************************************************************************
+***********************************    main    ***********************************
+*********************************************************************************/
+
+extern void drawBitmapBench(BenchmarkReport & report);
+extern void dispatchBench(BenchmarkReport & report);
+extern void windowBench(BenchmarkReport & report);
+extern void pixelOpsBench(BenchmarkReport & report);
+
+/**
+ *	@brief		Runs every benchmark and writes the JSON report.
+ *	@details	Usage: `easywin32-bench [output.json]`. The report goes to `stdout` when no path is given.
+ */
+int main(int argc, char ** argv)
+{
+	BenchmarkReport report;
+
+	drawBitmapBench(report);
+	dispatchBench(report);
+	windowBench(report);
+	pixelOpsBench(report);
+
+	std::string json = report.toJson();
+
+	if (argc > 1)
+	{
+		std::ofstream file(argv[1], std::ios::binary);
+
+		file << json;
+
+		if (!file.good())
+		{
+			fprintf(stderr, "Failed to write '%s'.\n", argv[1]);
+
+			return 1;
+		}
+	}
+	else
+	{
+		fputs(json.c_str(), stdout);
+	}
+
+	return 0;
+}
@@ -0,0 +1,96 @@
+/**
+ *	Copyright (c) 2025 Wenchao Huang <physhuangwenchao@gmail.com>
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include <vector>
+#include <easywin32_pixelops.h>
+#include "benchmark.h"
+
+/*********************************************************************************
+******************************    pixelOpsBench    *******************************
+*********************************************************************************/
+
+/**
+ *	@brief		Measures the pixel kernels at 1080p with every instruction set supported by the CPU.
+ *	@details	The `Scalar` runs are the reference the SIMD kernels are compared against. Scaling goes
+ *				from a 960x540 source to the 1920x1080 destination (fit to a client area twice as large).
+ */
+void pixelOpsBench(BenchmarkReport & report)
+{
+	const int width = 1920, height = 1080;
+	const int srcWidth = width / 2, srcHeight = height / 2;
+	const int iterations = 100;
+
+	const double pixels = static_cast<double>(width) * height;
+
+	std::vector<EzColorBGRA> image(static_cast<size_t>(width) * height, EzColorBGRA{ 40, 80, 120, 255 });
+	std::vector<EzColorBGRA> source(static_cast<size_t>(srcWidth) * srcHeight);
+	std::vector<EzColorRGBA> sprite(static_cast<size_t>(width) * height);
+	std::vector<EzColorRGB> rgb(static_cast<size_t>(width) * height, EzColorRGB{ 100, 200, 255 });
+
+	for (size_t i = 0; i < sprite.size(); i++)
+	{
+		sprite[i] = EzColorRGBA{ { uint8_t(i), uint8_t(i >> 8), uint8_t(i >> 16) }, uint8_t(i * 7) };		// Every alpha value
+	}
+
+	for (size_t i = 0; i < source.size(); i++)
+	{
+		source[i] = EzColorBGRA{ uint8_t(i), uint8_t(i >> 4), uint8_t(i >> 8), 255 };
+	}
+
+	const auto defaultIsa = EzPixelOps::getIsa();
+
+	for (auto isa : { EzPixelOps::Isa::Scalar, EzPixelOps::Isa::SSE41, EzPixelOps::Isa::AVX2, EzPixelOps::Isa::NEON })
+	{
+		if (!EzPixelOps::setIsa(isa))
+			continue;
+
+		const char * name = EzPixelOps::to_string(isa);
+
+		report.run("pixelOps", { { "kernel", "fill" }, { "isa", name }, { "width", width }, { "height", height } }, iterations, pixels, [&]()
+		{
+			EzPixelOps::fill(image.data(), width, height, 0, EzColorBGRA{ 40, 80, 120, 255 });
+		});
+
+		report.run("pixelOps", { { "kernel", "blend" }, { "isa", name }, { "width", width }, { "height", height } }, iterations, pixels, [&]()
+		{
+			EzPixelOps::blend(sprite.data(), 0, image.data(), 0, width, height);
+		});
+
+		report.run("pixelOps", { { "kernel", "scaleNearest" }, { "isa", name }, { "width", width }, { "height", height } }, iterations, pixels, [&]()
+		{
+			EzPixelOps::scale(source.data(), srcWidth, srcHeight, 0, image.data(), width, height, 0, EzPixelOps::Filter::Nearest);
+		});
+
+		report.run("pixelOps", { { "kernel", "scaleBilinear" }, { "isa", name }, { "width", width }, { "height", height } }, iterations, pixels, [&]()
+		{
+			EzPixelOps::scale(source.data(), srcWidth, srcHeight, 0, image.data(), width, height, 0, EzPixelOps::Filter::Bilinear);
+		});
+	}
+
+	EzPixelOps::setIsa(defaultIsa);
+
+	// RGB -> BGRX conversion has its own dispatch (`convertPixels`)
+	report.run("pixelOps", { { "kernel", "convert" }, { "isa", EzPixelOps::to_string(defaultIsa) }, { "width", width }, { "height", height } }, iterations, pixels, [&]()
+	{
+		EzPixelOps::convert(rgb.data(), 0, image.data(), 0, width, height);
+	});
+}
@@ -0,0 +1,100 @@
+/**
+ *	Copyright (c) 2025 Wenchao Huang <physhuangwenchao@gmail.com>
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include <vector>
+#include <chrono>
+#include <easywin32.h>
+#include "benchmark.h"
+
+/*********************************************************************************
+*******************************    windowBench    ********************************
+*********************************************************************************/
+
+/**
+ *	@brief		Measures window creation, destruction and reconfiguration latency.
+ *	@details	`open` and `close` are timed separately for a visible overlapped window, pending messages are
+ *				drained between iterations outside of the timed region. `setStyle` and `setPos` alternate between
+ *				two states and read the result back, so each sample is a full round trip through the window manager;
+ *				`setPos` switches between two sizes, each sample is a real resize and not only a move.
+ */
+void windowBench(BenchmarkReport & report)
+{
+	const int iterations = 50;
+
+	std::vector<double> openSamples, closeSamples;
+
+	for (int i = 0; i < iterations; i++)
+	{
+		EzWindow window;
+
+		auto t0 = std::chrono::steady_clock::now();
+
+		window.open("EasyWin32-Bench", EzRect{ 100, 100, 900, 700 });
+		window.show();
+
+		auto t1 = std::chrono::steady_clock::now();
+
+		window.processEvents();
+
+		auto t2 = std::chrono::steady_clock::now();
+
+		window.close();
+
+		auto t3 = std::chrono::steady_clock::now();
+
+		EzThreadWindows::processEvents();
+
+		openSamples.push_back(std::chrono::duration<double, std::nano>(t1 - t0).count());
+		closeSamples.push_back(std::chrono::duration<double, std::nano>(t3 - t2).count());
+	}
+
+	report.add("open", {}, openSamples);
+	report.add("close", {}, closeSamples);
+
+	EzWindow window;
+	window.open("EasyWin32-Bench", EzRect{ 100, 100, 900, 700 });
+	window.show();
+	window.processEvents();
+
+	int toggle = 0;
+
+	report.run("setStyle", {}, iterations * 4, 1.0, [&]()
+	{
+		window.setStyle((toggle++ & 1) ? EzStyle::OverlappedWindow : EzStyle::HeaderlessWindow);
+
+		volatile bool check = window.getStyleFlags().has(EzStyle::SysMenu);		(void)check;
+	});
+
+	window.enableFramebuffer(true);
+
+	report.run("setPos", {}, iterations * 4, 1.0, [&]()
+	{
+		//	Two different sizes, so that each sample goes through `WM_SIZE` and the framebuffer reallocation
+		const int grow = (toggle++ & 1) ? 0 : 160;
+
+		window.setPos(100, 100, 900 + grow, 700 + grow);
+
+		volatile LONG check = window.getClientPos().x + window.getClientExtent().cx;		(void)check;
+	});
+
+	window.close();
+}
@@ -22,4 +22,6 @@
 
 #define EZWIN32_IMPLEMENTATION
 
-#include "easywin32.h"
\ No newline at end of file
+#include "easywin32.h"
+#include "easywin32_d3d11.h"
+#include "easywin32_pixelops.h"
\ No newline at end of file
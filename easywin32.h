@@ -27,14 +27,36 @@
 #include <assert.h>
 #include <Windows.h>
 #include <dwmapi.h>
+#include <wtsapi32.h>
 
 // C++ headers
+#include <cmath>
+#include <new>
+#include <cstring>
+#include <atomic>
+#include <bitset>
+#include <memory>
 #include <string>
+#include <thread>
 #include <vector>
+#include <optional>
 #include <functional>
+#include <algorithm>
+#include <string_view>
+#include <type_traits>
 
-// Link dwmapi.lib
+// Forward declarations
+#include "easywin32_fwd.h"
+
+// Link dwmapi.lib and wtsapi32.lib (session lock notifications)
 #pragma comment(lib, "dwmapi.lib")
+#pragma comment(lib, "wtsapi32.lib")
+
+// Optional ETW events of the dispatch profiler
+#if defined(EZWIN32_ENABLE_PROFILER) && defined(EZWIN32_ENABLE_TRACELOGGING)
+	#include <TraceLoggingProvider.h>
+	TRACELOGGING_DECLARE_PROVIDER(g_easywin32TraceProvider);
+#endif
 
 /*********************************************************************************
 ********************************    EasyWin32    *********************************
@@ -42,35 +64,56 @@
 
 namespace easywin32
 {
-	class Window;
+	static_assert(std::is_same_v<Byte, BYTE> && std::is_same_v<Result, LRESULT>, "easywin32_fwd.h does not match <Windows.h>");
+	static_assert(std::is_same_v<Size, SIZE> && std::is_same_v<Rect, RECT> && std::is_same_v<Point, POINT>, "easywin32_fwd.h does not match <Windows.h>");
 
-	using Byte = BYTE;
-	using Size = SIZE;
-	using Rect = RECT;
-	using Point = POINT;
-	using Result = LRESULT;
 #ifdef UNICODE
 	using string_type = std::wstring;
+	using string_view_type = std::wstring_view;
 #else
 	using string_type = std::string;
+	using string_view_type = std::string_view;
 #endif
 
 	/*****************************************************************************
 	********************************    Color    *********************************
 	*****************************************************************************/
 
-	//!	@brief	Represents an RGB color with 8-bit channels.
-	struct ColorRGB
-	{
-		uint8_t		r;	//!< Red channel component (0–255)
-		uint8_t		g;	//!< Green channel component (0–255)
-		uint8_t		b;	//!< Blue channel component (0–255)
-	};
+	/**
+	 *	@brief		Converts packed RGB pixels to 32-bit BGRX pixels (alpha is set to 255).
+	 *	@details	Uses an AVX2 or SSSE3 shuffle kernel when supported by the CPU (detected once at runtime),
+	 *				and falls back to scalar code otherwise.
+	 *	@param[in]	src - Source pixels, `count` elements.
+	 *	@param[out]	dst - Destination pixels, `count` elements, must not overlap with `src`.
+	 */
+	void convertPixels(const ColorRGB * src, ColorBGRA * dst, size_t count);
+
+	/**
+	 *	@brief		Converts straight-alpha RGBA pixels to premultiplied BGRA pixels, as expected by `UpdateLayeredWindow`.
+	 *	@param[in]	src - Source pixels, `count` elements.
+	 *	@param[out]	dst - Destination pixels, `count` elements, must not overlap with `src`.
+	 */
+	void premultiplyPixels(const ColorRGBA * src, ColorBGRA * dst, size_t count);
+
+	/*****************************************************************************
+	******************************    FrameStats    ******************************
+	*****************************************************************************/
 
-	//!	@brief	Represents an RGBA color with 8-bit channels.
-	struct ColorRGBA : public ColorRGB
+	/**
+	 *	@brief		Per-frame timing reported by `Window::runFrameLoop` (all times in seconds, measured with QPC).
+	 *	@note		`cpuTime` and `presentTime` describe the previous frame, since the current one has not run yet.
+	 */
+	struct FrameStats
 	{
-		uint8_t		a;	//!< Alpha channel component (0–255)
+		uint64_t	frameIndex;			//!< Index of the current frame, starting from 0.
+		double		time;				//!< Time since the loop started, at the beginning of this frame.
+		double		deltaTime;			//!< Time between the beginning of the previous frame and this one.
+		double		targetInterval;		//!< Target frame interval (display refresh period when pacing with DWM).
+		double		cpuTime;			//!< Time spent in the frame callback.
+		double		presentTime;		//!< Time spent presenting the framebuffer (0 if it is disabled).
+		double		jitter;				//!< Absolute deviation of `deltaTime` from `targetInterval`.
+		double		maxJitter;			//!< Largest `jitter` observed within the last averaging period (~0.5s).
+		double		fps;				//!< Average frame rate over the last averaging period (~0.5s).
 	};
 
 	/*****************************************************************************
@@ -172,6 +215,165 @@ namespace easywin32
 			result += #x;														\
 		}
 
+	/*****************************************************************************
+	*************************    Callback<Signature>    **************************
+	*****************************************************************************/
+
+	template<typename Signature> class Callback;
+
+	/**
+	 *	@brief		Lightweight type-erased callable used for window callbacks, a replacement of `std::function`.
+	 *	@details	Callables of up to `InlineSize` bytes (e.g. lambdas capturing a few references or pointers)
+	 *				are stored inline without heap allocation, larger ones fall back to the heap. Invoking is a
+	 *				single indirect call, and testing for an installed callback is a null pointer check, so
+	 *				the dispatcher pays nothing for messages without listeners.
+	 */
+	template<typename Ret, typename... Args> class Callback<Ret(Args...)>
+	{
+		//	Enables the constructor and assignment only for callables (excluding `Callback` itself).
+		template<typename Func> using EnableIfCallable = std::enable_if_t<!std::is_same_v<std::decay_t<Func>, Callback> && std::is_invocable_r_v<Ret, std::decay_t<Func>&, Args...>>;
+
+	public:
+
+		//!	@brief	Size of the inline storage, in bytes.
+		static constexpr size_t InlineSize = 3 * sizeof(void*);
+
+		Callback() noexcept = default;
+
+		Callback(std::nullptr_t) noexcept {}
+
+		template<typename Func, typename = EnableIfCallable<Func>> Callback(Func && func) { this->assign(std::forward<Func>(func)); }
+
+		Callback(const Callback & rhs) { this->copyFrom(rhs); }
+
+		Callback(Callback && rhs) noexcept { this->moveFrom(rhs); }
+
+		~Callback() { this->reset(); }
+
+	public:
+
+		Callback & operator=(const Callback & rhs) { if (this != &rhs) { this->reset();		this->copyFrom(rhs); }	return *this; }
+
+		Callback & operator=(Callback && rhs) noexcept { if (this != &rhs) { this->reset();		this->moveFrom(rhs); }	return *this; }
+
+		Callback & operator=(std::nullptr_t) noexcept { this->reset();		return *this; }
+
+		template<typename Func, typename = EnableIfCallable<Func>> Callback & operator=(Func && func) { this->reset();		this->assign(std::forward<Func>(func));		return *this; }
+
+		//!	@brief	Whether a callable is installed.
+		explicit operator bool() const noexcept { return m_invoke != nullptr; }
+
+		//!	@brief	Invokes the installed callable, which must not be empty.
+		Ret operator()(Args... args) const { return m_invoke(m_storage, std::forward<Args>(args)...); }
+
+		//!	@brief	Destroys the installed callable, if any.
+		void reset() noexcept
+		{
+			if (m_manage != nullptr)
+			{
+				m_manage(Operation::Destroy, m_storage, m_storage);
+			}
+
+			m_invoke = nullptr;
+
+			m_manage = nullptr;
+		}
+
+	private:
+
+		enum class Operation { Copy, Move, Destroy };
+
+		template<typename Func> static constexpr bool IsInline = (sizeof(Func) <= InlineSize) && (alignof(Func) <= alignof(void*)) && std::is_nothrow_move_constructible_v<Func>;
+
+		template<typename Func> static Func * target(void * storage) noexcept
+		{
+			if constexpr (IsInline<Func>)		return static_cast<Func*>(storage);
+			else								return *static_cast<Func**>(storage);
+		}
+
+		template<typename Func> static Ret invoke(void * storage, Args... args)
+		{
+			if constexpr (std::is_void_v<Ret>)
+				(*target<Func>(storage))(std::forward<Args>(args)...);
+			else
+				return (*target<Func>(storage))(std::forward<Args>(args)...);
+		}
+
+		template<typename Func> static void manage(Operation operation, void * dst, void * src)
+		{
+			if constexpr (IsInline<Func>)
+			{
+				switch (operation)
+				{
+					case Operation::Copy:		new (dst) Func(*static_cast<const Func*>(src));											break;
+					case Operation::Move:		new (dst) Func(std::move(*static_cast<Func*>(src)));	static_cast<Func*>(src)->~Func();	break;
+					case Operation::Destroy:	static_cast<Func*>(dst)->~Func();														break;
+				}
+			}
+			else
+			{
+				switch (operation)
+				{
+					case Operation::Copy:		*static_cast<Func**>(dst) = new Func(**static_cast<Func**>(src));		break;
+					case Operation::Move:		*static_cast<Func**>(dst) = *static_cast<Func**>(src);					break;
+					case Operation::Destroy:	delete *static_cast<Func**>(dst);										break;
+				}
+			}
+		}
+
+		template<typename Func> void assign(Func && func)
+		{
+			using FuncType = std::decay_t<Func>;
+
+			//	Null pointers and empty wrappers (`std::function`, or anything explicitly testable) leave it empty
+			if constexpr (std::is_pointer_v<FuncType> || std::is_member_pointer_v<FuncType>)
+			{
+				if (func == nullptr)		return;
+			}
+			else if constexpr (std::is_constructible_v<bool, const FuncType&> && !std::is_convertible_v<const FuncType&, bool>)
+			{
+				if (!static_cast<bool>(func))		return;
+			}
+
+			if constexpr (IsInline<FuncType>)
+				new (m_storage) FuncType(std::forward<Func>(func));
+			else
+				*reinterpret_cast<FuncType**>(m_storage) = new FuncType(std::forward<Func>(func));
+
+			m_invoke = &Callback::invoke<FuncType>;
+
+			m_manage = &Callback::manage<FuncType>;
+		}
+
+		void copyFrom(const Callback & rhs)
+		{
+			if (rhs.m_invoke != nullptr)
+			{
+				rhs.m_manage(Operation::Copy, m_storage, rhs.m_storage);
+
+				m_invoke = rhs.m_invoke;		m_manage = rhs.m_manage;
+			}
+		}
+
+		void moveFrom(Callback & rhs) noexcept
+		{
+			if (rhs.m_invoke != nullptr)
+			{
+				rhs.m_manage(Operation::Move, m_storage, rhs.m_storage);
+
+				m_invoke = rhs.m_invoke;		m_manage = rhs.m_manage;
+
+				rhs.m_invoke = nullptr;		rhs.m_manage = nullptr;
+			}
+		}
+
+	private:
+
+		alignas(void*) mutable unsigned char		m_storage[InlineSize];
+		Ret(*m_invoke)(void*, Args...) = nullptr;
+		void(*m_manage)(Operation, void*, void*) = nullptr;
+	};
+
 	/*****************************************************************************
 	********************************    Style    *********************************
 	*****************************************************************************/
@@ -202,24 +404,7 @@ namespace easywin32
 	EZWIN32_ENABLE_ENUM_FLAGS(Style);
 
 	//!	@brief	Converts a `Flags<Style>` to a readable string.
-	static inline std::string to_string(Flags<Style> styleFlags)
-	{
-		std::string result;
-
-		EZWIN32_CASE_APPEND_STR(result, styleFlags, Style::Border);
-		EZWIN32_CASE_APPEND_STR(result, styleFlags, Style::Visible);
-		EZWIN32_CASE_APPEND_STR(result, styleFlags, Style::SysMenu);
-		EZWIN32_CASE_APPEND_STR(result, styleFlags, Style::Caption);
-		EZWIN32_CASE_APPEND_STR(result, styleFlags, Style::Disabled);
-		EZWIN32_CASE_APPEND_STR(result, styleFlags, Style::Resizable);
-		EZWIN32_CASE_APPEND_STR(result, styleFlags, Style::ThickFrame);
-		EZWIN32_CASE_APPEND_STR(result, styleFlags, Style::MinimizeBox);
-		EZWIN32_CASE_APPEND_STR(result, styleFlags, Style::MaximizeBox);
-		EZWIN32_CASE_APPEND_STR(result, styleFlags, Style::PopupWindow);
-		EZWIN32_CASE_APPEND_STR(result, styleFlags, Style::OverlappedWindow);
-
-		return result.empty() ?	"Style::Empty" : result;
-	}
+	std::string to_string(Flags<Style> styleFlags);
 
 	/*****************************************************************************
 	*******************************    ExStyle    ********************************
@@ -268,41 +453,7 @@ namespace easywin32
 	EZWIN32_ENABLE_ENUM_FLAGS(ExStyle);
 
 	//!	@brief	Converts a `Flags<ExStyle>` to a readable string.
-	static inline std::string to_string(Flags<ExStyle> exStyleFlags)
-	{
-		std::string result;
-
-		// Individual
-		EZWIN32_CASE_APPEND_STR(result, exStyleFlags, ExStyle::AcceptFiles);
-		EZWIN32_CASE_APPEND_STR(result, exStyleFlags, ExStyle::AppWindow);
-		EZWIN32_CASE_APPEND_STR(result, exStyleFlags, ExStyle::ClientEdge);
-		EZWIN32_CASE_APPEND_STR(result, exStyleFlags, ExStyle::Composited);
-		EZWIN32_CASE_APPEND_STR(result, exStyleFlags, ExStyle::ContextHelp);
-		EZWIN32_CASE_APPEND_STR(result, exStyleFlags, ExStyle::ControlParent);
-		EZWIN32_CASE_APPEND_STR(result, exStyleFlags, ExStyle::DlgModalFrame);
-		EZWIN32_CASE_APPEND_STR(result, exStyleFlags, ExStyle::Layered);
-		EZWIN32_CASE_APPEND_STR(result, exStyleFlags, ExStyle::LayoutRtl);
-		EZWIN32_CASE_APPEND_STR(result, exStyleFlags, ExStyle::LeftScrollBar);
-		EZWIN32_CASE_APPEND_STR(result, exStyleFlags, ExStyle::LtrReading);
-		EZWIN32_CASE_APPEND_STR(result, exStyleFlags, ExStyle::MDIChild);
-		EZWIN32_CASE_APPEND_STR(result, exStyleFlags, ExStyle::NoActivate);
-		EZWIN32_CASE_APPEND_STR(result, exStyleFlags, ExStyle::NoInheritLayout);
-		EZWIN32_CASE_APPEND_STR(result, exStyleFlags, ExStyle::NoParentNotify);
-		EZWIN32_CASE_APPEND_STR(result, exStyleFlags, ExStyle::NoRedirectionBitmap);
-		EZWIN32_CASE_APPEND_STR(result, exStyleFlags, ExStyle::Right);
-		EZWIN32_CASE_APPEND_STR(result, exStyleFlags, ExStyle::RightScrollBar);
-		EZWIN32_CASE_APPEND_STR(result, exStyleFlags, ExStyle::RtlReading);
-		EZWIN32_CASE_APPEND_STR(result, exStyleFlags, ExStyle::StaticEdge);
-		EZWIN32_CASE_APPEND_STR(result, exStyleFlags, ExStyle::ToolWindow);
-		EZWIN32_CASE_APPEND_STR(result, exStyleFlags, ExStyle::TopMost);
-		EZWIN32_CASE_APPEND_STR(result, exStyleFlags, ExStyle::Transparent);
-		EZWIN32_CASE_APPEND_STR(result, exStyleFlags, ExStyle::WindowEdge);
-		// Combined
-		EZWIN32_CASE_APPEND_STR(result, exStyleFlags, ExStyle::OverlappedWindow);
-		EZWIN32_CASE_APPEND_STR(result, exStyleFlags, ExStyle::PaletteWindow);
-
-		return result.empty() ? "ExStyle::Left" : result;
-	}
+	std::string to_string(Flags<ExStyle> exStyleFlags);
 
 	/*****************************************************************************
 	******************************    CornerStyle    *****************************
@@ -485,146 +636,7 @@ namespace easywin32
 	};
 
 	//! @brief	Convert `Key` enum to string for debugging or logging.
-	static inline const char * to_string(Key key)
-	{
-		switch (key)
-		{
-			EZWIN32_CASE_TO_STR(Key::A);
-			EZWIN32_CASE_TO_STR(Key::B);
-			EZWIN32_CASE_TO_STR(Key::C);
-			EZWIN32_CASE_TO_STR(Key::D);
-			EZWIN32_CASE_TO_STR(Key::E);
-			EZWIN32_CASE_TO_STR(Key::F);
-			EZWIN32_CASE_TO_STR(Key::G);
-			EZWIN32_CASE_TO_STR(Key::H);
-			EZWIN32_CASE_TO_STR(Key::I);
-			EZWIN32_CASE_TO_STR(Key::J);
-			EZWIN32_CASE_TO_STR(Key::K);
-			EZWIN32_CASE_TO_STR(Key::L);
-			EZWIN32_CASE_TO_STR(Key::M);
-			EZWIN32_CASE_TO_STR(Key::N);
-			EZWIN32_CASE_TO_STR(Key::O);
-			EZWIN32_CASE_TO_STR(Key::P);
-			EZWIN32_CASE_TO_STR(Key::Q);
-			EZWIN32_CASE_TO_STR(Key::R);
-			EZWIN32_CASE_TO_STR(Key::S);
-			EZWIN32_CASE_TO_STR(Key::T);
-			EZWIN32_CASE_TO_STR(Key::U);
-			EZWIN32_CASE_TO_STR(Key::V);
-			EZWIN32_CASE_TO_STR(Key::W);
-			EZWIN32_CASE_TO_STR(Key::X);
-			EZWIN32_CASE_TO_STR(Key::Y);
-			EZWIN32_CASE_TO_STR(Key::Z);
-
-			EZWIN32_CASE_TO_STR(Key::Num0);
-			EZWIN32_CASE_TO_STR(Key::Num1);
-			EZWIN32_CASE_TO_STR(Key::Num2);
-			EZWIN32_CASE_TO_STR(Key::Num3);
-			EZWIN32_CASE_TO_STR(Key::Num4);
-			EZWIN32_CASE_TO_STR(Key::Num5);
-			EZWIN32_CASE_TO_STR(Key::Num6);
-			EZWIN32_CASE_TO_STR(Key::Num7);
-			EZWIN32_CASE_TO_STR(Key::Num8);
-			EZWIN32_CASE_TO_STR(Key::Num9);
-
-			EZWIN32_CASE_TO_STR(Key::F1);
-			EZWIN32_CASE_TO_STR(Key::F2);
-			EZWIN32_CASE_TO_STR(Key::F3);
-			EZWIN32_CASE_TO_STR(Key::F4);
-			EZWIN32_CASE_TO_STR(Key::F5);
-			EZWIN32_CASE_TO_STR(Key::F6);
-			EZWIN32_CASE_TO_STR(Key::F7);
-			EZWIN32_CASE_TO_STR(Key::F8);
-			EZWIN32_CASE_TO_STR(Key::F9);
-			EZWIN32_CASE_TO_STR(Key::F10);
-			EZWIN32_CASE_TO_STR(Key::F11);
-			EZWIN32_CASE_TO_STR(Key::F12);
-			EZWIN32_CASE_TO_STR(Key::F13);
-			EZWIN32_CASE_TO_STR(Key::F14);
-			EZWIN32_CASE_TO_STR(Key::F15);
-			EZWIN32_CASE_TO_STR(Key::F16);
-			EZWIN32_CASE_TO_STR(Key::F17);
-			EZWIN32_CASE_TO_STR(Key::F18);
-			EZWIN32_CASE_TO_STR(Key::F19);
-			EZWIN32_CASE_TO_STR(Key::F20);
-			EZWIN32_CASE_TO_STR(Key::F21);
-			EZWIN32_CASE_TO_STR(Key::F22);
-			EZWIN32_CASE_TO_STR(Key::F23);
-			EZWIN32_CASE_TO_STR(Key::F24);
-
-			EZWIN32_CASE_TO_STR(Key::Pause);
-			EZWIN32_CASE_TO_STR(Key::ScrollLock);
-			EZWIN32_CASE_TO_STR(Key::PrintScreen);
-
-			EZWIN32_CASE_TO_STR(Key::End);
-			EZWIN32_CASE_TO_STR(Key::Home);
-			EZWIN32_CASE_TO_STR(Key::Insert);
-			EZWIN32_CASE_TO_STR(Key::Delete);
-			EZWIN32_CASE_TO_STR(Key::PageUp);
-			EZWIN32_CASE_TO_STR(Key::PageDown);
-
-			EZWIN32_CASE_TO_STR(Key::Up);
-			EZWIN32_CASE_TO_STR(Key::Down);
-			EZWIN32_CASE_TO_STR(Key::Left);
-			EZWIN32_CASE_TO_STR(Key::Right);
-
-			EZWIN32_CASE_TO_STR(Key::Tab);
-			EZWIN32_CASE_TO_STR(Key::Alt);
-			EZWIN32_CASE_TO_STR(Key::Apps);
-			EZWIN32_CASE_TO_STR(Key::Space);
-			EZWIN32_CASE_TO_STR(Key::Clear);
-			EZWIN32_CASE_TO_STR(Key::Shift);
-			EZWIN32_CASE_TO_STR(Key::Enter);
-			EZWIN32_CASE_TO_STR(Key::LeftWin);
-			EZWIN32_CASE_TO_STR(Key::RightWin);
-			EZWIN32_CASE_TO_STR(Key::Escape);
-			EZWIN32_CASE_TO_STR(Key::Control);
-			EZWIN32_CASE_TO_STR(Key::CapLock);
-			EZWIN32_CASE_TO_STR(Key::BackSpace);
-
-			EZWIN32_CASE_TO_STR(Key::NumLock);
-			EZWIN32_CASE_TO_STR(Key::NumPad0);
-			EZWIN32_CASE_TO_STR(Key::NumPad1);
-			EZWIN32_CASE_TO_STR(Key::NumPad2);
-			EZWIN32_CASE_TO_STR(Key::NumPad3);
-			EZWIN32_CASE_TO_STR(Key::NumPad4);
-			EZWIN32_CASE_TO_STR(Key::NumPad5);
-			EZWIN32_CASE_TO_STR(Key::NumPad6);
-			EZWIN32_CASE_TO_STR(Key::NumPad7);
-			EZWIN32_CASE_TO_STR(Key::NumPad8);
-			EZWIN32_CASE_TO_STR(Key::NumPad9);
-
-			EZWIN32_CASE_TO_STR(Key::Add);
-			EZWIN32_CASE_TO_STR(Key::Divide);
-			EZWIN32_CASE_TO_STR(Key::Decimal);
-			EZWIN32_CASE_TO_STR(Key::Subtract);
-			EZWIN32_CASE_TO_STR(Key::Multiply);
-
-			EZWIN32_CASE_TO_STR(Key::VolumeUp);
-			EZWIN32_CASE_TO_STR(Key::VolumeMute);
-			EZWIN32_CASE_TO_STR(Key::VolumeDown);
-
-			EZWIN32_CASE_TO_STR(Key::MediaStop);
-			EZWIN32_CASE_TO_STR(Key::MediaPlayPause);
-			EZWIN32_CASE_TO_STR(Key::MediaNextTrack);
-			EZWIN32_CASE_TO_STR(Key::MediaPrevTrack);
-
-			EZWIN32_CASE_TO_STR(Key::LaunchMail);
-			EZWIN32_CASE_TO_STR(Key::LaunchApp1);
-			EZWIN32_CASE_TO_STR(Key::LaunchApp2);
-			EZWIN32_CASE_TO_STR(Key::LaunchMediaSelect);
-
-			EZWIN32_CASE_TO_STR(Key::BrowserHome);
-			EZWIN32_CASE_TO_STR(Key::BrowserStop);
-			EZWIN32_CASE_TO_STR(Key::BrowserBack);
-			EZWIN32_CASE_TO_STR(Key::BrowserSearch);
-			EZWIN32_CASE_TO_STR(Key::BrowserForward);
-			EZWIN32_CASE_TO_STR(Key::BrowserRefresh);
-			EZWIN32_CASE_TO_STR(Key::BrowserFavorites);
-
-			default:	return "Key::Unknown";
-		}
-	}
+	const char * to_string(Key key);
 
 	/*****************************************************************************
 	*****************************    MouseButton    ******************************
@@ -641,18 +653,7 @@ namespace easywin32
 	};
 
 	//!	@brief	Converts a `MouseButton` enum value to a string representation.
-	static inline const char * to_string(MouseButton button)
-	{
-		switch (button)
-		{
-			EZWIN32_CASE_TO_STR(MouseButton::Left);
-			EZWIN32_CASE_TO_STR(MouseButton::Right);
-			EZWIN32_CASE_TO_STR(MouseButton::Middle);
-			EZWIN32_CASE_TO_STR(MouseButton::XButton1);
-			EZWIN32_CASE_TO_STR(MouseButton::XButton2);
-			default:	return "MouseButton::Unknown";
-		}
-	}
+	const char * to_string(MouseButton button);
 
 	/*****************************************************************************
 	******************************    MouseState    ******************************
@@ -674,20 +675,32 @@ namespace easywin32
 	EZWIN32_ENABLE_ENUM_FLAGS(MouseState);
 
 	//!	@brief	Converts a `Flags<MouseState>` to a readable string.
-	static inline std::string to_string(Flags<MouseState> stateFlags)
+	std::string to_string(Flags<MouseState> stateFlags);
+
+	/*****************************************************************************
+	****************************    RawMouseButton    ****************************
+	*****************************************************************************/
+
+	//! @brief	Button transition bit flags of a raw mouse packet (see `Window::onRawMouse`).
+	enum class RawMouseButton
 	{
-		std::string result;
+		LeftDown		= RI_MOUSE_LEFT_BUTTON_DOWN,		//!< Left mouse button went down.
+		LeftUp			= RI_MOUSE_LEFT_BUTTON_UP,			//!< Left mouse button went up.
+		RightDown		= RI_MOUSE_RIGHT_BUTTON_DOWN,		//!< Right mouse button went down.
+		RightUp			= RI_MOUSE_RIGHT_BUTTON_UP,			//!< Right mouse button went up.
+		MiddleDown		= RI_MOUSE_MIDDLE_BUTTON_DOWN,		//!< Middle mouse button went down.
+		MiddleUp		= RI_MOUSE_MIDDLE_BUTTON_UP,		//!< Middle mouse button went up.
+		XButton1Down	= RI_MOUSE_BUTTON_4_DOWN,			//!< Extra mouse button 1 went down.
+		XButton1Up		= RI_MOUSE_BUTTON_4_UP,				//!< Extra mouse button 1 went up.
+		XButton2Down	= RI_MOUSE_BUTTON_5_DOWN,			//!< Extra mouse button 2 went down.
+		XButton2Up		= RI_MOUSE_BUTTON_5_UP,				//!< Extra mouse button 2 went up.
+	};
 
-		EZWIN32_CASE_APPEND_STR(result, stateFlags, MouseState::Left);
-		EZWIN32_CASE_APPEND_STR(result, stateFlags, MouseState::Right);
-		EZWIN32_CASE_APPEND_STR(result, stateFlags, MouseState::Middle);
-		EZWIN32_CASE_APPEND_STR(result, stateFlags, MouseState::XButton1);
-		EZWIN32_CASE_APPEND_STR(result, stateFlags, MouseState::XButton2);
-		EZWIN32_CASE_APPEND_STR(result, stateFlags, MouseState::Shift);
-		EZWIN32_CASE_APPEND_STR(result, stateFlags, MouseState::Ctrl);
+	//!	@brief	Enables bitwise operators (|, &, ~).
+	EZWIN32_ENABLE_ENUM_FLAGS(RawMouseButton);
 
-		return result.empty() ? "MouseState::None" : result;
-	}
+	//!	@brief	Converts a `Flags<RawMouseButton>` to a readable string.
+	std::string to_string(Flags<RawMouseButton> buttonFlags);
 
 	/*****************************************************************************
 	*****************************    MouseAction    ******************************
@@ -702,16 +715,7 @@ namespace easywin32
 	};
 
 	//! @brief	Converts a `MouseAction` enum value to a string representation.
-	static inline const char * to_string(MouseAction action)
-	{
-		switch (action)
-		{
-			EZWIN32_CASE_TO_STR(MouseAction::Up);
-			EZWIN32_CASE_TO_STR(MouseAction::Down);
-			EZWIN32_CASE_TO_STR(MouseAction::DoubleClick);
-			default:	return "MouseAction::Unknown";
-		}
-	}
+	const char * to_string(MouseAction action);
 
 	/*****************************************************************************
 	******************************    KeyAction    *******************************
@@ -726,16 +730,7 @@ namespace easywin32
 	};
 
 	//!	@brief	Convert `KeyAction` enum to string for debugging or logging.
-	static inline const char * to_string(KeyAction action)
-	{
-		switch (action)
-		{
-			EZWIN32_CASE_TO_STR(KeyAction::Press);
-			EZWIN32_CASE_TO_STR(KeyAction::Repeat);
-			EZWIN32_CASE_TO_STR(KeyAction::Release);
-			default:	return "KeyAction::Unknown";
-		}
-	}
+	const char * to_string(KeyAction action);
 
 	/*****************************************************************************
 	********************************    Cursor    ********************************
@@ -761,27 +756,7 @@ namespace easywin32
 	};
 
 	//!	@brief	Convert `Cursor` enum to string for debugging or logging.
-	static inline const char* to_string(Cursor cursor)
-	{
-		switch (cursor)
-		{
-			EZWIN32_CASE_TO_STR(Cursor::None);
-			EZWIN32_CASE_TO_STR(Cursor::Wait);
-			EZWIN32_CASE_TO_STR(Cursor::Hand);
-			EZWIN32_CASE_TO_STR(Cursor::Help);
-			EZWIN32_CASE_TO_STR(Cursor::Arrow);
-			EZWIN32_CASE_TO_STR(Cursor::Cross);
-			EZWIN32_CASE_TO_STR(Cursor::IBeam);
-			EZWIN32_CASE_TO_STR(Cursor::SizeWE);
-			EZWIN32_CASE_TO_STR(Cursor::SizeNS);
-			EZWIN32_CASE_TO_STR(Cursor::SizeAll);
-			EZWIN32_CASE_TO_STR(Cursor::UpArrow);
-			EZWIN32_CASE_TO_STR(Cursor::SizeNWSE);
-			EZWIN32_CASE_TO_STR(Cursor::SizeNESW);
-			EZWIN32_CASE_TO_STR(Cursor::AppStarting);
-			default:	return "Cursor::Unknown";
-		}
-	}
+	const char * to_string(Cursor cursor);
 
 	/*****************************************************************************
 	****************************    HitTestResult    *****************************
@@ -815,35 +790,197 @@ namespace easywin32
 	};
 
 	//!	@brief	Convert `HitTestResult` enum to string for debugging or logging.
-	static inline const char* to_string(HitTestResult result)
-	{
-		switch (result)
-		{
-			EZWIN32_CASE_TO_STR(HitTestResult::Nowhere);
-			EZWIN32_CASE_TO_STR(HitTestResult::Client);
-			EZWIN32_CASE_TO_STR(HitTestResult::Caption);
-			EZWIN32_CASE_TO_STR(HitTestResult::SystemMenu);
-			EZWIN32_CASE_TO_STR(HitTestResult::GrowBox);
-			EZWIN32_CASE_TO_STR(HitTestResult::Menu);
-			EZWIN32_CASE_TO_STR(HitTestResult::HScroll);
-			EZWIN32_CASE_TO_STR(HitTestResult::VScroll);
-			EZWIN32_CASE_TO_STR(HitTestResult::MinButton);
-			EZWIN32_CASE_TO_STR(HitTestResult::MaxButton);
-			EZWIN32_CASE_TO_STR(HitTestResult::Left);
-			EZWIN32_CASE_TO_STR(HitTestResult::Right);
-			EZWIN32_CASE_TO_STR(HitTestResult::Top);
-			EZWIN32_CASE_TO_STR(HitTestResult::TopLeft);
-			EZWIN32_CASE_TO_STR(HitTestResult::TopRight);
-			EZWIN32_CASE_TO_STR(HitTestResult::Bottom);
-			EZWIN32_CASE_TO_STR(HitTestResult::BottomLeft);
-			EZWIN32_CASE_TO_STR(HitTestResult::BottomRight);
-			EZWIN32_CASE_TO_STR(HitTestResult::Border);
-			EZWIN32_CASE_TO_STR(HitTestResult::CloseButton);
-			EZWIN32_CASE_TO_STR(HitTestResult::HelpButton);
-			EZWIN32_CASE_TO_STR(HitTestResult::Default);
-			default:	return "HitTestResult::Unknown";
+	const char * to_string(HitTestResult result);
+
+	/*****************************************************************************
+	******************************    WaitResult    ******************************
+	*****************************************************************************/
+
+	//!	@brief	Source that ended a call to `waitEvents`.
+	enum class WaitSource
+	{
+		Message,		//!< Window messages arrived and have been processed.
+		Handle,			//!< One of the handles was signaled, see `WaitResult::index`.
+		Abandoned,		//!< One of the handles is a mutex abandoned by its owner, see `WaitResult::index`.
+		Timeout,		//!< The timeout elapsed without messages or signaled handles.
+		Failed,			//!< The wait failed (e.g. invalid handle), call `GetLastError` for details.
+	};
+
+
+	//!	@brief	Result of `waitEvents`.
+	struct WaitResult
+	{
+		WaitSource		source;		//!< What woke up the thread.
+		size_t			index;		//!< Index of the signaled handle, valid for `WaitSource::Handle` and `WaitSource::Abandoned`.
+	};
+
+	/*****************************************************************************
+	******************************    Visibility    ******************************
+	*****************************************************************************/
+
+	//!	@brief	Whether the content of a window can be seen, and if not, why (see `Window::getVisibility`).
+	enum class Visibility
+	{
+		Visible,			//!< On screen, at least partially.
+		Hidden,				//!< Not shown (`WS_VISIBLE` is not set), or closed.
+		Minimized,			//!< Minimized to the taskbar.
+		Cloaked,			//!< Hidden by DWM, e.g. on another virtual desktop.
+		SessionLocked,		//!< The session is locked, nothing is displayed.
+		Occluded,			//!< Fully covered, as reported by the presenter (`DXGI_STATUS_OCCLUDED`).
+	};
+
+	//!	@brief	Convert `Visibility` enum to string for debugging or logging.
+	const char * to_string(Visibility visibility);
+
+	/*****************************************************************************
+	********************************    Event    *********************************
+	*****************************************************************************/
+
+	/**
+	 *	@brief		Compact record of a window message dispatched to the callbacks.
+	 *	@details	Keeps the raw message parameters, so that it can be replayed exactly (see `Window::replay`),
+	 *				and decodes them on demand.
+	 */
+	struct Event
+	{
+		int64_t		time;		//!< QPC timestamp of the dispatch.
+		UINT		message;	//!< Message identifier (`WM_*`).
+		WPARAM		wParam;		//!< Raw message parameter.
+		LPARAM		lParam;		//!< Raw message parameter.
+
+		//!	@brief	Whether this is a key message (`WM_KEYDOWN`, `WM_KEYUP`, `WM_SYSKEYDOWN`, `WM_SYSKEYUP`).
+		bool isKey() const { return (message == WM_KEYDOWN) || (message == WM_KEYUP) || (message == WM_SYSKEYDOWN) || (message == WM_SYSKEYUP); }
+
+		//!	@brief	Whether this is a mouse message (`WM_MOUSEMOVE` to `WM_MOUSEHWHEEL`).
+		bool isMouse() const { return (message >= WM_MOUSEFIRST) && (message <= WM_MOUSELAST); }
+
+		//!	@brief	[Key messages] Virtual key.
+		Key key() const { return static_cast<Key>(wParam); }
+
+		//!	@brief	[Key messages] Press, repeat or release.
+		KeyAction keyAction() const
+		{
+			if ((message == WM_KEYUP) || (message == WM_SYSKEYUP))		return KeyAction::Release;
+
+			return (lParam & (1 << 30)) ? KeyAction::Repeat : KeyAction::Press;
 		}
-	}
+
+		//!	@brief	[Mouse messages] Cursor position, in client coordinates (screen coordinates for wheel messages).
+		Point mousePos() const { return Point{ static_cast<SHORT>(LOWORD(lParam)), static_cast<SHORT>(HIWORD(lParam)) }; }
+
+		//!	@brief	[Mouse messages] Button and modifier key state.
+		Flags<MouseState> mouseState() const { return static_cast<MouseState>(LOWORD(wParam) & 127); }
+
+		//!	@brief	[Mouse button messages] Button of the event.
+		MouseButton mouseButton() const
+		{
+			switch (message)
+			{
+				case WM_RBUTTONDOWN:	case WM_RBUTTONUP:	case WM_RBUTTONDBLCLK:		return MouseButton::Right;
+				case WM_MBUTTONDOWN:	case WM_MBUTTONUP:	case WM_MBUTTONDBLCLK:		return MouseButton::Middle;
+				case WM_XBUTTONDOWN:	case WM_XBUTTONUP:	case WM_XBUTTONDBLCLK:		return (HIWORD(wParam) == XBUTTON1) ? MouseButton::XButton1 : MouseButton::XButton2;
+				default:																return MouseButton::Left;
+			}
+		}
+
+		//!	@brief	[Mouse button messages] Up, down or double click.
+		MouseAction mouseAction() const
+		{
+			switch (message)
+			{
+				case WM_LBUTTONUP:			case WM_RBUTTONUP:			case WM_MBUTTONUP:			case WM_XBUTTONUP:			return MouseAction::Up;
+				case WM_LBUTTONDBLCLK:		case WM_RBUTTONDBLCLK:		case WM_MBUTTONDBLCLK:		case WM_XBUTTONDBLCLK:		return MouseAction::DoubleClick;
+				default:																										return MouseAction::Down;
+			}
+		}
+
+		//!	@brief	[Wheel messages] Scroll distance, in multiples of `WHEEL_DELTA`.
+		int wheelDelta() const { return static_cast<SHORT>(HIWORD(wParam)); }
+	};
+
+	/*****************************************************************************
+	******************************    InputState    ******************************
+	*****************************************************************************/
+
+	//!	@brief	Keyboard and mouse state at the last `InputQueue::poll`.
+	struct InputState
+	{
+		uint64_t			keyDown[4] = {};	//!< Bitset of the keys held down, indexed by virtual key.
+		Flags<MouseState>	mouseState;			//!< Mouse buttons and modifier keys held down.
+		Point				mousePos = {};		//!< Last cursor position, in client coordinates.
+
+		//!	@brief	Whether `key` is held down.
+		bool isKeyDown(Key key) const { return (keyDown[(static_cast<unsigned>(key) >> 6) & 3] >> (static_cast<unsigned>(key) & 63)) & 1; }
+	};
+
+	/*****************************************************************************
+	****************************    DispatchStats    *****************************
+	*****************************************************************************/
+
+	//!	@brief	Time spent in the callbacks of one message type (see `Window::getDispatchStats`), in seconds.
+	struct DispatchStats
+	{
+		UINT		message;		//!< Message identifier (`WM_*`), or `WM_USER` for all messages from `WM_USER` up.
+		uint64_t	count;			//!< Number of dispatches.
+		double		total;			//!< Total time.
+		double		p50;			//!< Median (upper bound of the histogram bucket, within 25%).
+		double		p99;			//!< 99th percentile (upper bound of the histogram bucket, within 25%).
+		double		max;			//!< Longest dispatch.
+	};
+
+	/*****************************************************************************
+	******************************    WindowDesc    ******************************
+	*****************************************************************************/
+
+	/**
+	 *	@brief		Everything needed to open a window, see `Window::open(const WindowDesc&)` and `WindowPool`.
+	 *	@details	DWM attributes left empty keep the system default.
+	 */
+	struct WindowDesc
+	{
+		string_type						title = TEXT("Easy-Win32");
+		int								width = 800;						//!< Client width.
+		int								height = 600;						//!< Client height.
+		Point							pos = { CW_USEDEFAULT, CW_USEDEFAULT };	//!< Client position in screen coordinates, or `CW_USEDEFAULT`.
+		Flags<Style>					styleFlags = Style::OverlappedWindow;	//!< Add `Style::Visible` to show the window once opened.
+		Flags<ExStyle>					exStyleFlags = 0;
+		std::optional<bool>				immersiveDarkMode;
+		std::optional<Backdrop>			backdrop;
+		std::optional<CornerStyle>		cornerStyle;
+		std::optional<ColorRGB>			captionColor;
+		std::optional<ColorRGB>			borderColor;
+		std::optional<ColorRGB>			textColor;
+	};
+
+	/*****************************************************************************
+	***********************    SharedFramebufferHeader    ************************
+	*****************************************************************************/
+
+	/**
+	 *	@brief		Layout of the start of the section created by `Window::shareFramebuffer`, followed by the pixels.
+	 *	@details	Only fixed-size fields, so that processes of any bitness agree on it. The viewer owns the extent,
+	 *				the producer owns `sequence`, a seqlock: odd while a frame is written, even once it is complete.
+	 *				Use `SharedFramebufferWriter` rather than accessing it directly.
+	 */
+	struct SharedFramebufferHeader
+	{
+		static constexpr uint32_t	Version = 1;
+		static constexpr uint32_t	PixelOffset = 4096;		//!< The pixels start on the second page, the DIB section offset must be DWORD aligned.
+
+		char						magic[4];		//!< "EZFB".
+		uint32_t					version;		//!< `Version`.
+		uint32_t					pixelOffset;	//!< Offset of the pixels from the start of the section (top-down BGRX, pitch = width * 4).
+		uint32_t					capacity;		//!< Size of the pixel area in bytes.
+		std::atomic<int32_t>		width;			//!< Width of the window framebuffer, set by the viewer.
+		std::atomic<int32_t>		height;			//!< Height of the window framebuffer, set by the viewer.
+		std::atomic<uint32_t>		sequence;		//!< Seqlock of the pixels, incremented before and after each frame by the producer.
+		std::atomic<int32_t>		frameWidth;		//!< Width the last complete frame was written with.
+		std::atomic<int32_t>		frameHeight;	//!< Height the last complete frame was written with.
+		std::atomic<uint32_t>		presented;		//!< `sequence` of the last frame presented by the viewer.
+	};
+
+	static_assert(std::atomic<uint32_t>::is_always_lock_free, "Shared atomics must be address-free");
+	static_assert(sizeof(SharedFramebufferHeader) == 40, "SharedFramebufferHeader must have the same layout in 32 and 64-bit processes");
 
 	/*****************************************************************************
 	****************************    ThreadWindows    *****************************
@@ -873,407 +1010,2154 @@ namespace easywin32
 		 * @return     `true` if a message was processed, `false` if no messages were pending.
 		 */
 		bool processEvents();
-	}
-}
 
-/*********************************************************************************
-********************************    Type alias    ********************************
-*********************************************************************************/
 
-using EzKey = easywin32::Key;
-using EzByte = easywin32::Byte;
-using EzSize = easywin32::Size;
-using EzRect = easywin32::Rect;
-using EzPoint = easywin32::Point;
-using EzStyle = easywin32::Style;
-using EzResult = easywin32::Result;
-using EzWindow = easywin32::Window;
-using EzCursor = easywin32::Cursor;
-using EzExStyle = easywin32::ExStyle;
-using EzBackdrop = easywin32::Backdrop;
-using EzColorRGB = easywin32::ColorRGB;
-using EzColorRGBA = easywin32::ColorRGBA;
-using EzKeyAction = easywin32::KeyAction;
-using EzMouseState = easywin32::MouseState;
-using EzMouseAction = easywin32::MouseAction;
-using EzMouseButton = easywin32::MouseButton;
-using EzCornerStyle = easywin32::CornerStyle;
-using EzHitTestResult = easywin32::HitTestResult;
-using EzMouseStateFlags = easywin32::Flags<easywin32::MouseState>;
-using EzNonClientRenderingPolicy = easywin32::NonClientRenderingPolicy;
-template<typename EnumType> using EzFlags = easywin32::Flags<EnumType>;
-namespace EzThreadWindows = easywin32::ThreadWindows;
+		/**
+		 * @brief      Sleeps until a message arrives, one of `handles` is signaled, or `timeout` elapses.
+		 * @details    Pending messages are processed first (returning `WaitSource::Message` without sleeping).
+		 *             Otherwise the thread sleeps in `MsgWaitForMultipleObjectsEx`, without polling, and
+		 *             processes the messages that woke it up, if any.
+		 * @param[in]  handles - Kernel handles to wait on (events, semaphores, processes, change notifications...).
+		 * @param[in]  count - Number of handles, at most `MAXIMUM_WAIT_OBJECTS - 1`.
+		 * @param[in]  timeout - Timeout in milliseconds, or `INFINITE`.
+		 * @note       If several handles are signaled, the lowest index is reported.
+		 */
+		WaitResult waitEvents(const HANDLE * handles, size_t count, DWORD timeout = INFINITE);
+
+
+		/**
+		 * @brief      Starts a layout transaction for the windows of the current thread.
+		 * @details    Until the matching `commitLayout`, `Window::setPos`, `setStyle`, `setExStyle` and `centerToScreen`
+		 *             only record the new geometry (style bits are still written at once). `commitLayout` then moves,
+		 *             resizes and re-frames all windows in a single `BeginDeferWindowPos`/`EndDeferWindowPos` batch,
+		 *             so the window manager and DWM recompute the layout once. Transactions can be nested.
+		 */
+		void beginLayout();
+
+
+		/**
+		 * @brief      Ends the transaction started by `beginLayout`, applying all recorded changes at once.
+		 * @details    Several changes of the same window are merged. Windows closed in the meantime are skipped.
+		 * @return     `false` if the batch could not be applied atomically (the changes are then applied one by one).
+		 */
+		bool commitLayout();
+
+
+		/**
+		 * @brief      Makes the windows opened afterwards by the current thread per-monitor DPI aware (v2).
+		 * @details    Their coordinates and client extents are then in physical pixels, so framebuffers and `drawBitmap`
+		 *             map one pixel to one physical pixel instead of being bitmap-stretched by DWM on scaled monitors.
+		 *             Moving such a window to a monitor with another DPI sends `WM_DPICHANGED` (see `Window::onDpiChanged`).
+		 *             Call it before opening the windows (an application manifest can set it for the whole process instead).
+		 * @return     `false` if per-monitor v2 awareness is not supported (before Windows 10 1703), windows then keep
+		 *             the awareness of the process and report the system DPI.
+		 */
+		bool enablePerMonitorDpiAwareness();
+	}
+}
 
 /*********************************************************************************
-**********************************    Window    **********************************
+*******************************    Framebuffer    ********************************
 *********************************************************************************/
 
 /**
- *	@brief		
+ *	@brief		Persistent 32-bit framebuffer backed by a GDI DIB section.
+ *	@details	The pixel memory is allocated once by `CreateDIBSection` and stays selected into a cached
+ *				memory DC, so callers render directly into `getPixels()` and presentation is a single `BitBlt`.
+ *				The buffer is only reallocated when `resize()` is called with a different extent.
+ *	@note		Rows are top-down and tightly packed (`getPitch() == width * 4`), which is always DWORD-aligned.
  */
-class easywin32::Window
+class easywin32::Framebuffer
 {
 
 public:
 
-	Window() = default;
-
-	Window(const Window&) = delete;
+	Framebuffer() = default;
 
-	void operator=(const Window&) = delete;
+	Framebuffer(const Framebuffer&) = delete;
 
-	Window(string_type title) { this->setTitle(title); }
+	void operator=(const Framebuffer&) = delete;
 
-	~Window() { this->close(); }
+	~Framebuffer() { this->release(); }
 
 public:
 
 	/**
-	 *	@brief		Opens a new window with the specified title, bounds and styles.
-	 *	@details	Creates a Win32 window using `CreateWindowEx`, applying the provided style flags and extended style flags.
-	 *				Adjusts the window's bounding rectangle to account for non-client areas (e.g., borders, title bar) based on the style flags.
-	 *				If the window is already open (m_hWnd is valid), this method does nothing. Stores the window handle and updates m_styleFlags and m_bounds.
-	 *	@param[in]	title - The title of the window.
-	 *	@param[in]	bounds - The rectangular area defining the window's position (left, top) and bounds (right, bottom) in screen coordinates.
-	 *	@param[in]	styleFlags - The combination of window styles (e.g., `Style::OverlappedWindow`). Defaults to `Style::OverlappedWindow`.
-	 *	@param[in]	exStyleFlags - The combination of extended window styles (e.g., ExStyle::Layered, ExStyle::TopMost). Defaults to 0 (no extended styles).
+	 *	@brief		Allocates the DIB section with the given extent.
+	 *	@details	Does nothing if the framebuffer already has the requested size. The previous contents are discarded.
+	 *	@return		`true` if the framebuffer is valid after the call.
 	 */
-	void open(string_type title, Rect bounds, Flags<Style> styleFlags = Style::OverlappedWindow, Flags<ExStyle> exStyleFlags = 0);
+	bool resize(int width, int height);
 
-	//!	@brief		Opens a new window with default title and specified bounds and styles.
-	void open(Rect bounds, Flags<Style> styleFlags = Style::OverlappedWindow, Flags<ExStyle> exStyleFlags = 0)
-	{
-	#ifdef UNICODE
-		this->open(L"Easy-Win32", bounds, styleFlags, exStyleFlags);
-	#else
-		this->open("Easy-Win32", bounds, styleFlags, exStyleFlags);
-	#endif
-	}
+
+	//!	@brief	Releases the DIB section and the cached memory DC.
+	void release();
 
 
 	/**
-	 *	@brief		Opens a new window with the specified title, size and styles.
-	 *	@details	Creates a Win32 window using `CreateWindowEx`, applying the provided style flags and extended style flags.
-	 *				The window is positioned at default screen coordinates (CW_USEDEFAULT) and sized according to the provided Size structure.
-	 *				Adjusts the window's bounding rectangle to account for non-client areas (e.g., borders, title bar) based on the style flags.
-	 *				If the window is already open (m_hWnd is valid), this method does nothing. Updates m_styleFlags and m_bounds accordingly.
-	 *	@param[in]	title - The title of the window.
-	 *	@param[in]	with - The with of the window in pixels.
-	 *	@param[in]	height - The height of the window in pixels.
-	 *	@param[in]	styleFlags - The combination of window styles (e.g., `Style::OverlappedWindow`). Defaults to `Style::OverlappedWindow`.
-	 *	@param[in]	exStyleFlags - The combination of extended window styles (e.g., `ExStyle::Layered`, `ExStyle::TopMost`). Defaults to 0 (no extended styles).
-	 *	@note		The window is created at default screen coordinates (CW_USEDEFAULT). Use setPos to specify a custom position.
+	 *	@brief		Places the pixels of the following DIB sections in a file mapping (e.g. shared with another process).
+	 *	@details	The current DIB section is released. `resize` then fails for extents larger than `capacity` bytes.
+	 *				The section is kept by `release`, and must outlive the framebuffer or be detached with a null handle.
+	 *	@param[in]	offset - Offset of the pixels in the section, a multiple of `sizeof(DWORD)`.
 	 */
-	void open(string_type title, int width, int height, Flags<Style> styleFlags = Style::OverlappedWindow, Flags<ExStyle> exStyleFlags = 0);
+	void setSection(HANDLE hSection, DWORD offset, size_t capacity);
 
-	//!	@brief		Opens a new window with default title and specified size and styles.
-	void open(int width, int height, Flags<Style> styleFlags = Style::OverlappedWindow, Flags<ExStyle> exStyleFlags = 0)
-	{
-	#ifdef UNICODE
-		this->open(L"Easy-Win32", width, height, styleFlags, exStyleFlags);
-	#else
-		this->open("Easy-Win32", width, height, styleFlags, exStyleFlags);
-	#endif
-	}
+
+	/**
+	 *	@brief		Copies a region of the framebuffer to the target device context.
+	 *	@param[in]	hdc - Destination device context (e.g. from `BeginPaint` or `GetDC`).
+	 *	@param[in]	dstX, dstY - Destination position of the framebuffer's top-left corner.
+	 */
+	void present(HDC hdc, int dstX = 0, int dstY = 0) const;
 
 
 	/**
-	 *	@brief		Closes and destroys the window.
-	 *	@details	Calls DestroyWindow to close the window and releases the associated window handle (m_hWnd).
-	 *				Sets m_hWnd to nullptr to indicate the window is no longer valid. Safe to call even if the window is already closed.
+	 *	@brief		Copies only the given regions of the framebuffer to the target device context.
+	 *	@param[in]	hdc - Destination device context (e.g. from `BeginPaint` or `GetDC`).
+	 *	@param[in]	rects - Dirty rectangles in framebuffer coordinates, clipped to the framebuffer bounds.
+	 *	@param[in]	count - Number of rectangles.
+	 *	@param[in]	dstX, dstY - Destination position of the framebuffer's top-left corner.
 	 */
-	void close() { ::DestroyWindow(m_hWnd);		m_hWnd = nullptr;	m_enableBlurBeind = false; }
+	void present(HDC hdc, const Rect * rects, size_t count, int dstX = 0, int dstY = 0) const;
 
 public:
 
-	//!	@brief	Gets style flags of the window.
-	Flags<Style> getStyleFlags() const;
+	//!	@brief	Whether the DIB section has been allocated.
+	bool isValid() const { return m_hBitmap != nullptr; }
 
-	//!	@brief	Returns the native handle of the win32 window.
-	HWND nativeHandle() { return m_hWnd; }
+	//!	@brief	Returns the width of the framebuffer in pixels.
+	int getWidth() const { return m_width; }
 
-	//!	@brief	Get the minimum window size allowed during resizing.
-	Size getMinTrackSize() const { return m_minTrackSize; }
+	//!	@brief	Returns the height of the framebuffer in pixels.
+	int getHeight() const { return m_height; }
 
-	//!	@brief	Get the maximum window size allowed during resizing.
-	Size getMaxTrackSize() const { return m_maxTrackSize; }
+	//!	@brief	Returns the extent of the framebuffer in pixels.
+	Size getExtent() const { return Size{ m_width, m_height }; }
 
-	//!	@brief	Whether the specified window handle identifies an existing window (opened).	
-	bool isOpen() const { return ::IsWindow(m_hWnd); }
+	//!	@brief	Returns the row pitch in bytes.
+	size_t getPitch() const { return static_cast<size_t>(m_width) * sizeof(ColorBGRA); }
 
-	//!	@brief	Whether the window is minimized.
-	bool isMinimized() const { return ::IsIconic(m_hWnd); }
+	//!	@brief	Returns the writable pixel pointer (top-down, row-major), `nullptr` if not allocated.
+	ColorBGRA * getPixels() { return m_pixels; }
+	const ColorBGRA * getPixels() const { return m_pixels; }
 
-	//!	@brief	Whether the window is maximized.
-	bool isMaximized() const { return ::IsZoomed(m_hWnd); }
+	//!	@brief	Returns the pointer to the first pixel of the given row.
+	ColorBGRA * getRow(int y) { return m_pixels + static_cast<size_t>(y) * m_width; }
+	const ColorBGRA * getRow(int y) const { return m_pixels + static_cast<size_t>(y) * m_width; }
 
-	//!	@brief	Whether the windows is focused.
-	bool isFocused() const { return ::GetFocus() == m_hWnd; }
+	//!	@brief	Returns the memory DC the DIB section is selected into.
+	HDC nativeDC() const { return m_hMemDC; }
 
-	//!	@brief	Checks if the window is currently marked as visible.
-	bool isVisible() const { return ::IsWindowVisible(m_hWnd) != FALSE; }
+	//!	@brief	Returns the native handle of the DIB section.
+	HBITMAP nativeHandle() const { return m_hBitmap; }
 
-	//!	@brief	Whether the windows is the foreground (active) window.
-	bool isForeground() const { return ::GetForegroundWindow() == m_hWnd; }
+private:
 
-	//!	@brief	Gets ex-style flags of the window.
-	Flags<ExStyle> getExStyleFlags() const { return (DWORD)::GetWindowLongPtr(m_hWnd, GWL_EXSTYLE); }
+	HDC				m_hMemDC = nullptr;
+	HBITMAP			m_hBitmap = nullptr;
+	HGDIOBJ			m_hDefaultBitmap = nullptr;
+	ColorBGRA *		m_pixels = nullptr;
+	int				m_width = 0;
+	int				m_height = 0;
+	HANDLE			m_hSection = nullptr;		// File mapping holding the pixels, owned by the caller of `setSection`
+	DWORD			m_sectionOffset = 0;
+	size_t			m_sectionCapacity = 0;
+};
 
-	//!	@brief	Retrieves the position of the client area (left-top corner).
-	Point getClientPos() const { Point pt = { 0, 0 };	::ClientToScreen(m_hWnd, &pt);		return pt; }
+/*********************************************************************************
+*************************    SharedFramebufferWriter    **************************
+*********************************************************************************/
 
-	//!	@brief	Gets the mouse position in client coordinates.
-	Point getMousePos() const { Point pt = {};		::GetCursorPos(&pt);	::ScreenToClient(m_hWnd, &pt);		return pt; }
+/**
+ *	@brief		Producer side of a framebuffer shared by `Window::shareFramebuffer`, usable from another process.
+ *	@details	Frames are written in place into the pixels presented by the viewer, so nothing is copied across the
+ *				process boundary. The extent is chosen by the viewer (its client area, clamped to the capacity of the
+ *				section) and read by `beginWrite`. A frame whose extent changed meanwhile is discarded by the viewer.
+ *	@note		Only one writer per shared framebuffer. The viewer never blocks on the writer: a frame presented while
+ *				it is being overwritten is presented again once complete. Call `waitPresented` before the next frame
+ *				to avoid this, at the cost of pacing the producer to the viewer.
+ */
+class easywin32::SharedFramebufferWriter
+{
 
-	//!	@brief	Returns the size of the client area (width and height) of the window in pixels.
-	Size getClientExtent() const { Rect rect = {};	::GetClientRect(m_hWnd, &rect);		return Size{ rect.right, rect.bottom }; }
+public:
+
+	SharedFramebufferWriter() = default;
+
+	SharedFramebufferWriter(const SharedFramebufferWriter&) = delete;
+
+	void operator=(const SharedFramebufferWriter&) = delete;
+
+	~SharedFramebufferWriter() { this->close(); }
 
 public:
 
-	//!	@brief	Bring the window to front and set input focus.
-	void setFocus() { ::SetFocus(m_hWnd); }
+	//!	@brief	Opens the framebuffer shared under `name`, returns `false` if no viewer shares it (yet).
+	bool open(const string_type & name);
 
-	//!	@brief	Rest style of the window.
-	void setStyle(Flags<Style> styleFlags);
+	//!	@brief	Unmaps the framebuffer. A frame not ended is not published.
+	void close();
 
-	//!	@brief	Rest ex-style of the window.
-	void setExStyle(Flags<ExStyle> styleFlags);
+	/**
+	 *	@brief		Starts a frame, at the extent presented by the viewer.
+	 *	@param[out]	width, height - Extent of the frame, the pitch is `width * 4` bytes.
+	 *	@return		The pixels to write (top-down), `nullptr` if not opened or if the viewer has no framebuffer.
+	 */
+	ColorBGRA * beginWrite(int & width, int & height);
 
-	//!	@brief	Hide the window.
-	void hide() { ::ShowWindow(m_hWnd, SW_HIDE); }
+	//!	@brief	Publishes the frame started by `beginWrite` and wakes up the viewer.
+	void endWrite();
 
-	//!	@brief	Bring the window to the top of the Z order.
-	void bringToTop() { ::BringWindowToTop(m_hWnd); }
+	//!	@brief	Waits until the viewer presents a frame, returns `false` on timeout.
+	bool waitPresented(DWORD timeout = INFINITE) const { return (m_hPresentedEvent != nullptr) && (::WaitForSingleObject(m_hPresentedEvent, timeout) == WAIT_OBJECT_0); }
 
-	//!	@brief	Show the window.
-	void show() { ::ShowWindow(m_hWnd, SW_SHOWNORMAL); }
+	//!	@brief	Whether a shared framebuffer is opened.
+	bool isOpen() const { return m_header != nullptr; }
 
-	//!	@brief	Displays or hides the cursor.
-	void showCursor(bool bShow) { ::ShowCursor(bShow); }
+	//!	@brief	Returns the header of the shared section, `nullptr` if not opened.
+	const SharedFramebufferHeader * getHeader() const { return m_header; }
 
-	//!	@brief	Set position of the window.
-	void setPos(int left, int top);
-	void setPos(int left, int top, int right, int bottom);
+private:
 
-	//!	@brief	Centers the window in the current monitor's work area.
-	void centerToScreen();
+	HANDLE							m_hSection = nullptr;
+	HANDLE							m_hFrameEvent = nullptr;		// Auto-reset, signaled by `endWrite`
+	HANDLE							m_hPresentedEvent = nullptr;	// Auto-reset, signaled by the viewer
+	SharedFramebufferHeader *		m_header = nullptr;				// View of the whole section
+	uint32_t						m_sequence = 0;					// Odd while writing
+	int								m_width = 0;
+	int								m_height = 0;
+};
 
-	//!	@brief	Foreground the window.
-	void setForeground() { ::SetForegroundWindow(m_hWnd); }
+/*********************************************************************************
+********************************    FrameQueue    ********************************
+*********************************************************************************/
 
-	//!	@brief	Destorys a timer.
-	void killTimer(UINT_PTR id) { ::KillTimer(m_hWnd, id); }
+/**
+ *	@brief		Lock-free single-producer / single-consumer frame queue (triple buffering).
+ *	@details	A render thread writes into the back frame (`beginWrite` / `endWrite`) while the UI thread
+ *				presents the front frame (`acquire`). Publishing and acquiring only swap slot indices with
+ *				one atomic exchange, so neither side ever waits for the other: the producer never blocks on
+ *				a slow or modal UI thread, and the consumer always gets the most recent completed frame
+ *				(older unpresented frames are simply overwritten).
+ */
+class easywin32::FrameQueue
+{
 
-	//!	@brief	Restore the winodw if it is minimized or maximized.
-	void restore() { ::ShowWindow(m_hWnd, SW_RESTORE); }
+public:
 
-	//!	@brief	Maximized the window.
-	void maximize() { ::ShowWindow(m_hWnd, SW_SHOWMAXIMIZED); }
+	//!	@brief	A frame slot, reallocated only when it grows.
+	struct Frame
+	{
+		std::vector<ColorBGRA>		pixels;			//!< Top-down, tightly packed pixels.
+		int							width = 0;		//!< Width in pixels.
+		int							height = 0;		//!< Height in pixels.
+		uint64_t					index = 0;		//!< Sequence number assigned by `endWrite` (1 = first frame).
+		int64_t						time = 0;		//!< QPC timestamp of the capture (see `FrameCapture`), 0 otherwise.
+
+		//!	@brief	Sets the extent of the frame, keeping the allocation when shrinking.
+		void resize(int w, int h)
+		{
+			size_t count = static_cast<size_t>(w > 0 ? w : 0) * static_cast<size_t>(h > 0 ? h : 0);
 
-	//!	@brief	Minimized the window.
-	void minimize() { ::ShowWindow(m_hWnd, SW_SHOWMINIMIZED); }
+			if (pixels.size() < count)		pixels.resize(count);
 
-	//!	@brief	Set the minimum size the window can be resized to.
-	void setMinTrackSize(Size minSize) { m_minTrackSize = minSize; }
+			width = w;		height = h;
+		}
 
-	//!	@brief	Set the maximum size the window can be resized to.
-	void setMaxTrackSize(Size maxSize) { m_maxTrackSize = maxSize; }
+		//!	@brief	Returns the row pitch in bytes.
+		size_t getPitch() const { return static_cast<size_t>(width) * sizeof(ColorBGRA); }
+	};
 
-	//!	@brief	Enables or disables mouse and keyboard input to the specified window.
-	void enableInput(bool bEnable) { ::EnableWindow(m_hWnd, bEnable); }
+public:
 
-	//!	@brief	Sets the window title text.	
-	void setTitle(string_type title) { ::SetWindowText(m_hWnd, title.c_str()); }
+	FrameQueue() = default;
 
-	//!	@brief	Sets the parent window
-	void setParent(Window & parent) { ::SetParent(m_hWnd, parent.nativeHandle()); }
+	FrameQueue(const FrameQueue&) = delete;
 
-	//!	@brief	Converts the screen coordinates to client coordinates.
-	Point screenToClient(Point pt) const { ::ScreenToClient(m_hWnd, &pt);	return pt; }
+	void operator=(const FrameQueue&) = delete;
 
-	//!	@brief	Converts the client coordinates to screen coordinates.
-	Point clientToScreen(Point pt) const { ::ClientToScreen(m_hWnd, &pt);	return pt; }
+public:
 
-	//!	@brief	Draws a raw RGB bitmap onto the window at the specified position.
-	void drawBitmap(const ColorRGB * pixels, int width, int height, int dstX = 0, int dstY = 0);
+	//!	@brief	[Producer] Returns the frame to render into, owned by the producer until `endWrite`.
+	Frame & beginWrite() { return m_frames[m_back]; }
 
-	//!	@brief	Creates a timer with the specified id and time-out value.
-	void setTimer(UINT_PTR id, unsigned int millisecond) { ::SetTimer(m_hWnd, id, millisecond, NULL); }
 
-	//!	@brief	Sets the window to stay on top of others.
-	void setAlwaysOnTop(bool enable) { ::SetWindowPos(m_hWnd, enable ? HWND_TOPMOST : HWND_NOTOPMOST, 0, 0, 0, 0, SWP_NOMOVE | SWP_NOSIZE); }
+	//!	@brief	[Producer] Publishes the frame returned by `beginWrite` as the latest one.
+	void endWrite()
+	{
+		m_frames[m_back].index = ++m_published;
+
+		unsigned int prev = m_latest.exchange(m_back | NewFrameBit, std::memory_order_acq_rel);
+
+		m_back = prev & IndexMask;
+	}
+
 
 	/**
-	 *	@brief		Simulates a non-client area mouse click (e.g., title bar or window border) at the current cursor position.
-	 *	@details	This function sends a WM_NCLBUTTONDOWN message to the window, making the system believe
-	 *				that the user has clicked on the specified non-client area. For example, passing HTCAPTION
-	 *				will cause the window to start moving as if the title bar was clicked.
+	 *	@brief		[Consumer] Returns the most recent completed frame.
+	 *	@details	If a new frame has been published since the last call, it becomes the front frame and the
+	 *				previous front frame is recycled for the producer. Otherwise the current front frame is returned again.
+	 *	@return		`nullptr` if no frame has been published yet.
 	 */
-	void triggerNonClientClick(HitTestResult result)
+	const Frame * acquire()
 	{
-		POINT pt = {};		::GetCursorPos(&pt);
-		
-		::SendMessage(m_hWnd, WM_NCLBUTTONDOWN, static_cast<WPARAM>(result), MAKELPARAM(pt.x, pt.y));
-	}
+		if (m_latest.load(std::memory_order_relaxed) & NewFrameBit)
+		{
+			unsigned int prev = m_latest.exchange(m_front, std::memory_order_acq_rel);
 
-	//!	@brief	Requests the window to be redrawn.
-	void requestRedraw(const Rect * rect = nullptr, bool eraseBackground = false)
-	{
-		::InvalidateRect(m_hWnd, rect, eraseBackground);
-		::UpdateWindow(m_hWnd);
-	}
+			m_front = prev & IndexMask;
+		}
 
-	//!	@brief	Specify the cursor shape, must be called from the main thread.
-	void setCursor(Cursor cursor)
-	{
-	#ifdef UNICODE
-		::SetCursor(::LoadCursor(NULL, (LPCWSTR)cursor));
-	#else
-		::SetCursor(::LoadCursor(NULL, (LPCSTR)cursor));
-	#endif
+		return (m_frames[m_front].index != 0) ? &m_frames[m_front] : nullptr;
 	}
 
-public:	// Layered window section
 
-	//!	@brief	Gets the window opacity.
-	Byte getOpacity() const { return m_opacity; }
+	//!	@brief	[Consumer] Whether a frame newer than the current front frame has been published.
+	bool hasNewFrame() const { return (m_latest.load(std::memory_order_acquire) & NewFrameBit) != 0; }
 
-	//!	@brief	Sets the window opacity (0-255, requires ExStyle::Layered).
-	void setOpacity(Byte opacity) { ::SetLayeredWindowAttributes(m_hWnd, 0, m_opacity = opacity, LWA_ALPHA); }
+private:
 
-	//!	@brief		Sets a color key for the layered window to enable per-pixel transparency (requires ExStyle::Layered).
-	//! @details	All pixels exactly matching the given color will be rendered as transparent, allowing content behind the window to show through.
-	void setColorKey(ColorRGB color) { ::SetLayeredWindowAttributes(m_hWnd, RGB(color.r, color.g, color.b), 0, LWA_COLORKEY); }
+	static constexpr unsigned int IndexMask = 0x3;
+	static constexpr unsigned int NewFrameBit = 0x4;
 
-public: // DWM section (get)
+	Frame							m_frames[3];
+	unsigned int					m_back = 0;					// Producer-owned
+	unsigned int					m_front = 1;				// Consumer-owned
+	uint64_t						m_published = 0;			// Producer-owned
+	std::atomic<unsigned int>		m_latest = { 2 };			// Latest completed slot | NewFrameBit
+};
 
-	//!	@brief	Get non-client rendering policy.
-	NonClientRenderingPolicy getNonClientRenderingPolicy() const { auto val = NonClientRenderingPolicy::UseWindowStyle;	::DwmGetWindowAttribute(m_hWnd, DWMWA_NCRENDERING_POLICY, &val, sizeof(val));	return val; }
+/*********************************************************************************
+********************************    Presenter    *********************************
+*********************************************************************************/
 
-	//!	@brief	Set color of caption/text/border (requires Windows11)
-	ColorRGB getCaptionColor() const { COLORREF val = RGB(0, 0, 0);	::DwmGetWindowAttribute(m_hWnd, DWMWA_CAPTION_COLOR, &val, sizeof(val));	return ColorRGB{ GetRValue(val), GetGValue(val), GetBValue(val) }; }
-	ColorRGB getBorderColor() const { COLORREF val = RGB(0, 0, 0);	::DwmGetWindowAttribute(m_hWnd, DWMWA_BORDER_COLOR, &val, sizeof(val));		return ColorRGB{ GetRValue(val), GetGValue(val), GetBValue(val) }; }
-	ColorRGB getTextColor() const { COLORREF val = RGB(0, 0, 0);	::DwmGetWindowAttribute(m_hWnd, DWMWA_TEXT_COLOR, &val, sizeof(val));		return ColorRGB{ GetRValue(val), GetGValue(val), GetBValue(val) }; }
-	
-	//!	@brief	Get the corner style of the window.
-	CornerStyle getCornerStyle() const { auto val = CornerStyle::Default;	::DwmGetWindowAttribute(m_hWnd, DWMWA_WINDOW_CORNER_PREFERENCE, &val, sizeof(val));  return val; }
+/**
+ *	@brief		Interface of an alternative presentation backend attached to a window (e.g. a DXGI swap chain).
+ *	@details	The window keeps a non-owning pointer to its presenter and forwards client-area changes to it,
+ *				so the backend's surfaces always follow the window without user code in `onResize`.
+ */
+class easywin32::Presenter
+{
 
-	//!	@brief	Get the backdrop of the window
-	Backdrop getBackdrop() const { auto val = Backdrop::Auto;	::DwmGetWindowAttribute(m_hWnd, DWMWA_SYSTEMBACKDROP_TYPE, &val, sizeof(val));	 return val; }
-	
-	//!	@brief	Checks if the dark mode is enabled.
-	bool immersiveDarkModeEnabled() const { BOOL val = FALSE;	::DwmGetWindowAttribute(m_hWnd, DWMWA_USE_IMMERSIVE_DARK_MODE, &val, sizeof(val));	 return val; }
+public:
 
-	//!	@brief	Checks if the DWM "blur-behind" effect is enabled.
-	bool blurBeindWindowEnabled() const { return m_enableBlurBeind; }
-	
-public: // DWM section (set)
+	virtual ~Presenter() = default;
 
-	//! @brief	Allows the window to either use the accent color, or dark, according to the user ColorRGB Mode preferences.
-	void enableImmersiveDarkMode(bool enable) { BOOL val = enable;	::DwmSetWindowAttribute(m_hWnd, DWMWA_USE_IMMERSIVE_DARK_MODE, &val, sizeof(val)); }
+	/**
+	 *	@brief		Called from `WM_SIZE` (before `onResize`) with the new client extent.
+	 *	@note		Not called while the window is minimized.
+	 */
+	virtual void resize(int width, int height) = 0;
 
-	//!	@brief	Set non-client rendering policy.
-	void setNonClientRenderingPolicy(NonClientRenderingPolicy policy) { ::DwmSetWindowAttribute(m_hWnd, DWMWA_NCRENDERING_POLICY, &policy, sizeof(policy)); }
-	
-	//!	@brief	Extends the window frame into the client area.
-	void extendFrameIntoClientArea(int left, int top, int right, int bottom) { MARGINS margins = { left, right, top, bottom };	::DwmExtendFrameIntoClientArea(m_hWnd, &margins); }
+	/**
+	 *	@brief		Called when the occlusion status of the window may have changed, returns whether its content is occluded.
+	 *	@note		Presenters that cannot tell (e.g. GDI) return `false`.
+	 */
+	virtual bool testOcclusion() { return false; }
+};
 
-	//!	@brief	Set color of caption/text/border (requires Windows11)
-	void setCaptionColor(ColorRGB color) { COLORREF val = RGB(color.r, color.g, color.b);	::DwmSetWindowAttribute(m_hWnd, DWMWA_CAPTION_COLOR, &val, sizeof(val)); }
-	void setBorderColor(ColorRGB color) { COLORREF val = RGB(color.r, color.g, color.b);	::DwmSetWindowAttribute(m_hWnd, DWMWA_BORDER_COLOR, &val, sizeof(val)); }
-	void setTextColor(ColorRGB color) { COLORREF val = RGB(color.r, color.g, color.b);		::DwmSetWindowAttribute(m_hWnd, DWMWA_TEXT_COLOR, &val, sizeof(val)); }
+/*********************************************************************************
+*******************************    FrameEncoder    *******************************
+*********************************************************************************/
 
-	//!	@brief	Set corner style of the window (requires Windows11)
-	void setCornerStyle(CornerStyle style) { ::DwmSetWindowAttribute(m_hWnd, DWMWA_WINDOW_CORNER_PREFERENCE, &style, sizeof(style)); }
+/**
+ *	@brief		Interface of the consumer of the frames captured by `FrameCapture` (e.g. a file or video writer).
+ *	@details	All methods are called from the encoder thread of the capture, never from the render thread.
+ */
+class easywin32::FrameEncoder
+{
 
-	//!	@brief	Controls the system-drawn backdrop material of a window, including behind the non-client area.
-	void setBackdrop(Backdrop backdrop){ ::DwmSetWindowAttribute(m_hWnd, DWMWA_SYSTEMBACKDROP_TYPE, &backdrop, sizeof(backdrop)); }
+public:
 
-	//!	@brief	Enables or disables the DWM "blur-behind" effect for the window (aka. alpha-composition).
-	void enableBlurBeindWindow(bool enable);
+	virtual ~FrameEncoder() = default;
+
+	//!	@brief	Called for each captured frame, in order. The frame is recycled once the call returns.
+	virtual void encode(const FrameQueue::Frame & frame) = 0;
+
+	//!	@brief	Called once the capture stops, after the last frame.
+	virtual void finish() {}
+};
+
+/*********************************************************************************
+*******************************    FrameCapture    *******************************
+*********************************************************************************/
+
+/**
+ *	@brief		Tap on the present path that copies frames into a ring of pooled buffers, consumed by a background encoder.
+ *	@details	`capture` (called by `Window::presentFramebuffer` once attached with `Window::setFrameCapture`) only copies
+ *				the pixels into the next free slot and wakes the encoder thread up: the render thread never waits for
+ *				the encoder. If the encoder falls behind and all slots are in flight, the frame is dropped and counted.
+ *				Slots are allocated on first use and only reallocated when the frame grows.
+ *	@note		`start`, `stop` and `capture` must be called from the same thread (typically the render thread).
+ */
+class easywin32::FrameCapture
+{
+
+public:
+
+	//!	@brief	Creates a capture keeping up to `capacity` frames in flight.
+	explicit FrameCapture(size_t capacity = 8) : m_frames(capacity > 0 ? capacity : 1) {}
+
+	FrameCapture(const FrameCapture&) = delete;
+
+	void operator=(const FrameCapture&) = delete;
+
+	~FrameCapture() { this->stop(); }
 
 public:
 
 	/**
-	 *	@brief		Waits for and processes the next window message.
-	 *	@details	This call will block until a new message is available in the queue for this window.
-	 *				It retrieves the message with `GetMessage`, translates it (e.g. converts virtual-key
-	 *				messages into character messages), and dispatches it to the window procedure.
+	 *	@brief		Starts the encoder thread, feeding `encoder` (which must outlive the capture session) until `stop`.
+	 *	@return		`false` if the capture is already running or `encoder` is `nullptr`.
 	 */
-	void waitEvent();
+	bool start(FrameEncoder * encoder);
+
+
+	//!	@brief	Lets the encoder process the frames still queued, calls `FrameEncoder::finish` and joins the thread.
+	void stop();
+
+
+	//!	@brief	Whether the encoder thread is running.
+	bool isRunning() const { return m_encoder != nullptr; }
 
 
 	/**
-	 *	@brief		Processes all pending window messages, if available.
-	 *	@details	Uses `PeekMessage` to check for all messages in the queue for this window.
-	 *				If a message exists, it is translated and dispatched to the window procedure.
-	 *	@return		`true` if a message was processed, `false` if no messages were pending.
+	 *	@brief		Queues a copy of a top-down 32-bit frame for the encoder.
+	 *	@param[in]	pitch - Row pitch in bytes (0 = tightly packed).
+	 *	@return		`false` if the capture is not running or the frame was dropped (all slots in flight).
 	 */
-	bool processEvents();
+	bool capture(const ColorBGRA * pixels, int width, int height, size_t pitch = 0);
 
-private:
 
-	//!	@brief	Adjusts the window rectangle based on the specified styles.
-	template<bool SkipCaption> static void adjustWindowRect(Rect & rect, DWORD dwStyle, DWORD dwExStyle);
+	//!	@brief	Queues a copy of the contents of `framebuffer`.
+	bool capture(const Framebuffer & framebuffer) { return this->capture(framebuffer.getPixels(), framebuffer.getWidth(), framebuffer.getHeight(), framebuffer.getPitch()); }
 
-	//!	@brief	Window procedure for message dispatching.
-	template<bool SkipCaption> static LRESULT procedure(HWND hWnd, UINT Msg, WPARAM wParam, LPARAM lParam);
+public:
 
-	//!	@brief	Create window (internal).
-	template<bool SkipCaption> void internalOpen(string_type title, DWORD dwStyle, DWORD dwExStyle, int x, int y, int w, int h);
+	//!	@brief	Returns the maximum number of frames in flight.
+	size_t capacity() const { return m_frames.size(); }
 
-	//!	@brief	Determines whether the window should skip the caption area based on style flags.
-	static bool shouldSkipCaption(Flags<Style> styleFlags) { return !styleFlags.has(Style::Caption) && styleFlags.has(Style::ThickFrame); }
+	//!	@brief	Returns the number of frames queued since `start`.
+	uint64_t getCapturedCount() const { return m_head.load(std::memory_order_relaxed); }
 
-	//!	@brief	Converts internal style flags to native Win32 style bits.
-	static DWORD toNativeStyle(Flags<Style> styleFlags);
+	//!	@brief	Returns the number of frames dropped since `start`, because the encoder was behind.
+	uint64_t getDroppedCount() const { return m_numDropped.load(std::memory_order_relaxed); }
 
-public:
+	//!	@brief	Returns the number of frames the encoder has processed since `start`.
+	uint64_t getEncodedCount() const { return m_tail.load(std::memory_order_relaxed); }
 
-	/**
-	 *	@brief		User-defined callback functions, called when triggered and defined by the user.
-	 *	@note		Each callback can optionally handle the event and determine whether it should be passed to the 
-	 *				system's default handler (`DefWindowProc`).
-	 *	@details	If the callback returns any value other than `-1`, that value will be returned directly as the 
-	 *				window procedure’s result — meaning the event is considered handled and `DefWindowProc` will **not** be called.
-	 *	@details	If the callback returns `-1`, the message will be forwarded to `DefWindowProc` for default processing.
-	 */
-	std::function<Result(HWND, UINT, WPARAM, LPARAM)>						forwardMessage;		// Called before default message handling.
-	std::function<Result(wchar_t)>											onInputCharacter;	// Called when a character input (WM_CHAR, WM_SYSCHAR, WM_UNICHAR) is received.
-	std::function<Result(const std::vector<string_type>&)>					onDropFiles;		// Called when files are dropped onto the window (WM_DROPFILES), requires ExStyle::AcceptFiles.
-	std::function<Result()>													onEnterMove;		// Called when the user starts moving or resizing the window(WM_ENTERSIZEMOVE).
-	std::function<Result()>													onExitMove;			// Called when the user finishes moving or resizing the window (WM_EXITSIZEMOVE).
-	std::function<Result()>													onPaint;			// Called when the window needs to be repainted (WM_PAINT).
-	std::function<Result(UINT_PTR id)>										onTimer;			// Called when a timer event occurs (WM_TIMER).
-	std::function<Result(bool focused)>										onFocus;			// Called when the window gains or lost focus (WM_SETFOCUS, WM_KILLFOCUS).
-	std::function<Result()>													onClose;			// Called when the window is about to close (WM_CLOSE).
-	std::function<Result()>													onMouseLeave;		// Called when the mouse leave the client area (WM_MOUSELEAVE).
-	std::function<Result(int x, int y)>										onMove;				// Called when the window is moved (WM_MOVE).
-	std::function<Result(int w, int h)>										onResize;			// Called when the window is resized (WM_SIZE).
-	std::function<Result(int x, int y, Flags<MouseState>)>					onMouseMove;		// Called when the mouse is moved (WM_MOUSEMOVE).
-	std::function<Result(int dx, int dy, Flags<MouseState>)>				onWheelScroll;		// Called when the mouse wheel is scrolled (WM_MOUSEWHEEL / WM_MOUSEHWHEEL).
-	std::function<Result(MouseButton, MouseAction, Flags<MouseState>)>		onMouseClick;		// Called when a mouse button event occurs (down, up, or double click).
-	std::function<Result(Key, KeyAction)>									onKeyboardPress;	// Called when a key is pressed, released, or repeated (WM_KEYDOWN/WM_KEYUP).
-	std::function<HitTestResult(int x, int y)>								onHitTest;			// Called when WM_NCHITTEST is received, should return the hit-test result based on cursor position.
+private:
+
+	//!	@brief	Loop of the encoder thread.
+	void threadMain();
 
 private:
 
-	HWND	m_hWnd = nullptr;
-	Size	m_minTrackSize = { 120, 31 };
-	Size	m_maxTrackSize = { LONG_MAX, LONG_MAX };
-	bool	m_enableBlurBeind = false;
-	bool	m_skipCaption = false;
-	Byte	m_opacity = 255;	// 0 = transparent, 255 = opaque
+	std::vector<FrameQueue::Frame>		m_frames;
+	std::atomic<uint64_t>				m_head = 0;				// Frames queued, written by the producer
+	std::atomic<uint64_t>				m_tail = 0;				// Frames encoded, written by the encoder thread
+	std::atomic<uint64_t>				m_numDropped = 0;
+	std::atomic<bool>					m_stopping = false;
+	FrameEncoder *						m_encoder = nullptr;
+	HANDLE								m_hWake = nullptr;		// Auto-reset, signaled for each queued frame and by `stop`
+	std::thread							m_thread;
 };
 
 /*********************************************************************************
-******************************    Implementation    ******************************
+******************************    RawFrameWriter    ******************************
 *********************************************************************************/
 
-#ifdef EZWIN32_IMPLEMENTATION
-
-#include <windowsx.h>
-
+/**
+ *	@brief		Frame encoder writing uncompressed frames to a file, with the cost of a copy per frame and no codec.
+ *	@details	The file starts with a header (`"EZFR"`, QPC frequency), then each frame is a record
+ *				(width, height, QPC timestamp, index) followed by its top-down, tightly packed BGRA pixels.
+ *				The file is created with the first frame.
+ */
+class easywin32::RawFrameWriter : public easywin32::FrameEncoder
+{
+
+public:
+
+	explicit RawFrameWriter(string_type path) : m_path(std::move(path)) {}
+
+	RawFrameWriter(const RawFrameWriter&) = delete;
+
+	void operator=(const RawFrameWriter&) = delete;
+
+	~RawFrameWriter() { this->finish(); }
+
+public:
+
+	void encode(const FrameQueue::Frame & frame) override;
+
+	void finish() override;
+
+	//!	@brief	Whether the file could not be created or a write failed (the following frames are then skipped).
+	bool failed() const { return m_failed; }
+
+private:
+
+	string_type		m_path;
+	HANDLE			m_hFile = INVALID_HANDLE_VALUE;
+	bool			m_failed = false;
+};
+
+/*********************************************************************************
+*****************************    DispatchProfiler    *****************************
+*********************************************************************************/
+
+#ifdef EZWIN32_ENABLE_PROFILER
+
+/**
+ *	@brief		Per-message-type histograms of the time spent in the window callbacks.
+ *	@details	Only compiled with `EZWIN32_ENABLE_PROFILER` (which must be defined identically for every
+ *				translation unit, as it changes the layout of `Window`). Durations are measured with QPC and
+ *				binned in a log-linear histogram (4 buckets per power of two), so recording is a few
+ *				instructions and quantiles are within 25%. Histograms are allocated on first use of a message type.
+ */
+class easywin32::DispatchProfiler
+{
+	static constexpr int NumBuckets = 248;		// 4 sub-buckets for each power of two up to 2^62 ticks
+
+	struct Histogram
+	{
+		uint64_t	count = 0;
+		int64_t		total = 0;
+		int64_t		max = 0;
+		uint32_t	buckets[NumBuckets] = {};
+	};
+
+public:
+
+	DispatchProfiler()
+	{
+		LARGE_INTEGER frequency = {};		::QueryPerformanceFrequency(&frequency);
+
+		m_frequency = frequency.QuadPart;
+	}
+
+	DispatchProfiler(const DispatchProfiler&) = delete;
+
+	void operator=(const DispatchProfiler&) = delete;
+
+public:
+
+	//!	@brief	Adds a dispatch of `message` that took `ticks` QPC ticks.
+	void record(UINT message, int64_t ticks)
+	{
+		auto & histogram = m_histograms[message < WM_USER ? message : WM_USER];
+
+		if (histogram == nullptr)
+		{
+			histogram = std::make_unique<Histogram>();
+		}
+
+		histogram->count++;
+
+		histogram->total += ticks;
+
+		histogram->max = (ticks > histogram->max) ? ticks : histogram->max;
+
+		histogram->buckets[DispatchProfiler::bucketIndex(ticks)]++;
+	}
+
+	//!	@brief	Returns the statistics of every message type dispatched at least once.
+	std::vector<DispatchStats> getStats() const;
+
+	//!	@brief	Clears all histograms.
+	void reset() { for (auto & histogram : m_histograms)	histogram.reset(); }
+
+private:
+
+	//!	@brief	Returns the histogram bucket of a duration.
+	static int bucketIndex(int64_t ticks)
+	{
+		if (ticks < 4)		return ticks > 0 ? static_cast<int>(ticks) : 0;
+
+		int exponent = 2;
+
+		while ((ticks >> (exponent + 1)) != 0)		exponent++;
+
+		return (exponent - 1) * 4 + static_cast<int>((ticks >> (exponent - 2)) & 3);
+	}
+
+	//!	@brief	Returns the largest duration of a histogram bucket, in ticks.
+	static int64_t bucketUpperBound(int index)
+	{
+		if (index < 4)		return index;
+
+		int exponent = index / 4 + 1;
+
+		return ((static_cast<int64_t>(4 + index % 4 + 1)) << (exponent - 2)) - 1;
+	}
+
+private:
+
+	int64_t							m_frequency = 0;
+	std::unique_ptr<Histogram>		m_histograms[WM_USER + 1];		// Indexed by message, registered and application messages share the last one
+};
+
+#endif
+
+/*********************************************************************************
+******************************    EventRecorder    *******************************
+*********************************************************************************/
+
+/**
+ *	@brief		Fixed-capacity ring buffer of the input messages dispatched by a window (see `Window::setRecorder`).
+ *	@details	Recording is a QPC read and a 32-byte store, without allocation: once full, the oldest events
+ *				are overwritten. Recordings can be saved to a compact binary file and replayed offline with
+ *				`Window::replay`, e.g. to benchmark callback throughput or to reproduce latency spikes.
+ */
+class easywin32::EventRecorder
+{
+
+public:
+
+	//!	@brief	Creates a recorder holding the last `capacity` events (rounded up to a power of two).
+	explicit EventRecorder(size_t capacity = 65536)
+	{
+		size_t size = 1;
+
+		while (size < capacity)		size <<= 1;
+
+		m_events.resize(size);
+
+		LARGE_INTEGER frequency = {};		::QueryPerformanceFrequency(&frequency);
+
+		m_frequency = frequency.QuadPart;
+	}
+
+public:
+
+	//!	@brief	Appends an event, timestamped now.
+	void record(UINT message, WPARAM wParam, LPARAM lParam)
+	{
+		LARGE_INTEGER counter = {};		::QueryPerformanceCounter(&counter);
+
+		m_events[static_cast<size_t>(m_numRecorded++) & (m_events.size() - 1)] = Event{ counter.QuadPart, message, wParam, lParam };
+	}
+
+	//!	@brief	Removes all events.
+	void clear() { m_numRecorded = 0; }
+
+	/**
+	 *	@brief		Whether a window records (and replays) `message`: input and window-state messages only.
+	 *	@details	Mouse, keyboard and character messages, `WM_MOUSELEAVE`, `WM_SETFOCUS`, `WM_KILLFOCUS` and `WM_MOVE`.
+	 *				Others are either noise (`WM_NCHITTEST`, `WM_SETCURSOR`, `WM_GETICON`...), carry handles only valid
+	 *				while processed (`WM_DROPFILES`, `WM_INPUT`), or act on the live window (`WM_PAINT`, `WM_SIZE`,
+	 *				`WM_DPICHANGED`, size-move loop, `WM_TIMER` driving the live-resize tick and `TimerScheduler` ticks).
+	 */
+	static bool isRecorded(UINT message)
+	{
+		return ((message >= WM_MOUSEFIRST) && (message <= WM_MOUSELAST)) || ((message >= WM_KEYFIRST) && (message <= WM_KEYLAST)) ||
+			   (message == WM_MOUSELEAVE) || (message == WM_SETFOCUS) || (message == WM_KILLFOCUS) || (message == WM_MOVE);
+	}
+
+	//!	@brief	Returns the number of events held (at most `capacity()`).
+	size_t size() const { return static_cast<size_t>(m_numRecorded < m_events.size() ? m_numRecorded : m_events.size()); }
+
+	//!	@brief	Returns the maximum number of events held.
+	size_t capacity() const { return m_events.size(); }
+
+	//!	@brief	Returns the number of events overwritten since the last `clear`.
+	uint64_t getDroppedCount() const { return m_numRecorded - this->size(); }
+
+	//!	@brief	Returns the QPC frequency of the timestamps, in ticks per second.
+	int64_t getFrequency() const { return m_frequency; }
+
+	//!	@brief	Returns the i-th event held, from the oldest (0) to the newest (`size() - 1`).
+	const Event & operator[](size_t i) const { return m_events[static_cast<size_t>(m_numRecorded - this->size() + i) & (m_events.size() - 1)]; }
+
+	//!	@brief	Copies the events held, from the oldest to the newest.
+	std::vector<Event> getEvents() const;
+
+	//!	@brief	Saves the events held to a binary file.
+	bool save(const string_type & path) const;
+
+	//!	@brief	Replaces the events held by the ones of a file written by `save`.
+	bool load(const string_type & path);
+
+private:
+
+	std::vector<Event>		m_events;
+	uint64_t				m_numRecorded = 0;
+	int64_t					m_frequency = 0;
+};
+
+/*********************************************************************************
+*******************************    InputQueue    *******************************
+*********************************************************************************/
+
+/**
+ *	@brief		Fixed-capacity queue of the key and mouse events of a window, drained once per frame (see `Window::setInputQueue`).
+ *	@details	The dispatcher appends compact `Event`s to a preallocated buffer and updates the key and mouse state,
+ *				without allocation nor callback. `poll` swaps the buffer with a second one, so that the events of
+ *				the last frame are read in place, as a contiguous span, while the next ones are being queued.
+ *	@note		Events that do not fit until the next `poll` are dropped (the state is still updated). The queue
+ *				is not thread safe: it must be polled from the thread of the window.
+ */
+class easywin32::InputQueue
+{
+
+public:
+
+	//!	@brief	Contiguous range of events, valid until the next `poll`.
+	struct Span
+	{
+		const Event *	data = nullptr;
+		size_t			size = 0;
+
+		const Event * begin() const { return data; }
+		const Event * end() const { return data + size; }
+		bool empty() const { return size == 0; }
+		const Event & operator[](size_t i) const { return data[i]; }
+	};
+
+	//!	@brief	Creates a queue holding up to `capacity` events per frame.
+	explicit InputQueue(size_t capacity = 1024)
+	{
+		m_queued.reserve(capacity > 0 ? capacity : 1);
+
+		m_polled.reserve(m_queued.capacity());
+	}
+
+public:
+
+	//!	@brief	Appends a key or mouse message, timestamped now, and updates the state. `WM_KILLFOCUS` releases all keys and buttons, other messages are ignored.
+	void push(UINT message, WPARAM wParam, LPARAM lParam);
+
+	//!	@brief	Returns the events queued since the last call, from the oldest to the newest, and snapshots the state.
+	Span poll()
+	{
+		m_polled.swap(m_queued);
+
+		m_queued.clear();
+
+		m_snapshot = m_state;
+
+		return Span{ m_polled.data(), m_polled.size() };
+	}
+
+	//!	@brief	Returns the key and mouse state at the last `poll`.
+	const InputState & getState() const { return m_snapshot; }
+
+	//!	@brief	Returns the maximum number of events queued between two polls.
+	size_t capacity() const { return m_queued.capacity(); }
+
+	//!	@brief	Returns the number of events dropped because the queue was full.
+	uint64_t getDroppedCount() const { return m_numDropped; }
+
+private:
+
+	std::vector<Event>		m_queued;		// Never grown past its reserved capacity
+	std::vector<Event>		m_polled;
+	InputState				m_state;
+	InputState				m_snapshot;
+	uint64_t				m_numDropped = 0;
+};
+
+/*********************************************************************************
+**********************************    Window    **********************************
+*********************************************************************************/
+
+/**
+ *	@brief		
+ */
+class easywin32::Window
+{
+
+public:
+
+	Window() = default;
+
+	Window(const Window&) = delete;
+
+	void operator=(const Window&) = delete;
+
+	Window(string_type title) { this->setTitle(title); }
+
+	~Window() { this->close(); }
+
+public:
+
+	/**
+	 *	@brief		Opens a new window with the specified title, bounds and styles.
+	 *	@details	Creates a Win32 window using `CreateWindowEx`, applying the provided style flags and extended style flags.
+	 *				Adjusts the window's bounding rectangle to account for non-client areas (e.g., borders, title bar) based on the style flags.
+	 *				If the window is already open (m_hWnd is valid), this method does nothing. Stores the window handle and updates m_styleFlags and m_bounds.
+	 *	@param[in]	title - The title of the window.
+	 *	@param[in]	bounds - The rectangular area defining the window's position (left, top) and bounds (right, bottom) in screen coordinates.
+	 *	@param[in]	styleFlags - The combination of window styles (e.g., `Style::OverlappedWindow`). Defaults to `Style::OverlappedWindow`.
+	 *	@param[in]	exStyleFlags - The combination of extended window styles (e.g., ExStyle::Layered, ExStyle::TopMost). Defaults to 0 (no extended styles).
+	 */
+	void open(string_type title, Rect bounds, Flags<Style> styleFlags = Style::OverlappedWindow, Flags<ExStyle> exStyleFlags = 0);
+
+	//!	@brief		Opens a new window with default title and specified bounds and styles.
+	void open(Rect bounds, Flags<Style> styleFlags = Style::OverlappedWindow, Flags<ExStyle> exStyleFlags = 0)
+	{
+	#ifdef UNICODE
+		this->open(L"Easy-Win32", bounds, styleFlags, exStyleFlags);
+	#else
+		this->open("Easy-Win32", bounds, styleFlags, exStyleFlags);
+	#endif
+	}
+
+
+	/**
+	 *	@brief		Opens a new window with the specified title, size and styles.
+	 *	@details	Creates a Win32 window using `CreateWindowEx`, applying the provided style flags and extended style flags.
+	 *				The window is positioned at default screen coordinates (CW_USEDEFAULT) and sized according to the provided Size structure.
+	 *				Adjusts the window's bounding rectangle to account for non-client areas (e.g., borders, title bar) based on the style flags.
+	 *				If the window is already open (m_hWnd is valid), this method does nothing. Updates m_styleFlags and m_bounds accordingly.
+	 *	@param[in]	title - The title of the window.
+	 *	@param[in]	with - The with of the window in pixels.
+	 *	@param[in]	height - The height of the window in pixels.
+	 *	@param[in]	styleFlags - The combination of window styles (e.g., `Style::OverlappedWindow`). Defaults to `Style::OverlappedWindow`.
+	 *	@param[in]	exStyleFlags - The combination of extended window styles (e.g., `ExStyle::Layered`, `ExStyle::TopMost`). Defaults to 0 (no extended styles).
+	 *	@note		The window is created at default screen coordinates (CW_USEDEFAULT). Use setPos to specify a custom position.
+	 */
+	void open(string_type title, int width, int height, Flags<Style> styleFlags = Style::OverlappedWindow, Flags<ExStyle> exStyleFlags = 0);
+
+	//!	@brief		Opens a new window with default title and specified size and styles.
+	void open(int width, int height, Flags<Style> styleFlags = Style::OverlappedWindow, Flags<ExStyle> exStyleFlags = 0)
+	{
+	#ifdef UNICODE
+		this->open(L"Easy-Win32", width, height, styleFlags, exStyleFlags);
+	#else
+		this->open("Easy-Win32", width, height, styleFlags, exStyleFlags);
+	#endif
+	}
+
+
+	/**
+	 *	@brief		Opens a new window described by `desc`, with all of its styles and DWM attributes applied before it is first shown.
+	 *	@details	The window is created hidden, its DWM attributes are set in a single pass, and it is then shown only
+	 *				if `desc.styleFlags` has `Style::Visible`. Setting them after a visible `open` instead makes DWM
+	 *				compose the first frames with the default frame, then recompose it once per attribute.
+	 *	@note		If the window is already open, this method does nothing.
+	 */
+	void open(const WindowDesc & desc);
+
+
+	/**
+	 *	@brief		Closes and destroys the window.
+	 *	@details	Calls DestroyWindow to close the window and releases the associated window handle (m_hWnd).
+	 *				Sets m_hWnd to nullptr to indicate the window is no longer valid. Safe to call even if the window is already closed.
+	 *	@note		When called from another thread than the one that opened the window (e.g. a `WindowThreadPool` thread),
+	 *				the call is forwarded to the owning thread and waits at most `CrossThreadCloseTimeout` milliseconds for it.
+	 *				If the owning thread does not answer in time (it is hung, or blocked waiting on the caller), `close` returns
+	 *				while the window is still open, and the owning thread closes it as soon as it processes its messages again.
+	 */
+	void close();
+
+
+	//!	@brief	Maximum time, in milliseconds, `close` waits for the owning thread when called from another thread.
+	static constexpr UINT CrossThreadCloseTimeout = 1000;
+
+	/**
+	 *	@brief		Sets whether destroying the window posts `WM_QUIT` to its thread (enabled by default).
+	 *	@details	Disable it when several windows share a thread, so that closing one of them does not end the message loop.
+	 */
+	void setQuitOnClose(bool enable) { m_quitOnClose = enable; }
+
+	//!	@brief	Returns whether destroying the window posts `WM_QUIT` to its thread.
+	bool getQuitOnClose() const { return m_quitOnClose; }
+
+public:
+
+	//!	@brief	Gets style flags of the window.
+	Flags<Style> getStyleFlags() const;
+
+	//!	@brief	Returns the native handle of the win32 window.
+	HWND nativeHandle() { return m_hWnd; }
+
+	//!	@brief	Get the minimum window size allowed during resizing.
+	Size getMinTrackSize() const { return m_minTrackSize; }
+
+	//!	@brief	Get the maximum window size allowed during resizing.
+	Size getMaxTrackSize() const { return m_maxTrackSize; }
+
+	//!	@brief	Returns the `Window` that opened `hWnd`, or `nullptr` if it is not a window of this library.
+	static Window * fromHandle(HWND hWnd);
+
+	//!	@brief	Whether the window is open (the handle is cleared on `WM_NCDESTROY`, however the window is destroyed).
+	bool isOpen() const { return m_hWnd != nullptr; }
+
+	//!	@brief	Whether the window is minimized (cached from `WM_SIZE`).
+	bool isMinimized() const { return (m_dwStyle & WS_MINIMIZE) != 0; }
+
+	//!	@brief	Whether the window is maximized (cached from `WM_SIZE`).
+	bool isMaximized() const { return (m_dwStyle & WS_MAXIMIZE) != 0; }
+
+	//!	@brief	Whether the windows is focused.
+	bool isFocused() const { return ::GetFocus() == m_hWnd; }
+
+	//!	@brief	Checks if the window is currently marked as visible (its own `WS_VISIBLE` bit, cached from `WM_WINDOWPOSCHANGED`).
+	bool isVisible() const { return (m_dwStyle & WS_VISIBLE) != 0; }
+
+	/**
+	 *	@brief		Returns whether the content of the window can be seen, and if not, why. Checked by `runFrameLoop` before each frame.
+	 *	@details	Tracked from `WM_SIZE` and `WM_WINDOWPOSCHANGED` (minimized, hidden), DWM cloaking events (cloaked),
+	 *				`WM_WTSSESSION_CHANGE` (session locked) and the presenter (occluded), see `onVisibilityChanged`.
+	 */
+	Visibility getVisibility() const
+	{
+		if (!this->isOpen() || !this->isVisible())		return Visibility::Hidden;
+		if (this->isMinimized())						return Visibility::Minimized;
+		if (m_cloaked)									return Visibility::Cloaked;
+		if (m_sessionLocked)							return Visibility::SessionLocked;
+		if (m_occluded)									return Visibility::Occluded;
+
+		return Visibility::Visible;
+	}
+
+	/**
+	 *	@brief		Reports whether the content is occluded (e.g. `Present` returned `DXGI_STATUS_OCCLUDED`), see `getVisibility`.
+	 *	@note		Called by `SwapChain`. Must be called from the thread of the window.
+	 */
+	void setOccluded(bool occluded);
+
+	//!	@brief	Returns the registered message posted by DXGI when the occlusion status changes (see `IDXGIFactory2::RegisterOcclusionStatusWindow`).
+	static UINT occlusionStatusMessage();
+
+	//!	@brief	Whether the windows is the foreground (active) window.
+	bool isForeground() const { return ::GetForegroundWindow() == m_hWnd; }
+
+	//!	@brief	Gets ex-style flags of the window, from the cache kept in sync by `WM_STYLECHANGED`.
+	Flags<ExStyle> getExStyleFlags() const { return m_dwExStyle; }
+
+	//!	@brief	Retrieves the position of the client area (left-top corner) in screen coordinates, cached from `WM_MOVE` unless `WS_CHILD` is set.
+	Point getClientPos() const { Point pt = m_clientPos;	if (m_dwStyle & WS_CHILD) { pt = { 0, 0 };	::ClientToScreen(m_hWnd, &pt); }	return pt; }
+
+	//!	@brief	Gets the mouse position in client coordinates.
+	Point getMousePos() const { Point pt = {};		::GetCursorPos(&pt);	::ScreenToClient(m_hWnd, &pt);		return pt; }
+
+	//!	@brief	Returns the size of the client area (width and height) of the window in pixels, cached from `WM_SIZE`.
+	Size getClientExtent() const { return m_clientExtent; }
+
+	//!	@brief	Returns the DPI of the window (96 unless per-monitor aware, see `ThreadWindows::enablePerMonitorDpiAwareness`).
+	UINT getDpi() const { return m_dpi; }
+
+	//!	@brief	Returns the scale factor of the window relative to 96 DPI (e.g. 1.5 at 144 DPI).
+	float getDpiScale() const { return static_cast<float>(m_dpi) / USER_DEFAULT_SCREEN_DPI; }
+
+public:
+
+	//!	@brief	Bring the window to front and set input focus.
+	void setFocus() { ::SetFocus(m_hWnd); }
+
+	//!	@brief	Rest style of the window.
+	void setStyle(Flags<Style> styleFlags);
+
+	//!	@brief	Rest ex-style of the window.
+	void setExStyle(Flags<ExStyle> styleFlags);
+
+	//!	@brief	Hide the window.
+	void hide() { ::ShowWindow(m_hWnd, SW_HIDE); }
+
+	//!	@brief	Bring the window to the top of the Z order.
+	void bringToTop() { ::BringWindowToTop(m_hWnd); }
+
+	//!	@brief	Show the window.
+	void show() { ::ShowWindow(m_hWnd, SW_SHOWNORMAL); }
+
+	//!	@brief	Displays or hides the cursor.
+	void showCursor(bool bShow) { ::ShowCursor(bShow); }
+
+	//!	@brief	Set position of the window.
+	void setPos(int left, int top);
+	void setPos(int left, int top, int right, int bottom);
+
+	//!	@brief	Centers the window in the current monitor's work area.
+	void centerToScreen();
+
+	//!	@brief	Foreground the window.
+	void setForeground() { ::SetForegroundWindow(m_hWnd); }
+
+	//!	@brief	Destorys a timer.
+	void killTimer(UINT_PTR id) { ::KillTimer(m_hWnd, id); }
+
+	//!	@brief	Restore the winodw if it is minimized or maximized.
+	void restore() { ::ShowWindow(m_hWnd, SW_RESTORE); }
+
+	//!	@brief	Maximized the window.
+	void maximize() { ::ShowWindow(m_hWnd, SW_SHOWMAXIMIZED); }
+
+	//!	@brief	Minimized the window.
+	void minimize() { ::ShowWindow(m_hWnd, SW_SHOWMINIMIZED); }
+
+	//!	@brief	Set the minimum size the window can be resized to.
+	void setMinTrackSize(Size minSize) { m_minTrackSize = minSize; }
+
+	//!	@brief	Set the maximum size the window can be resized to.
+	void setMaxTrackSize(Size maxSize) { m_maxTrackSize = maxSize; }
+
+	//!	@brief	Enables or disables mouse and keyboard input to the specified window.
+	void enableInput(bool bEnable) { ::EnableWindow(m_hWnd, bEnable); }
+
+	//!	@brief	Sets the window title text.	
+	void setTitle(string_type title) { ::SetWindowText(m_hWnd, title.c_str()); }
+
+	//!	@brief	Sets the parent window
+	void setParent(Window & parent) { ::SetParent(m_hWnd, parent.nativeHandle()); }
+
+	//!	@brief	Converts the screen coordinates to client coordinates.
+	Point screenToClient(Point pt) const { ::ScreenToClient(m_hWnd, &pt);	return pt; }
+
+	//!	@brief	Converts the client coordinates to screen coordinates.
+	Point clientToScreen(Point pt) const { ::ClientToScreen(m_hWnd, &pt);	return pt; }
+
+	//!	@brief	Draws a raw RGB bitmap onto the window at the specified position (converted to 32-bit BGRX internally).
+	void drawBitmap(const ColorRGB * pixels, int width, int height, int dstX = 0, int dstY = 0);
+
+	//!	@brief	Draws a raw 32-bit BGRX/BGRA bitmap with the given row pitch in bytes (0 = tightly packed), no conversion involved.
+	void drawBitmap(const ColorBGRA * pixels, int width, int height, size_t pitch, int dstX = 0, int dstY = 0);
+
+	//!	@brief	Draws a raw 32-bit RGBA bitmap with the given row pitch in bytes (0 = tightly packed), alpha is ignored.
+	void drawBitmap(const ColorRGBA * pixels, int width, int height, size_t pitch, int dstX = 0, int dstY = 0);
+
+	/**
+	 *	@brief		Enables or disables the persistent window framebuffer.
+	 *	@details	When enabled, a DIB section matching the client extent is allocated immediately and reallocated
+	 *				only when the window is resized (`WM_SIZE`), before `onResize` is called. Render into
+	 *				`getFramebuffer().getPixels()` and call `presentFramebuffer()` to show the frame.
+	 *				If `onPaint` is not set, `WM_PAINT` is also answered by blitting the framebuffer.
+	 */
+	void enableFramebuffer(bool enable);
+
+	//!	@brief	Whether the persistent window framebuffer is enabled.
+	bool framebufferEnabled() const { return m_enableFramebuffer; }
+
+	//!	@brief	Returns the window framebuffer (valid only if `enableFramebuffer(true)` was called).
+	Framebuffer & getFramebuffer() { return m_framebuffer; }
+	const Framebuffer & getFramebuffer() const { return m_framebuffer; }
+
+	//!	@brief	Blits the window framebuffer to the client area immediately (no `WM_PAINT` round trip needed).
+	void presentFramebuffer();
+
+	//!	@brief	Blits only the given dirty rectangles (client coordinates) of the window framebuffer.
+	void presentFramebuffer(const Rect * dirtyRects, size_t count);
+
+	/**
+	 *	@brief		Enables the framebuffer and moves its pixels into a named section that other processes can write to.
+	 *	@details	The section (`CreateFileMapping`) starts with a `SharedFramebufferHeader`, followed by room for
+	 *				`maxWidth * maxHeight` pixels. The framebuffer, a DIB section created on it, follows the client
+	 *				extent clamped to this maximum, so it is presented without any copy. Auto-reset events named
+	 *				`name + ".Frame"` and `name + ".Presented"` signal complete frames and presentations.
+	 *				Producers open it with `SharedFramebufferWriter`.
+	 *	@param[in]	name - Name of the section, e.g. `"Local\\MyViewer"`.
+	 *	@param[in]	security - Security of the section and events, e.g. to let a producer with lower privileges open them.
+	 *	@return		`false` if the window is closed, the name is already in use, or the section could not be created
+	 *				(nothing is left shared then). An empty client area (minimized window) is not a failure.
+	 */
+	bool shareFramebuffer(const string_type & name, int maxWidth, int maxHeight, const SECURITY_ATTRIBUTES * security = nullptr);
+
+	//!	@brief	Closes the shared section, the framebuffer (if still enabled) moves back to private memory.
+	void unshareFramebuffer();
+
+	//!	@brief	Whether the framebuffer is shared by `shareFramebuffer`.
+	bool framebufferShared() const { return m_shared.header != nullptr; }
+
+	//!	@brief	Returns the event signaled by the producer after each frame, e.g. to wait for it with `waitEvents`.
+	HANDLE getSharedFrameEvent() const { return m_shared.hFrameEvent; }
+
+	/**
+	 *	@brief		Presents the last frame written into the shared framebuffer, if it is complete and not presented yet.
+	 *	@details	Frames being written, or written for a previous extent, are skipped. If the producer started a new
+	 *				frame during the blit, the torn result stays on screen until that frame is complete and presented.
+	 *				`WM_PAINT` only blits the frame last presented, and skips the update while another one is pending.
+	 *	@note		An attached `FrameCapture` copies the pixels during the blit, so it records the same torn frame in
+	 *				that case: producers that must never be captured torn wait for `waitPresented` between frames.
+	 *	@return		`true` if a complete frame was presented (the producer is then notified).
+	 */
+	bool presentSharedFrame();
+
+	//!	@brief	Attaches a presenter that is resized together with the client area (`nullptr` to detach).
+	void setPresenter(Presenter * presenter) { m_presenter = presenter; }
+
+	//!	@brief	Returns the attached presenter, `nullptr` if none.
+	Presenter * getPresenter() const { return m_presenter; }
+
+	//!	@brief	Attaches a capture that receives a copy of each frame shown by `presentFramebuffer` (`nullptr` to detach).
+	void setFrameCapture(FrameCapture * capture) { m_frameCapture = capture; }
+
+	//!	@brief	Returns the attached frame capture, `nullptr` if none.
+	FrameCapture * getFrameCapture() const { return m_frameCapture; }
+
+	/**
+	 *	@brief		Keeps rendering while the user drags the border or the caption (the modal size/move loop of Win32).
+	 *	@details	Between `WM_ENTERSIZEMOVE` and `WM_EXITSIZEMOVE`, our own loop does not run. A window timer of
+	 *				`intervalMs` then ticks inside the modal loop, running one frame of the active `runFrameLoop`,
+	 *				or calling `onLiveResizeTick` if there is none. The framebuffer and the presenter keep their
+	 *				extent during the drag and are reallocated once, when the size settles (`WM_EXITSIZEMOVE`),
+	 *				instead of on every intermediate `WM_SIZE`. `onResize` is still called for every `WM_SIZE`.
+	 */
+	void enableLiveResize(bool enable, unsigned int intervalMs = 16) { m_enableLiveResize = enable;		m_liveResizeInterval = intervalMs; }
+
+	//!	@brief	Whether live resize is enabled.
+	bool liveResizeEnabled() const { return m_enableLiveResize; }
+
+	//!	@brief	Creates a timer with the specified id and time-out value.
+	void setTimer(UINT_PTR id, unsigned int millisecond) { ::SetTimer(m_hWnd, id, millisecond, NULL); }
+
+	/**
+	 *	@brief		Starts (or restarts) a high-resolution periodic timer, whose ticks call `onPreciseTimer` on the window thread.
+	 *	@details	`setTimer` relies on `WM_TIMER`, limited to the system tick (~15.6 ms) and synthesized only when the queue
+	 *				is otherwise empty. Precise timers are kept in a min-heap by a shared scheduler thread sleeping on a
+	 *				high-resolution waitable timer, and each tick is delivered through `post`. Deadlines are advanced by
+	 *				whole intervals from the first one, so they do not drift; a tick is skipped instead of queued while the
+	 *				previous tick of the same timer has not run yet. Ids are independent from the ones of `setTimer`.
+	 *	@param[in]	interval - Period in seconds (e.g. `1.0 / 120`).
+	 *	@return		`false` if the window is not open or `interval` is not positive.
+	 */
+	bool setPreciseTimer(UINT_PTR id, double interval);
+
+	//!	@brief	Stops a timer started by `setPreciseTimer`, a tick already posted is not delivered.
+	void killPreciseTimer(UINT_PTR id);
+
+	//!	@brief	Sets the window to stay on top of others.
+	void setAlwaysOnTop(bool enable) { ::SetWindowPos(m_hWnd, enable ? HWND_TOPMOST : HWND_NOTOPMOST, 0, 0, 0, 0, SWP_NOMOVE | SWP_NOSIZE); }
+
+	/**
+	 *	@brief		Simulates a non-client area mouse click (e.g., title bar or window border) at the current cursor position.
+	 *	@details	This function sends a WM_NCLBUTTONDOWN message to the window, making the system believe
+	 *				that the user has clicked on the specified non-client area. For example, passing HTCAPTION
+	 *				will cause the window to start moving as if the title bar was clicked.
+	 */
+	void triggerNonClientClick(HitTestResult result)
+	{
+		POINT pt = {};		::GetCursorPos(&pt);
+		
+		::SendMessage(m_hWnd, WM_NCLBUTTONDOWN, static_cast<WPARAM>(result), MAKELPARAM(pt.x, pt.y));
+	}
+
+	//!	@brief	Requests the window to be redrawn.
+	void requestRedraw(const Rect * rect = nullptr, bool eraseBackground = false)
+	{
+		::InvalidateRect(m_hWnd, rect, eraseBackground);
+		::UpdateWindow(m_hWnd);
+	}
+
+	/**
+	 *	@brief		Marks the client area as dirty without waiting for it to be repainted.
+	 *	@details	Unlike `requestRedraw`, this does not call `UpdateWindow`, so it may be called from any
+	 *				thread (e.g. a render thread after `FrameQueue::endWrite`) and never blocks the caller.
+	 *				The window thread receives `WM_PAINT` once its queue is empty, including inside the
+	 *				modal move/resize loop.
+	 */
+	void requestRedrawAsync(const Rect * rect = nullptr) { ::InvalidateRect(m_hWnd, rect, FALSE); }
+
+	/**
+	 *	@brief		Posts a task to be run on the thread that owns the window. Can be called from any thread.
+	 *	@details	Tasks are pushed to a lock-free multi-producer queue, and only the first task of a batch posts a
+	 *				wake-up message: the window procedure then runs the whole batch in FIFO order. High-rate
+	 *				producers therefore never flood the Win32 message queue (limited to 10000 messages per thread).
+	 *	@return		`false` if the window is not open (the task is discarded), or if the wake-up message could not be
+	 *				posted (the task stays queued, and runs with the next batch that wakes the window up).
+	 *	@note		Tasks still queued when the window is closed are discarded without being run, including the rest
+	 *				of the current batch when one of its tasks closes the window.
+	 */
+	bool post(Callback<void()> task);
+
+	/**
+	 *	@brief		Attaches a recorder that logs the input and window-state messages of the window (non-owning, `nullptr` to detach).
+	 *	@note		Only messages accepted by `EventRecorder::isRecorded` are recorded, those that `replay` can feed back.
+	 *				The recorder must outlive the attachment.
+	 */
+	void setRecorder(EventRecorder * recorder) { m_recorder = recorder; }
+
+	//!	@brief	Returns the attached recorder, if any.
+	EventRecorder * getRecorder() { return m_recorder; }
+
+	/**
+	 *	@brief		Attaches a queue receiving the key and mouse events, for polling (non-owning, `nullptr` to detach).
+	 *	@details	Callbacks are still invoked. Held keys and buttons are released when the window loses focus,
+	 *				since their release is then sent to another window. The queue must outlive the attachment.
+	 */
+	void setInputQueue(InputQueue * queue) { m_inputQueue = queue; }
+
+	//!	@brief	Returns the attached input queue, if any.
+	InputQueue * getInputQueue() { return m_inputQueue; }
+
+	/**
+	 *	@brief		Feeds recorded events back through the callbacks, as fast as possible.
+	 *	@details	Events are dispatched directly (without going through the message queue or `DefWindowProc`),
+	 *				and are not recorded again. Events that `EventRecorder::isRecorded` rejects are skipped, such as
+	 *				`WM_PAINT`, `WM_SIZE` or `WM_TIMER`, which act on the live window rather than on callbacks only.
+	 *				`onMouseMoveHistory` receives the recorded point alone, not the live `GetMouseMovePointsEx` history.
+	 *	@return		The number of events dispatched.
+	 */
+	size_t replay(const Event * events, size_t count);
+
+	//!	@brief	Feeds the events held by `recorder` back through the callbacks, from the oldest to the newest.
+	size_t replay(const EventRecorder & recorder);
+
+#ifdef EZWIN32_ENABLE_PROFILER
+
+	/**
+	 *	@brief		Returns the time spent in the callbacks of each message type dispatched since the last reset.
+	 *	@note		Only available with `EZWIN32_ENABLE_PROFILER`. With `EZWIN32_ENABLE_TRACELOGGING`, every dispatch is
+	 *				also reported as a `Dispatch` event of the `EasyWin32` TraceLogging provider, to be correlated with
+	 *				DWM composition in Windows Performance Analyzer.
+	 */
+	std::vector<DispatchStats> getDispatchStats() const { return m_profiler.getStats(); }
+
+	//!	@brief	Clears the statistics returned by `getDispatchStats`.
+	void resetDispatchStats() { m_profiler.reset(); }
+
+#endif
+
+	/**
+	 *	@brief		Registers this window for raw input (`WM_INPUT`), delivered to `onRawMouse` / `onRawKeyboard`.
+	 *	@details	Raw mouse motion is reported in unaccelerated device counts, once per device report (up to the
+	 *				polling rate of the mouse), unlike `WM_MOUSEMOVE` which is coalesced and clamped to pixels.
+	 *				Legacy messages (`WM_MOUSEMOVE`, `WM_KEYDOWN`...) are still generated.
+	 *	@param[in]	mouse - Whether to receive raw mouse input.
+	 *	@param[in]	keyboard - Whether to receive raw keyboard input.
+	 *	@note		Raw input registration is per process and device class: the last registered window receives it,
+	 *				and only while the application is in the foreground. Disabling it gives it back to the window
+	 *				registered before, it is only removed for the process once no window is registered.
+	 */
+	bool enableRawInput(bool mouse, bool keyboard);
+
+	//!	@brief	Whether raw mouse input is registered for this window.
+	bool rawMouseEnabled() const { return m_enableRawMouse; }
+
+	//!	@brief	Whether raw keyboard input is registered for this window.
+	bool rawKeyboardEnabled() const { return m_enableRawKeyboard; }
+
+	/**
+	 *	@brief		Dispatches all buffered raw input packets with `GetRawInputBuffer`, in batches.
+	 *	@details	Called automatically on `WM_INPUT`, so that a burst of packets from a high-rate device is handled
+	 *				by one message instead of one message per packet. Can also be called directly (e.g. once per frame).
+	 *	@return		The number of packets dispatched.
+	 */
+	size_t processRawInput();
+
+	/**
+	 *	@brief		Requests a list of dirty rectangles to be redrawn with a single `WM_PAINT`.
+	 *	@details	The rectangles are accumulated into the update region; `drawBitmap` and the framebuffer
+	 *				paint path then only copy the pixels inside that region.
+	 */
+	void requestRedraw(const Rect * rects, size_t count, bool eraseBackground = false)
+	{
+		for (size_t i = 0; i < count; i++)
+		{
+			::InvalidateRect(m_hWnd, &rects[i], eraseBackground);
+		}
+
+		::UpdateWindow(m_hWnd);
+	}
+
+	//!	@brief	Specify the cursor shape, must be called from the main thread.
+	void setCursor(Cursor cursor)
+	{
+	#ifdef UNICODE
+		::SetCursor(::LoadCursor(NULL, (LPCWSTR)cursor));
+	#else
+		::SetCursor(::LoadCursor(NULL, (LPCSTR)cursor));
+	#endif
+	}
+
+public:	// Layered window section
+
+	//!	@brief	Gets the window opacity.
+	Byte getOpacity() const { return m_opacity; }
+
+	//!	@brief	Sets the window opacity (0-255, requires ExStyle::Layered), also applied on top of the per-pixel alpha of `presentLayered`.
+	void setOpacity(Byte opacity);
+
+	//!	@brief		Sets a color key for the layered window to enable per-pixel transparency (requires ExStyle::Layered).
+	//! @details	All pixels exactly matching the given color will be rendered as transparent, allowing content behind the window to show through.
+	void setColorKey(ColorRGB color) { m_layeredContent = false;	::SetLayeredWindowAttributes(m_hWnd, RGB(color.r, color.g, color.b), 0, LWA_COLORKEY); }
+
+	/**
+	 *	@brief		Sets the content of the layered window to the given straight-alpha pixels (requires ExStyle::Layered).
+	 *	@details	The pixels are premultiplied into a persistent DIB section, then handed to DWM with
+	 *				`UpdateLayeredWindowIndirect`, which replaces the whole window (including the frame, so it is meant
+	 *				for popup windows) and resizes it to `width` x `height`. There is no `WM_PAINT` round trip and only
+	 *				the dirty area is converted and recomposed.
+	 *	@param[in]	pixels - Top-down pixels with straight (non-premultiplied) alpha.
+	 *	@param[in]	width, height - Extent of the image, which becomes the extent of the window.
+	 *	@param[in]	pitch - Row pitch in bytes, `0` for tightly packed rows.
+	 *	@param[in]	dirtyRects - Changed regions in image coordinates, `nullptr` for the whole image. Ignored (whole image)
+	 *				when the extent changes or on the first call.
+	 *	@param[in]	count - Number of dirty rectangles.
+	 *	@return		`false` if the window is not layered or the update failed.
+	 *	@note		Once called, `setOpacity` applies the opacity to this content instead of using `SetLayeredWindowAttributes`.
+	 */
+	bool presentLayered(const ColorRGBA * pixels, int width, int height, size_t pitch = 0, const Rect * dirtyRects = nullptr, size_t count = 0);
+
+public: // DWM section (get)
+
+	//!	@brief	Get non-client rendering policy.
+	NonClientRenderingPolicy getNonClientRenderingPolicy() const { auto val = NonClientRenderingPolicy::UseWindowStyle;	::DwmGetWindowAttribute(m_hWnd, DWMWA_NCRENDERING_POLICY, &val, sizeof(val));	return val; }
+
+	//!	@brief	Set color of caption/text/border (requires Windows11)
+	ColorRGB getCaptionColor() const { COLORREF val = RGB(0, 0, 0);	::DwmGetWindowAttribute(m_hWnd, DWMWA_CAPTION_COLOR, &val, sizeof(val));	return ColorRGB{ GetRValue(val), GetGValue(val), GetBValue(val) }; }
+	ColorRGB getBorderColor() const { COLORREF val = RGB(0, 0, 0);	::DwmGetWindowAttribute(m_hWnd, DWMWA_BORDER_COLOR, &val, sizeof(val));		return ColorRGB{ GetRValue(val), GetGValue(val), GetBValue(val) }; }
+	ColorRGB getTextColor() const { COLORREF val = RGB(0, 0, 0);	::DwmGetWindowAttribute(m_hWnd, DWMWA_TEXT_COLOR, &val, sizeof(val));		return ColorRGB{ GetRValue(val), GetGValue(val), GetBValue(val) }; }
+	
+	//!	@brief	Get the corner style of the window.
+	CornerStyle getCornerStyle() const { auto val = CornerStyle::Default;	::DwmGetWindowAttribute(m_hWnd, DWMWA_WINDOW_CORNER_PREFERENCE, &val, sizeof(val));  return val; }
+
+	//!	@brief	Get the backdrop of the window
+	Backdrop getBackdrop() const { auto val = Backdrop::Auto;	::DwmGetWindowAttribute(m_hWnd, DWMWA_SYSTEMBACKDROP_TYPE, &val, sizeof(val));	 return val; }
+	
+	//!	@brief	Checks if the dark mode is enabled.
+	bool immersiveDarkModeEnabled() const { BOOL val = FALSE;	::DwmGetWindowAttribute(m_hWnd, DWMWA_USE_IMMERSIVE_DARK_MODE, &val, sizeof(val));	 return val; }
+
+	//!	@brief	Checks if the DWM "blur-behind" effect is enabled.
+	bool blurBeindWindowEnabled() const { return m_enableBlurBeind; }
+	
+public: // DWM section (set)
+
+	//! @brief	Allows the window to either use the accent color, or dark, according to the user ColorRGB Mode preferences.
+	void enableImmersiveDarkMode(bool enable) { BOOL val = enable;	::DwmSetWindowAttribute(m_hWnd, DWMWA_USE_IMMERSIVE_DARK_MODE, &val, sizeof(val)); }
+
+	//!	@brief	Set non-client rendering policy.
+	void setNonClientRenderingPolicy(NonClientRenderingPolicy policy) { ::DwmSetWindowAttribute(m_hWnd, DWMWA_NCRENDERING_POLICY, &policy, sizeof(policy)); }
+	
+	//!	@brief	Extends the window frame into the client area.
+	void extendFrameIntoClientArea(int left, int top, int right, int bottom) { MARGINS margins = { left, right, top, bottom };	::DwmExtendFrameIntoClientArea(m_hWnd, &margins); }
+
+	//!	@brief	Set color of caption/text/border (requires Windows11)
+	void setCaptionColor(ColorRGB color) { COLORREF val = RGB(color.r, color.g, color.b);	::DwmSetWindowAttribute(m_hWnd, DWMWA_CAPTION_COLOR, &val, sizeof(val)); }
+	void setBorderColor(ColorRGB color) { COLORREF val = RGB(color.r, color.g, color.b);	::DwmSetWindowAttribute(m_hWnd, DWMWA_BORDER_COLOR, &val, sizeof(val)); }
+	void setTextColor(ColorRGB color) { COLORREF val = RGB(color.r, color.g, color.b);		::DwmSetWindowAttribute(m_hWnd, DWMWA_TEXT_COLOR, &val, sizeof(val)); }
+
+	//!	@brief	Set corner style of the window (requires Windows11)
+	void setCornerStyle(CornerStyle style) { ::DwmSetWindowAttribute(m_hWnd, DWMWA_WINDOW_CORNER_PREFERENCE, &style, sizeof(style)); }
+
+	//!	@brief	Controls the system-drawn backdrop material of a window, including behind the non-client area.
+	void setBackdrop(Backdrop backdrop){ ::DwmSetWindowAttribute(m_hWnd, DWMWA_SYSTEMBACKDROP_TYPE, &backdrop, sizeof(backdrop)); }
+
+	//!	@brief	Enables or disables the DWM "blur-behind" effect for the window (aka. alpha-composition).
+	void enableBlurBeindWindow(bool enable);
+
+public:
+
+	/**
+	 *	@brief		Waits for and processes the next window message.
+	 *	@details	This call will block until a new message is available in the queue for this window.
+	 *				It retrieves the message with `GetMessage`, translates it (e.g. converts virtual-key
+	 *				messages into character messages), and dispatches it to the window procedure.
+	 */
+	void waitEvent();
+
+
+	/**
+	 *	@brief		Processes all pending window messages, if available.
+	 *	@details	Uses `PeekMessage` to check for all messages in the queue for this window.
+	 *				If a message exists, it is translated and dispatched to the window procedure.
+	 *	@return		`true` if a message was processed, `false` if no messages were pending.
+	 */
+	bool processEvents();
+
+
+	/**
+	 *	@brief		Sleeps until a message arrives, one of `handles` is signaled, or `timeout` elapses.
+	 *	@details	Same as `ThreadWindows::waitEvents`, but only messages of this window are processed.
+	 *	@param[in]	handles - Kernel handles to wait on.
+	 *	@param[in]	count - Number of handles, at most `MAXIMUM_WAIT_OBJECTS - 1`.
+	 *	@param[in]	timeout - Timeout in milliseconds, or `INFINITE`.
+	 *	@note		Messages of other windows of this thread also wake the thread up: `WaitSource::Message`
+	 *				is returned even though none of them were processed.
+	 */
+	WaitResult waitEvents(const HANDLE * handles, size_t count, DWORD timeout = INFINITE);
+
+
+	/**
+	 *	@brief		Runs a paced frame loop until the window is closed or `callback` returns `false`.
+	 *	@details	Between frames the thread sleeps in `MsgWaitForMultipleObjectsEx`, dispatching messages of all
+	 *				windows of this thread as they arrive, so an idle or slow-animating window does not spin a core.
+	 *				While the window cannot be seen (minimized, hidden, cloaked, occluded or on a locked session, see
+	 *				`getVisibility`), no frames are produced and the thread sleeps until the next message.
+	 *				If the framebuffer is enabled, it is presented after each `callback` (and must not be presented by it).
+	 *				With `enableLiveResize`, frames keep being produced inside the modal size/move loop.
+	 *	@param[in]	targetHz - Target frame rate, paced with a high-resolution waitable timer (falls back to a regular
+	 *				waitable timer before Windows 10 1803). If `<= 0`, frames are paced to DWM composition with `DwmFlush`.
+	 *	@param[in]	callback - Called once per frame with the timing of the loop, returns `false` to stop.
+	 */
+	void runFrameLoop(double targetHz, Callback<bool(const FrameStats & stats)> callback);
+
+private:
+
+	//!	@brief	Adjusts the window rectangle based on the specified styles.
+	template<bool SkipCaption> static void adjustWindowRect(Rect & rect, DWORD dwStyle, DWORD dwExStyle, UINT dpi);
+
+	//!	@brief	Recomputes the frame if the window was created on a monitor whose DPI differs from the system DPI used by `open`.
+	void fitFrameToDpi(int clientWidth, int clientHeight);
+
+	//!	@brief	Returns the registered message used to wake up the window thread for posted tasks.
+	static UINT postedTasksMessage();
+
+	//!	@brief	Starts tracking the cloaking and session lock of the window, after it is created.
+	void watchVisibility();
+
+	//!	@brief	Stops tracking the cloaking and session lock of the window, before it is destroyed.
+	void unwatchVisibility();
+
+	//!	@brief	Calls `onVisibilityChanged` if `getVisibility` changed since the last call.
+	void updateVisibility();
+
+	//!	@brief	Receives `EVENT_OBJECT_CLOAKED` and `EVENT_OBJECT_UNCLOAKED` for the windows of this thread.
+	static void CALLBACK cloakEventProc(HWINEVENTHOOK hHook, DWORD event, HWND hWnd, LONG idObject, LONG idChild, DWORD idThread, DWORD time);
+
+	//!	@brief	`wParam` of `postedTasksMessage` sent by `close` from a foreign thread.
+	static constexpr WPARAM CloseRequest = 1;
+
+	//!	@brief	Returns the per-process `lParam` of a `CloseRequest`, so that other processes cannot close the window.
+	static LPARAM closeRequestToken();
+
+	//!	@brief	Framebuffer section shared by `shareFramebuffer`.
+	struct SharedSection
+	{
+		HANDLE							hSection = nullptr;
+		HANDLE							hFrameEvent = nullptr;
+		HANDLE							hPresentedEvent = nullptr;
+		SharedFramebufferHeader *		header = nullptr;		// View of the first page only, the pixels are mapped by the DIB section
+		Size							maxExtent = {};
+		uint32_t						presented = 0;			// Last sequence presented
+	};
+
+	//!	@brief	Geometry change of a window, applied at once or by the layout transaction of the thread.
+	struct LayoutRequest
+	{
+		HWND		hWnd;
+		Point		pos;				// New client position (screen coordinates), if `move`
+		Size		extent;				// New client extent, if `size`
+		bool		move;
+		bool		size;
+		bool		frameChanged;		// Style bits changed, the frame must be recomputed
+		bool		keepClient;			// Keep the client rectangle across the frame change
+	};
+
+	//!	@brief	Layout transaction of a thread (see `ThreadWindows::beginLayout`).
+	struct LayoutTransaction
+	{
+		int								depth = 0;
+		std::vector<LayoutRequest>		requests;
+	};
+
+	//!	@brief	Returns the layout transaction of the calling thread.
+	static LayoutTransaction & layoutTransaction() { thread_local LayoutTransaction transaction;	return transaction; }
+
+	//!	@brief	Applies `request` at once, or merges it into the layout transaction of the calling thread.
+	void requestLayout(const LayoutRequest & request);
+
+	//!	@brief	Applies `request` with `SetWindowPos`, or adds it to `hDwp` with `DeferWindowPos` if not null.
+	static HDWP applyLayout(const LayoutRequest & request, HDWP hDwp);
+
+	friend void ThreadWindows::beginLayout();
+	friend bool ThreadWindows::commitLayout();
+
+	//!	@brief	Runs all tasks queued by `post`, in FIFO order.
+	void runPostedTasks();
+
+	//!	@brief	Makes `post` fail from now on, then discards all tasks queued by `post`.
+	void clearPostedTasks();
+
+	//!	@brief	Stops all timers started by `setPreciseTimer`.
+	void killPreciseTimers();
+
+	//!	@brief	Collects the mouse points (client coordinates, oldest first) since the previous `WM_MOUSEMOVE` into `m_moveHistory`.
+	void collectMouseMoveHistory(int x, int y);
+
+	//!	@brief	Reads all paths of a drop into `m_dropBuffer` / `m_dropPaths`.
+	void collectDropPaths(HDROP hDrop);
+
+	//!	@brief	Dispatches one raw input packet to `onRawMouse` / `onRawKeyboard`.
+	void dispatchRawInput(const RAWINPUT & rawInput);
+
+	//!	@brief	Returns the id of the live-resize timer, derived from the address of the window so it cannot collide with user timers.
+	UINT_PTR liveResizeTimerId() const { return reinterpret_cast<UINT_PTR>(&m_liveResizeInterval); }
+
+	//!	@brief	Resizes the framebuffer and the presenter to the current client extent (not called while minimized).
+	void resizeSurfaces(int width, int height);
+
+	//!	@brief	Resizes the framebuffer to the given client extent, clamped to the shared section and published in its header.
+	void resizeFramebuffer(int width, int height);
+
+	//!	@brief	Updates the cached size, position, visibility and style from `WM_SIZE`, `WM_MOVE`, `WM_WINDOWPOSCHANGED` and `WM_STYLECHANGED`.
+	void updateCachedState(UINT uMsg, WPARAM wParam, LPARAM lParam);
+
+	//!	@brief	Dispatches a message to the callbacks of `window`, returns `-1` if not handled.
+	static Result dispatch(Window * window, UINT uMsg, WPARAM wParam, LPARAM lParam);
+
+	//!	@brief	Window procedure for message dispatching.
+	template<bool SkipCaption> static LRESULT procedure(HWND hWnd, UINT Msg, WPARAM wParam, LPARAM lParam);
+
+	//!	@brief	Create window (internal).
+	template<bool SkipCaption> void internalOpen(string_type title, DWORD dwStyle, DWORD dwExStyle, int x, int y, int w, int h);
+
+	//!	@brief	Determines whether the window should skip the caption area based on style flags.
+	static bool shouldSkipCaption(Flags<Style> styleFlags) { return !styleFlags.has(Style::Caption) && styleFlags.has(Style::ThickFrame); }
+
+	//!	@brief	Converts internal style flags to native Win32 style bits.
+	static DWORD toNativeStyle(Flags<Style> styleFlags);
+
+	//!	@brief	Blits a 32-bit top-down DIB to the client area (inside `BeginPaint`/`EndPaint`), clipped to the update region.
+	void paintBitmap(const void * pixels, size_t pitch, BITMAPINFO * bmi, int width, int height, int dstX, int dstY);
+
+	//!	@brief	Blits the framebuffer in response to `WM_PAINT`, clipped to the update region.
+	void paintFramebuffer();
+
+	//!	@brief	Collects the rectangles of the pending update region into `m_updateRects`, must be called before `BeginPaint`.
+	void collectUpdateRects();
+
+public:
+
+	/**
+	 *	@brief		User-defined callback functions, called when triggered and defined by the user.
+	 *	@note		Each callback can optionally handle the event and determine whether it should be passed to the 
+	 *				system's default handler (`DefWindowProc`).
+	 *	@details	If the callback returns any value other than `-1`, that value will be returned directly as the 
+	 *				window procedure’s result — meaning the event is considered handled and `DefWindowProc` will **not** be called.
+	 *	@details	If the callback returns `-1`, the message will be forwarded to `DefWindowProc` for default processing.
+	 */
+	Callback<Result(HWND, UINT, WPARAM, LPARAM)>						forwardMessage;		// Called before default message handling.
+	Callback<Result(wchar_t)>											onInputCharacter;	// Called when a character input (WM_CHAR, WM_SYSCHAR, WM_UNICHAR) is received.
+	Callback<Result(const std::vector<string_type>&)>					onDropFiles;		// Called when files are dropped onto the window (WM_DROPFILES), requires ExStyle::AcceptFiles.
+	Callback<Result(const string_view_type*, size_t)>					onDropPaths;		// If set, replaces `onDropFiles` with views into a reused buffer (no per-file allocation), valid only during the call.
+	Callback<Result()>													onEnterMove;		// Called when the user starts moving or resizing the window(WM_ENTERSIZEMOVE).
+	Callback<Result()>													onExitMove;			// Called when the user finishes moving or resizing the window (WM_EXITSIZEMOVE).
+	Callback<Result(UINT dpi)>											onDpiChanged;		// Called when the DPI of the window changes (WM_DPICHANGED), after the window has been resized to the rectangle suggested by Windows.
+	Callback<void()>													onLiveResizeTick;	// Called on each tick of the live-resize timer when `runFrameLoop` is not running, see `enableLiveResize`.
+	Callback<Result()>													onPaint;			// Called when the window needs to be repainted (WM_PAINT).
+	Callback<Result(UINT_PTR id)>										onTimer;			// Called when a timer event occurs (WM_TIMER).
+	Callback<void(UINT_PTR id)>											onPreciseTimer;		// Called on each tick of a timer started by `setPreciseTimer`.
+	Callback<void(Visibility visibility)>								onVisibilityChanged;	// Called when `getVisibility` changes, e.g. to pause rendering threads.
+	Callback<Result(bool focused)>										onFocus;			// Called when the window gains or lost focus (WM_SETFOCUS, WM_KILLFOCUS).
+	Callback<Result()>													onClose;			// Called when the window is about to close (WM_CLOSE).
+	Callback<Result()>													onMouseLeave;		// Called when the mouse leave the client area (WM_MOUSELEAVE).
+	Callback<Result(int x, int y)>										onMove;				// Called when the window is moved (WM_MOVE).
+	Callback<Result(int w, int h)>										onResize;			// Called when the window is resized (WM_SIZE).
+	Callback<Result(int x, int y, Flags<MouseState>)>					onMouseMove;		// Called when the mouse is moved (WM_MOUSEMOVE).
+	Callback<Result(const Point*, size_t, Flags<MouseState>)>			onMouseMoveHistory;	// If set, replaces `onMouseMove` with every point since the last WM_MOUSEMOVE, oldest first (GetMouseMovePointsEx).
+	Callback<Result(int dx, int dy, Flags<MouseState>)>					onWheelScroll;		// Called when the mouse wheel is scrolled (WM_MOUSEWHEEL / WM_MOUSEHWHEEL).
+	Callback<Result(MouseButton, MouseAction, Flags<MouseState>)>		onMouseClick;		// Called when a mouse button event occurs (down, up, or double click).
+	Callback<Result(Key, KeyAction)>									onKeyboardPress;	// Called when a key is pressed, released, or repeated (WM_KEYDOWN/WM_KEYUP).
+	Callback<HitTestResult(int x, int y)>								onHitTest;			// Called when WM_NCHITTEST is received, should return the hit-test result based on cursor position.
+	Callback<void(int dx, int dy, Flags<RawMouseButton>)>				onRawMouse;			// Called for each raw mouse packet, see `enableRawInput` (WM_INPUT).
+	Callback<void(Key, KeyAction)>										onRawKeyboard;		// Called for each raw keyboard packet, see `enableRawInput` (WM_INPUT).
+
+private:
+
+	HWND			m_hWnd = nullptr;
+	Size			m_minTrackSize = { 120, 31 };
+	Size			m_maxTrackSize = { LONG_MAX, LONG_MAX };
+	bool			m_enableBlurBeind = false;
+	bool			m_enableFramebuffer = false;
+	bool			m_skipCaption = false;
+	DWORD			m_dwStyle = 0;			// Cached GWL_STYLE, including WS_VISIBLE / WS_MINIMIZE / WS_MAXIMIZE
+	DWORD			m_dwExStyle = 0;		// Cached GWL_EXSTYLE
+	Point			m_clientPos = {};		// Cached client position (screen coordinates)
+	Size			m_clientExtent = {};	// Cached client extent
+	UINT			m_dpi = USER_DEFAULT_SCREEN_DPI;
+	Byte			m_opacity = 255;	// 0 = transparent, 255 = opaque
+	bool			m_layeredContent = false;	// Content is set by `presentLayered` (UpdateLayeredWindow) instead of SetLayeredWindowAttributes
+	Framebuffer		m_framebuffer;
+	SharedSection	m_shared;				// Backing section of `m_framebuffer`, see `shareFramebuffer`
+	Framebuffer		m_layeredSurface;		// Premultiplied copy of the `presentLayered` content
+	Presenter *		m_presenter = nullptr;
+	FrameCapture *	m_frameCapture = nullptr;
+	EventRecorder *	m_recorder = nullptr;
+	InputQueue *	m_inputQueue = nullptr;
+	bool			m_replaying = false;
+	bool			m_quitOnClose = true;
+	bool			m_hasPreciseTimers = false;		// Whether `setPreciseTimer` was called since the window was opened
+	bool			m_cloaked = false;				// Tracked by `cloakEventProc`
+	bool			m_sessionLocked = false;		// Tracked from WM_WTSSESSION_CHANGE
+	bool			m_occluded = false;				// Reported by the presenter, see `setOccluded`
+	Visibility		m_visibility = Visibility::Hidden;		// Last value passed to `onVisibilityChanged`
+	bool			m_enableLiveResize = false;
+	bool			m_inSizeMove = false;		// Inside the modal size/move loop with live resize enabled
+	bool			m_resizePending = false;	// Surfaces to reallocate on WM_EXITSIZEMOVE
+	unsigned int	m_liveResizeInterval = 16;
+	Callback<void()>	m_frameTick;			// One frame of the running `runFrameLoop`
+#ifdef EZWIN32_ENABLE_PROFILER
+	DispatchProfiler	m_profiler;
+#endif
+
+	std::vector<ColorBGRA>		m_convertBuffer;	// Reused by `drawBitmap(const ColorRGB*, ...)`
+	std::vector<Byte>			m_regionData;		// Reused by `collectUpdateRects()`
+	std::vector<Rect>			m_updateRects;		// Rectangles of the update region of the current `WM_PAINT`
+	HRGN						m_hUpdateRgn = nullptr;
+
+	struct PostedTask { Callback<void()> task;	PostedTask * next; };
+
+	std::atomic<PostedTask*>	m_postedTasks = nullptr;	// Intrusive LIFO stack, reversed when drained
+	std::atomic<bool>			m_wakePending = false;		// Whether a wake-up message is in flight
+	std::atomic<HWND>			m_postTarget = nullptr;		// Handle woken up by `post`, cleared before the window is destroyed
+	std::atomic<int>			m_postsInFlight = 0;		// Number of `post` calls between reading `m_postTarget` and waking it
+
+	bool						m_enableRawMouse = false;
+	bool						m_enableRawKeyboard = false;
+	bool						m_hasRawAbsolutePos = false;
+	Point						m_rawAbsolutePos = {};		// Last position of absolute raw mouse devices (pen tablets, remote desktop)
+	std::bitset<256>			m_rawKeysDown;				// Used to tell raw key repeats from presses
+	std::vector<uint64_t>		m_rawInputBuffer;			// Reused by `processRawInput()`, 8-byte aligned as required by `GetRawInputBuffer`
+
+	bool						m_hasLastMovePoint = false;
+	MOUSEMOVEPOINT				m_lastMovePoint = {};		// Last point delivered to `onMouseMoveHistory`, in display coordinates
+	std::vector<Point>			m_moveHistory;				// Reused by `collectMouseMoveHistory()`
+
+	std::vector<string_type::value_type>	m_dropBuffer;			// NUL-separated paths of the current drop
+	std::vector<string_view_type>			m_dropPaths;			// Views into `m_dropBuffer`
+};
+
+/*********************************************************************************
+*****************************    WindowThreadPool    *****************************
+*********************************************************************************/
+
+/**
+ *	@brief		Fixed set of UI threads, each running its own message loop.
+ *	@details	A window belongs to the thread that opens it and is only serviced by that thread's loop, so a window
+ *				opened from a task of the pool never waits for the callbacks of windows living on other threads.
+ *				Tasks are delivered through a hidden window per thread (see `Window::post`), so they still run while
+ *				the thread is inside a modal loop (moving, resizing, menus). `WM_QUIT` posted by a pooled window
+ *				(see `Window::setQuitOnClose`) is ignored: the loops only end with the pool.
+ *	@note		Callbacks of a pooled window run on its pool thread. Windows still open when the pool is destroyed
+ *				are destroyed by their thread, so the pool must be destroyed before the `Window` objects it hosts.
+ */
+class easywin32::WindowThreadPool
+{
+	struct Worker
+	{
+		std::thread		thread;
+		Window			host;					// Hidden, receives the tasks
+		DWORD			threadId = 0;
+		HANDLE			hReady = nullptr;		// Signaled once `host` is open
+	};
+
+public:
+
+	//!	@brief	Starts `numThreads` UI threads (0 = one per hardware thread), and returns once all of them accept tasks.
+	explicit WindowThreadPool(size_t numThreads = 0);
+
+	WindowThreadPool(const WindowThreadPool&) = delete;
+
+	void operator=(const WindowThreadPool&) = delete;
+
+	//!	@brief	Stops all threads, destroying the windows still open on them.
+	~WindowThreadPool();
+
+public:
+
+	//!	@brief	Returns the number of threads.
+	size_t size() const { return m_workers.size(); }
+
+	//!	@brief	Returns the identifier of the thread at `threadIndex`.
+	DWORD getThreadId(size_t threadIndex) const { return m_workers[threadIndex]->threadId; }
+
+	//!	@brief	Queues `task` on the thread at `threadIndex`, returns immediately.
+	bool submit(size_t threadIndex, Callback<void()> task) { return m_workers[threadIndex]->host.post(std::move(task)); }
+
+	//!	@brief	Queues `task` on the next thread (round-robin, one window per task spreads them over the threads).
+	bool submit(Callback<void()> task) { return this->submit(m_nextThread.fetch_add(1) % m_workers.size(), std::move(task)); }
+
+	/**
+	 *	@brief		Runs `task` on the thread at `threadIndex` and waits until it returns.
+	 *	@details	Typically used to open a window and install its callbacks before using it from the calling thread.
+	 *				Runs `task` directly when called from that thread. Two pool threads invoking each other wait for
+	 *				each other forever: give a `timeout` there, or use `submit`.
+	 *	@return		`false` if the task could not be queued, or did not return within `timeout` (it still runs later).
+	 */
+	bool invoke(size_t threadIndex, Callback<void()> task, DWORD timeout = INFINITE);
+
+private:
+
+	//!	@brief	Message loop of a pool thread.
+	void threadMain(Worker * worker);
+
+private:
+
+	std::vector<std::unique_ptr<Worker>>	m_workers;
+	std::atomic<size_t>						m_nextThread = 0;
+	std::atomic<bool>						m_stopping = false;
+};
+
+/*********************************************************************************
+********************************    WindowPool    ********************************
+*********************************************************************************/
+
+/**
+ *	@brief		Set of hidden windows opened ahead of time from the same `WindowDesc`.
+ *	@details	Creating a window (class lookup, `CreateWindowEx`, non-client metrics, DWM attributes) costs far more
+ *				than showing one, so an application opening many similar windows at launch can `reserve` them once,
+ *				then `acquire` each of them, which only positions and shows an existing window. `recycle` hides
+ *				a window and makes it available again, keeping its callbacks. Windows closed while acquired are
+ *				reopened hidden when acquired again.
+ *	@note		Windows belong to the thread that opens them: use a pool from a single thread (e.g. one pool per
+ *				`WindowThreadPool` thread, filled from a task). Pooled windows do not post `WM_QUIT` on close.
+ */
+class easywin32::WindowPool
+{
+
+public:
+
+	explicit WindowPool(const WindowDesc & desc) : m_desc(desc) { m_desc.styleFlags &= ~Style::Visible; }
+
+	WindowPool(const WindowPool&) = delete;
+
+	void operator=(const WindowPool&) = delete;
+
+public:
+
+	//!	@brief	Opens hidden windows until the pool holds `count` of them.
+	void reserve(size_t count);
+
+	/**
+	 *	@brief		Moves an idle window of the pool to (`left`, `top`) in client coordinates and shows it.
+	 *	@details	Opens a new window if none is idle.
+	 */
+	Window & acquire(int left, int top);
+
+	//!	@brief	Hides `window` (acquired from this pool) and makes it available to `acquire` again.
+	void recycle(Window & window);
+
+	//!	@brief	Returns the number of windows owned by the pool.
+	size_t size() const { return m_windows.size(); }
+
+	//!	@brief	Returns the number of windows available to `acquire`.
+	size_t idleCount() const { return m_idle.size(); }
+
+	//!	@brief	Returns the descriptor the windows are opened from (without `Style::Visible`).
+	const WindowDesc & getDesc() const { return m_desc; }
+
+private:
+
+	//!	@brief	Opens one more hidden window.
+	Window * grow();
+
+private:
+
+	WindowDesc								m_desc;
+	std::vector<std::unique_ptr<Window>>	m_windows;
+	std::vector<Window*>					m_idle;
+};
+
+/*********************************************************************************
+******************************    Implementation    ******************************
+*********************************************************************************/
+
+#ifdef EZWIN32_IMPLEMENTATION
+
+#include <windowsx.h>
+#include <map>
+#include <mutex>
+
+/*********************************************************************************
+*******************************    DpiFunctions    *******************************
+*********************************************************************************/
+
+namespace easywin32
+{
+	namespace details
+	{
+		/**
+		 *	@brief		Per-monitor DPI functions of user32, resolved at run time.
+		 *	@details	They only exist since Windows 10 1607, importing them statically would prevent the executable
+		 *				from loading on older systems. The fallbacks use the system DPI and `AdjustWindowRectEx`.
+		 */
+		struct DpiFunctions
+		{
+			UINT (WINAPI * getDpiForWindow)(HWND) = nullptr;
+			UINT (WINAPI * getDpiForSystem)() = nullptr;
+			BOOL (WINAPI * adjustWindowRectExForDpi)(LPRECT, DWORD, BOOL, DWORD, UINT) = nullptr;
+			DPI_AWARENESS_CONTEXT (WINAPI * setThreadDpiAwarenessContext)(DPI_AWARENESS_CONTEXT) = nullptr;
+
+			DpiFunctions()
+			{
+				HMODULE hUser32 = ::GetModuleHandle(TEXT("user32.dll"));
+
+				getDpiForWindow					= reinterpret_cast<decltype(getDpiForWindow)>(::GetProcAddress(hUser32, "GetDpiForWindow"));
+				getDpiForSystem					= reinterpret_cast<decltype(getDpiForSystem)>(::GetProcAddress(hUser32, "GetDpiForSystem"));
+				adjustWindowRectExForDpi		= reinterpret_cast<decltype(adjustWindowRectExForDpi)>(::GetProcAddress(hUser32, "AdjustWindowRectExForDpi"));
+				setThreadDpiAwarenessContext	= reinterpret_cast<decltype(setThreadDpiAwarenessContext)>(::GetProcAddress(hUser32, "SetThreadDpiAwarenessContext"));
+			}
+
+			static const DpiFunctions & instance() { static const DpiFunctions functions;	return functions; }
+
+			//!	@brief	Returns the DPI of the system, i.e. of the primary monitor at logon.
+			static UINT systemDpi()
+			{
+				if (instance().getDpiForSystem != nullptr)
+					return instance().getDpiForSystem();
+
+				HDC hdc = ::GetDC(nullptr);
+
+				const int dpi = ::GetDeviceCaps(hdc, LOGPIXELSX);
+
+				::ReleaseDC(nullptr, hdc);
+
+				return (dpi > 0) ? static_cast<UINT>(dpi) : USER_DEFAULT_SCREEN_DPI;
+			}
+
+			//!	@brief	Returns the DPI of `hWnd`, the system DPI before Windows 10 1607.
+			static UINT windowDpi(HWND hWnd)
+			{
+				return (instance().getDpiForWindow != nullptr) ? instance().getDpiForWindow(hWnd) : systemDpi();
+			}
+
+			//!	@brief	Same as `AdjustWindowRectExForDpi`, the DPI is ignored before Windows 10 1607.
+			static BOOL adjustWindowRect(RECT * rect, DWORD dwStyle, DWORD dwExStyle, UINT dpi)
+			{
+				if (instance().adjustWindowRectExForDpi != nullptr)
+					return instance().adjustWindowRectExForDpi(rect, dwStyle, FALSE, dwExStyle, dpi);
+
+				return ::AdjustWindowRectEx(rect, dwStyle, FALSE, dwExStyle);
+			}
+		};
+	}
+}
+
+/*********************************************************************************
+********************************    to_string    *********************************
+*********************************************************************************/
+
+std::string easywin32::to_string(Flags<Style> styleFlags)
+{
+	std::string result;
+
+	EZWIN32_CASE_APPEND_STR(result, styleFlags, Style::Border);
+	EZWIN32_CASE_APPEND_STR(result, styleFlags, Style::Visible);
+	EZWIN32_CASE_APPEND_STR(result, styleFlags, Style::SysMenu);
+	EZWIN32_CASE_APPEND_STR(result, styleFlags, Style::Caption);
+	EZWIN32_CASE_APPEND_STR(result, styleFlags, Style::Disabled);
+	EZWIN32_CASE_APPEND_STR(result, styleFlags, Style::Resizable);
+	EZWIN32_CASE_APPEND_STR(result, styleFlags, Style::ThickFrame);
+	EZWIN32_CASE_APPEND_STR(result, styleFlags, Style::MinimizeBox);
+	EZWIN32_CASE_APPEND_STR(result, styleFlags, Style::MaximizeBox);
+	EZWIN32_CASE_APPEND_STR(result, styleFlags, Style::PopupWindow);
+	EZWIN32_CASE_APPEND_STR(result, styleFlags, Style::OverlappedWindow);
+
+	return result.empty() ?	"Style::Empty" : result;
+}
+
+
+std::string easywin32::to_string(Flags<ExStyle> exStyleFlags)
+{
+	std::string result;
+
+	// Individual
+	EZWIN32_CASE_APPEND_STR(result, exStyleFlags, ExStyle::AcceptFiles);
+	EZWIN32_CASE_APPEND_STR(result, exStyleFlags, ExStyle::AppWindow);
+	EZWIN32_CASE_APPEND_STR(result, exStyleFlags, ExStyle::ClientEdge);
+	EZWIN32_CASE_APPEND_STR(result, exStyleFlags, ExStyle::Composited);
+	EZWIN32_CASE_APPEND_STR(result, exStyleFlags, ExStyle::ContextHelp);
+	EZWIN32_CASE_APPEND_STR(result, exStyleFlags, ExStyle::ControlParent);
+	EZWIN32_CASE_APPEND_STR(result, exStyleFlags, ExStyle::DlgModalFrame);
+	EZWIN32_CASE_APPEND_STR(result, exStyleFlags, ExStyle::Layered);
+	EZWIN32_CASE_APPEND_STR(result, exStyleFlags, ExStyle::LayoutRtl);
+	EZWIN32_CASE_APPEND_STR(result, exStyleFlags, ExStyle::LeftScrollBar);
+	EZWIN32_CASE_APPEND_STR(result, exStyleFlags, ExStyle::LtrReading);
+	EZWIN32_CASE_APPEND_STR(result, exStyleFlags, ExStyle::MDIChild);
+	EZWIN32_CASE_APPEND_STR(result, exStyleFlags, ExStyle::NoActivate);
+	EZWIN32_CASE_APPEND_STR(result, exStyleFlags, ExStyle::NoInheritLayout);
+	EZWIN32_CASE_APPEND_STR(result, exStyleFlags, ExStyle::NoParentNotify);
+	EZWIN32_CASE_APPEND_STR(result, exStyleFlags, ExStyle::NoRedirectionBitmap);
+	EZWIN32_CASE_APPEND_STR(result, exStyleFlags, ExStyle::Right);
+	EZWIN32_CASE_APPEND_STR(result, exStyleFlags, ExStyle::RightScrollBar);
+	EZWIN32_CASE_APPEND_STR(result, exStyleFlags, ExStyle::RtlReading);
+	EZWIN32_CASE_APPEND_STR(result, exStyleFlags, ExStyle::StaticEdge);
+	EZWIN32_CASE_APPEND_STR(result, exStyleFlags, ExStyle::ToolWindow);
+	EZWIN32_CASE_APPEND_STR(result, exStyleFlags, ExStyle::TopMost);
+	EZWIN32_CASE_APPEND_STR(result, exStyleFlags, ExStyle::Transparent);
+	EZWIN32_CASE_APPEND_STR(result, exStyleFlags, ExStyle::WindowEdge);
+	// Combined
+	EZWIN32_CASE_APPEND_STR(result, exStyleFlags, ExStyle::OverlappedWindow);
+	EZWIN32_CASE_APPEND_STR(result, exStyleFlags, ExStyle::PaletteWindow);
+
+	return result.empty() ? "ExStyle::Left" : result;
+}
+
+
+const char * easywin32::to_string(Key key)
+{
+	switch (key)
+	{
+		EZWIN32_CASE_TO_STR(Key::A);
+		EZWIN32_CASE_TO_STR(Key::B);
+		EZWIN32_CASE_TO_STR(Key::C);
+		EZWIN32_CASE_TO_STR(Key::D);
+		EZWIN32_CASE_TO_STR(Key::E);
+		EZWIN32_CASE_TO_STR(Key::F);
+		EZWIN32_CASE_TO_STR(Key::G);
+		EZWIN32_CASE_TO_STR(Key::H);
+		EZWIN32_CASE_TO_STR(Key::I);
+		EZWIN32_CASE_TO_STR(Key::J);
+		EZWIN32_CASE_TO_STR(Key::K);
+		EZWIN32_CASE_TO_STR(Key::L);
+		EZWIN32_CASE_TO_STR(Key::M);
+		EZWIN32_CASE_TO_STR(Key::N);
+		EZWIN32_CASE_TO_STR(Key::O);
+		EZWIN32_CASE_TO_STR(Key::P);
+		EZWIN32_CASE_TO_STR(Key::Q);
+		EZWIN32_CASE_TO_STR(Key::R);
+		EZWIN32_CASE_TO_STR(Key::S);
+		EZWIN32_CASE_TO_STR(Key::T);
+		EZWIN32_CASE_TO_STR(Key::U);
+		EZWIN32_CASE_TO_STR(Key::V);
+		EZWIN32_CASE_TO_STR(Key::W);
+		EZWIN32_CASE_TO_STR(Key::X);
+		EZWIN32_CASE_TO_STR(Key::Y);
+		EZWIN32_CASE_TO_STR(Key::Z);
+
+		EZWIN32_CASE_TO_STR(Key::Num0);
+		EZWIN32_CASE_TO_STR(Key::Num1);
+		EZWIN32_CASE_TO_STR(Key::Num2);
+		EZWIN32_CASE_TO_STR(Key::Num3);
+		EZWIN32_CASE_TO_STR(Key::Num4);
+		EZWIN32_CASE_TO_STR(Key::Num5);
+		EZWIN32_CASE_TO_STR(Key::Num6);
+		EZWIN32_CASE_TO_STR(Key::Num7);
+		EZWIN32_CASE_TO_STR(Key::Num8);
+		EZWIN32_CASE_TO_STR(Key::Num9);
+
+		EZWIN32_CASE_TO_STR(Key::F1);
+		EZWIN32_CASE_TO_STR(Key::F2);
+		EZWIN32_CASE_TO_STR(Key::F3);
+		EZWIN32_CASE_TO_STR(Key::F4);
+		EZWIN32_CASE_TO_STR(Key::F5);
+		EZWIN32_CASE_TO_STR(Key::F6);
+		EZWIN32_CASE_TO_STR(Key::F7);
+		EZWIN32_CASE_TO_STR(Key::F8);
+		EZWIN32_CASE_TO_STR(Key::F9);
+		EZWIN32_CASE_TO_STR(Key::F10);
+		EZWIN32_CASE_TO_STR(Key::F11);
+		EZWIN32_CASE_TO_STR(Key::F12);
+		EZWIN32_CASE_TO_STR(Key::F13);
+		EZWIN32_CASE_TO_STR(Key::F14);
+		EZWIN32_CASE_TO_STR(Key::F15);
+		EZWIN32_CASE_TO_STR(Key::F16);
+		EZWIN32_CASE_TO_STR(Key::F17);
+		EZWIN32_CASE_TO_STR(Key::F18);
+		EZWIN32_CASE_TO_STR(Key::F19);
+		EZWIN32_CASE_TO_STR(Key::F20);
+		EZWIN32_CASE_TO_STR(Key::F21);
+		EZWIN32_CASE_TO_STR(Key::F22);
+		EZWIN32_CASE_TO_STR(Key::F23);
+		EZWIN32_CASE_TO_STR(Key::F24);
+
+		EZWIN32_CASE_TO_STR(Key::Pause);
+		EZWIN32_CASE_TO_STR(Key::ScrollLock);
+		EZWIN32_CASE_TO_STR(Key::PrintScreen);
+
+		EZWIN32_CASE_TO_STR(Key::End);
+		EZWIN32_CASE_TO_STR(Key::Home);
+		EZWIN32_CASE_TO_STR(Key::Insert);
+		EZWIN32_CASE_TO_STR(Key::Delete);
+		EZWIN32_CASE_TO_STR(Key::PageUp);
+		EZWIN32_CASE_TO_STR(Key::PageDown);
+
+		EZWIN32_CASE_TO_STR(Key::Up);
+		EZWIN32_CASE_TO_STR(Key::Down);
+		EZWIN32_CASE_TO_STR(Key::Left);
+		EZWIN32_CASE_TO_STR(Key::Right);
+
+		EZWIN32_CASE_TO_STR(Key::Tab);
+		EZWIN32_CASE_TO_STR(Key::Alt);
+		EZWIN32_CASE_TO_STR(Key::Apps);
+		EZWIN32_CASE_TO_STR(Key::Space);
+		EZWIN32_CASE_TO_STR(Key::Clear);
+		EZWIN32_CASE_TO_STR(Key::Shift);
+		EZWIN32_CASE_TO_STR(Key::Enter);
+		EZWIN32_CASE_TO_STR(Key::LeftWin);
+		EZWIN32_CASE_TO_STR(Key::RightWin);
+		EZWIN32_CASE_TO_STR(Key::Escape);
+		EZWIN32_CASE_TO_STR(Key::Control);
+		EZWIN32_CASE_TO_STR(Key::CapLock);
+		EZWIN32_CASE_TO_STR(Key::BackSpace);
+
+		EZWIN32_CASE_TO_STR(Key::NumLock);
+		EZWIN32_CASE_TO_STR(Key::NumPad0);
+		EZWIN32_CASE_TO_STR(Key::NumPad1);
+		EZWIN32_CASE_TO_STR(Key::NumPad2);
+		EZWIN32_CASE_TO_STR(Key::NumPad3);
+		EZWIN32_CASE_TO_STR(Key::NumPad4);
+		EZWIN32_CASE_TO_STR(Key::NumPad5);
+		EZWIN32_CASE_TO_STR(Key::NumPad6);
+		EZWIN32_CASE_TO_STR(Key::NumPad7);
+		EZWIN32_CASE_TO_STR(Key::NumPad8);
+		EZWIN32_CASE_TO_STR(Key::NumPad9);
+
+		EZWIN32_CASE_TO_STR(Key::Add);
+		EZWIN32_CASE_TO_STR(Key::Divide);
+		EZWIN32_CASE_TO_STR(Key::Decimal);
+		EZWIN32_CASE_TO_STR(Key::Subtract);
+		EZWIN32_CASE_TO_STR(Key::Multiply);
+
+		EZWIN32_CASE_TO_STR(Key::VolumeUp);
+		EZWIN32_CASE_TO_STR(Key::VolumeMute);
+		EZWIN32_CASE_TO_STR(Key::VolumeDown);
+
+		EZWIN32_CASE_TO_STR(Key::MediaStop);
+		EZWIN32_CASE_TO_STR(Key::MediaPlayPause);
+		EZWIN32_CASE_TO_STR(Key::MediaNextTrack);
+		EZWIN32_CASE_TO_STR(Key::MediaPrevTrack);
+
+		EZWIN32_CASE_TO_STR(Key::LaunchMail);
+		EZWIN32_CASE_TO_STR(Key::LaunchApp1);
+		EZWIN32_CASE_TO_STR(Key::LaunchApp2);
+		EZWIN32_CASE_TO_STR(Key::LaunchMediaSelect);
+
+		EZWIN32_CASE_TO_STR(Key::BrowserHome);
+		EZWIN32_CASE_TO_STR(Key::BrowserStop);
+		EZWIN32_CASE_TO_STR(Key::BrowserBack);
+		EZWIN32_CASE_TO_STR(Key::BrowserSearch);
+		EZWIN32_CASE_TO_STR(Key::BrowserForward);
+		EZWIN32_CASE_TO_STR(Key::BrowserRefresh);
+		EZWIN32_CASE_TO_STR(Key::BrowserFavorites);
+
+		default:	return "Key::Unknown";
+	}
+}
+
+
+const char * easywin32::to_string(MouseButton button)
+{
+	switch (button)
+	{
+		EZWIN32_CASE_TO_STR(MouseButton::Left);
+		EZWIN32_CASE_TO_STR(MouseButton::Right);
+		EZWIN32_CASE_TO_STR(MouseButton::Middle);
+		EZWIN32_CASE_TO_STR(MouseButton::XButton1);
+		EZWIN32_CASE_TO_STR(MouseButton::XButton2);
+		default:	return "MouseButton::Unknown";
+	}
+}
+
+
+std::string easywin32::to_string(Flags<MouseState> stateFlags)
+{
+	std::string result;
+
+	EZWIN32_CASE_APPEND_STR(result, stateFlags, MouseState::Left);
+	EZWIN32_CASE_APPEND_STR(result, stateFlags, MouseState::Right);
+	EZWIN32_CASE_APPEND_STR(result, stateFlags, MouseState::Middle);
+	EZWIN32_CASE_APPEND_STR(result, stateFlags, MouseState::XButton1);
+	EZWIN32_CASE_APPEND_STR(result, stateFlags, MouseState::XButton2);
+	EZWIN32_CASE_APPEND_STR(result, stateFlags, MouseState::Shift);
+	EZWIN32_CASE_APPEND_STR(result, stateFlags, MouseState::Ctrl);
+
+	return result.empty() ? "MouseState::None" : result;
+}
+
+
+std::string easywin32::to_string(Flags<RawMouseButton> buttonFlags)
+{
+	std::string result;
+
+	EZWIN32_CASE_APPEND_STR(result, buttonFlags, RawMouseButton::LeftDown);
+	EZWIN32_CASE_APPEND_STR(result, buttonFlags, RawMouseButton::LeftUp);
+	EZWIN32_CASE_APPEND_STR(result, buttonFlags, RawMouseButton::RightDown);
+	EZWIN32_CASE_APPEND_STR(result, buttonFlags, RawMouseButton::RightUp);
+	EZWIN32_CASE_APPEND_STR(result, buttonFlags, RawMouseButton::MiddleDown);
+	EZWIN32_CASE_APPEND_STR(result, buttonFlags, RawMouseButton::MiddleUp);
+	EZWIN32_CASE_APPEND_STR(result, buttonFlags, RawMouseButton::XButton1Down);
+	EZWIN32_CASE_APPEND_STR(result, buttonFlags, RawMouseButton::XButton1Up);
+	EZWIN32_CASE_APPEND_STR(result, buttonFlags, RawMouseButton::XButton2Down);
+	EZWIN32_CASE_APPEND_STR(result, buttonFlags, RawMouseButton::XButton2Up);
+
+	return result.empty() ? "RawMouseButton::None" : result;
+}
+
+
+const char * easywin32::to_string(MouseAction action)
+{
+	switch (action)
+	{
+		EZWIN32_CASE_TO_STR(MouseAction::Up);
+		EZWIN32_CASE_TO_STR(MouseAction::Down);
+		EZWIN32_CASE_TO_STR(MouseAction::DoubleClick);
+		default:	return "MouseAction::Unknown";
+	}
+}
+
+
+const char * easywin32::to_string(KeyAction action)
+{
+	switch (action)
+	{
+		EZWIN32_CASE_TO_STR(KeyAction::Press);
+		EZWIN32_CASE_TO_STR(KeyAction::Repeat);
+		EZWIN32_CASE_TO_STR(KeyAction::Release);
+		default:	return "KeyAction::Unknown";
+	}
+}
+
+
+const char * easywin32::to_string(Cursor cursor)
+{
+	switch (cursor)
+	{
+		EZWIN32_CASE_TO_STR(Cursor::None);
+		EZWIN32_CASE_TO_STR(Cursor::Wait);
+		EZWIN32_CASE_TO_STR(Cursor::Hand);
+		EZWIN32_CASE_TO_STR(Cursor::Help);
+		EZWIN32_CASE_TO_STR(Cursor::Arrow);
+		EZWIN32_CASE_TO_STR(Cursor::Cross);
+		EZWIN32_CASE_TO_STR(Cursor::IBeam);
+		EZWIN32_CASE_TO_STR(Cursor::SizeWE);
+		EZWIN32_CASE_TO_STR(Cursor::SizeNS);
+		EZWIN32_CASE_TO_STR(Cursor::SizeAll);
+		EZWIN32_CASE_TO_STR(Cursor::UpArrow);
+		EZWIN32_CASE_TO_STR(Cursor::SizeNWSE);
+		EZWIN32_CASE_TO_STR(Cursor::SizeNESW);
+		EZWIN32_CASE_TO_STR(Cursor::AppStarting);
+		default:	return "Cursor::Unknown";
+	}
+}
+
+
+const char * easywin32::to_string(HitTestResult result)
+{
+	switch (result)
+	{
+		EZWIN32_CASE_TO_STR(HitTestResult::Nowhere);
+		EZWIN32_CASE_TO_STR(HitTestResult::Client);
+		EZWIN32_CASE_TO_STR(HitTestResult::Caption);
+		EZWIN32_CASE_TO_STR(HitTestResult::SystemMenu);
+		EZWIN32_CASE_TO_STR(HitTestResult::GrowBox);
+		EZWIN32_CASE_TO_STR(HitTestResult::Menu);
+		EZWIN32_CASE_TO_STR(HitTestResult::HScroll);
+		EZWIN32_CASE_TO_STR(HitTestResult::VScroll);
+		EZWIN32_CASE_TO_STR(HitTestResult::MinButton);
+		EZWIN32_CASE_TO_STR(HitTestResult::MaxButton);
+		EZWIN32_CASE_TO_STR(HitTestResult::Left);
+		EZWIN32_CASE_TO_STR(HitTestResult::Right);
+		EZWIN32_CASE_TO_STR(HitTestResult::Top);
+		EZWIN32_CASE_TO_STR(HitTestResult::TopLeft);
+		EZWIN32_CASE_TO_STR(HitTestResult::TopRight);
+		EZWIN32_CASE_TO_STR(HitTestResult::Bottom);
+		EZWIN32_CASE_TO_STR(HitTestResult::BottomLeft);
+		EZWIN32_CASE_TO_STR(HitTestResult::BottomRight);
+		EZWIN32_CASE_TO_STR(HitTestResult::Border);
+		EZWIN32_CASE_TO_STR(HitTestResult::CloseButton);
+		EZWIN32_CASE_TO_STR(HitTestResult::HelpButton);
+		EZWIN32_CASE_TO_STR(HitTestResult::Default);
+		default:	return "HitTestResult::Unknown";
+	}
+}
+
+
+const char * easywin32::to_string(Visibility visibility)
+{
+	switch (visibility)
+	{
+		EZWIN32_CASE_TO_STR(Visibility::Visible);
+		EZWIN32_CASE_TO_STR(Visibility::Hidden);
+		EZWIN32_CASE_TO_STR(Visibility::Minimized);
+		EZWIN32_CASE_TO_STR(Visibility::Cloaked);
+		EZWIN32_CASE_TO_STR(Visibility::SessionLocked);
+		EZWIN32_CASE_TO_STR(Visibility::Occluded);
+		default:	return "Visibility::Unknown";
+	}
+}
+
 /**
  *	@brief		Static window procedure for message dispatching.
  *	@details	This function is registered with the Win32 API as the window procedure
@@ -1289,695 +3173,4065 @@ private:
  *		- On `WM_DESTROY`, a quit message is posted to end the application loop.
  *		- For other messages, the stored Window pointer is used to dispatch events to registered callbacks (e.g., onClose, onResize, onMouseClick).
  */
-template<bool SkipCaption> LRESULT easywin32::Window::procedure(HWND hWnd, UINT uMsg, WPARAM wParam, LPARAM lParam)
+template<bool SkipCaption> LRESULT easywin32::Window::procedure(HWND hWnd, UINT uMsg, WPARAM wParam, LPARAM lParam)
+{
+	// Retrieve the stored Window* from the window's user data
+	auto window = reinterpret_cast<Window*>(::GetWindowLongPtr(hWnd, GWLP_USERDATA));
+
+	if (uMsg == WM_CREATE)	// Retrieve the use pointer
+	{
+		CREATESTRUCT * createStrcut = reinterpret_cast<CREATESTRUCT*>(lParam);
+
+		::SetWindowLongPtr(hWnd, GWLP_USERDATA, reinterpret_cast<LONG_PTR>(createStrcut->lpCreateParams));
+	}
+	else if (uMsg == WM_NCCALCSIZE)
+	{
+		if constexpr (SkipCaption)
+		{
+			// When skipping the caption area, adjust the client region manually.
+			NCCALCSIZE_PARAMS * params = (NCCALCSIZE_PARAMS*)lParam;
+
+			long top = params->rgrc[0].top;		// Backup original top value
+
+			// Let the default window proc calculate the base frame
+			LRESULT res = ::DefWindowProc(hWnd, uMsg, wParam, lParam);
+
+			if (::IsZoomed(hWnd))
+			{
+				const int frameSize = ::MulDiv(8, details::DpiFunctions::windowDpi(hWnd), USER_DEFAULT_SCREEN_DPI);		//	win32 default size for drag, at 96 DPI
+
+				// When maximized, keep a small draggable frame area at the top
+				params->rgrc[0].top = top + frameSize;
+			}
+			else
+			{
+				// Otherwise, keep the top edge unchanged to fully skip caption area
+				params->rgrc[0].top = top;
+			}
+
+			return res;
+		}
+	}
+	else if (uMsg == WM_GETMINMAXINFO)
+	{
+		if (window != nullptr)
+		{
+			MINMAXINFO * mmi = (MINMAXINFO*)lParam;
+
+			mmi->ptMinTrackSize.x = window->m_minTrackSize.cx;
+			mmi->ptMinTrackSize.y = window->m_minTrackSize.cy;
+			mmi->ptMaxTrackSize.x = window->m_maxTrackSize.cx;
+			mmi->ptMaxTrackSize.y = window->m_maxTrackSize.cy;
+
+			return 0;
+		}
+	}
+	else if ((uMsg == Window::postedTasksMessage()) && (window != nullptr))
+	{
+		//	the registered message is known to every process, only honor close requests carrying this process token
+		if (wParam == Window::CloseRequest)
+		{
+			if (lParam == Window::closeRequestToken())
+				window->close();
+		}
+		else
+		{
+			window->runPostedTasks();
+		}
+
+		return 0;
+	}
+	else if ((uMsg == Window::occlusionStatusMessage()) && (window != nullptr))
+	{
+		window->setOccluded((window->m_presenter != nullptr) && window->m_presenter->testOcclusion());
+
+		return 0;
+	}
+	else if (uMsg == WM_DESTROY)	// Handle window destruction
+	{
+		if ((window == nullptr) || window->m_quitOnClose)
+		{
+			::PostQuitMessage(0);		// Post a quit message to end the application message loop
+		}
+		
+		return 0;	// Message handled
+	}
+	else if (window != nullptr)
+	{
+		window->updateCachedState(uMsg, wParam, lParam);
+
+		if ((window->m_recorder != nullptr) && !window->m_replaying && EventRecorder::isRecorded(uMsg))
+		{
+			window->m_recorder->record(uMsg, wParam, lParam);
+		}
+
+		if (window->m_inputQueue != nullptr)
+		{
+			window->m_inputQueue->push(uMsg, wParam, lParam);
+		}
+
+	#ifdef EZWIN32_ENABLE_PROFILER
+		LARGE_INTEGER startTime = {};		::QueryPerformanceCounter(&startTime);
+	#endif
+
+		Result result = Window::dispatch(window, uMsg, wParam, lParam);
+
+	#ifdef EZWIN32_ENABLE_PROFILER
+		LARGE_INTEGER endTime = {};			::QueryPerformanceCounter(&endTime);
+
+		window->m_profiler.record(uMsg, endTime.QuadPart - startTime.QuadPart);
+
+		#ifdef EZWIN32_ENABLE_TRACELOGGING
+			TraceLoggingWrite(g_easywin32TraceProvider, "Dispatch",
+							  TraceLoggingPointer(hWnd, "Window"),
+							  TraceLoggingUInt32(uMsg, "Message"),
+							  TraceLoggingInt64(endTime.QuadPart - startTime.QuadPart, "DurationTicks"));
+		#endif
+	#endif
+
+		if (result != -1)
+			return result;
+	}
+
+	//	Default handling for unprocessed messages
+	return ::DefWindowProc(hWnd, uMsg, wParam, lParam);
+}
+
+
+/**
+ *	@brief		Keeps the shadow copy of the window state in sync, called by `procedure` before dispatching.
+ *	@details	Covers changes made by the user, by Win32 and by code outside of `Window` (e.g. `SetWindowLongPtr`),
+ *				so that the hot-path getters are plain member loads. Replayed messages do not go through here.
+ */
+void easywin32::Window::updateCachedState(UINT uMsg, WPARAM wParam, LPARAM lParam)
+{
+	switch (uMsg)
+	{
+		case WM_SIZE:
+		{
+			m_clientExtent = Size{ LOWORD(lParam), HIWORD(lParam) };
+
+			if ((wParam == SIZE_RESTORED) || (wParam == SIZE_MINIMIZED) || (wParam == SIZE_MAXIMIZED))
+			{
+				m_dwStyle &= ~static_cast<DWORD>(WS_MINIMIZE | WS_MAXIMIZE);
+
+				if (wParam == SIZE_MINIMIZED)			m_dwStyle |= WS_MINIMIZE;
+				else if (wParam == SIZE_MAXIMIZED)		m_dwStyle |= WS_MAXIMIZE;
+			}
+
+			this->updateVisibility();
+
+			break;
+		}
+		case WM_MOVE:
+		{
+			m_clientPos = Point{ GET_X_LPARAM(lParam), GET_Y_LPARAM(lParam) };		// Screen coordinates (not used for WS_CHILD)
+
+			break;
+		}
+		case WM_WINDOWPOSCHANGED:		// WM_SHOWWINDOW is not sent for SW_SHOWNORMAL, the flags here always are
+		{
+			auto windowPos = reinterpret_cast<const WINDOWPOS*>(lParam);
+
+			if (windowPos->flags & SWP_SHOWWINDOW)		m_dwStyle |= WS_VISIBLE;
+			if (windowPos->flags & SWP_HIDEWINDOW)		m_dwStyle &= ~static_cast<DWORD>(WS_VISIBLE);
+
+			this->updateVisibility();
+
+			break;
+		}
+		case WM_STYLECHANGED:
+		{
+			auto styles = reinterpret_cast<const STYLESTRUCT*>(lParam);
+
+			if (static_cast<int>(wParam) == GWL_STYLE)			m_dwStyle = styles->styleNew;
+			else if (static_cast<int>(wParam) == GWL_EXSTYLE)		m_dwExStyle = styles->styleNew;
+
+			this->updateVisibility();
+
+			break;
+		}
+		case WM_WTSSESSION_CHANGE:
+		{
+			if (wParam == WTS_SESSION_LOCK)				m_sessionLocked = true;
+			else if (wParam == WTS_SESSION_UNLOCK)		m_sessionLocked = false;
+
+			this->updateVisibility();
+
+			break;
+		}
+		case WM_DPICHANGED:
+		{
+			m_dpi = HIWORD(wParam);		// X and Y DPI are always equal
+
+			break;
+		}
+		case WM_NCDESTROY:		// Last message of the window, also when destroyed by `DefWindowProc` or at thread exit
+		{
+			this->killPreciseTimers();		// Before the handle is cleared, the scheduler thread may be posting to it
+
+			if (m_enableRawMouse || m_enableRawKeyboard)
+			{
+				this->enableRawInput(false, false);		// Hands the input back to another window of the process
+			}
+
+			this->unwatchVisibility();
+
+			this->clearPostedTasks();
+
+			m_hWnd = nullptr;
+
+			break;
+		}
+	}
+}
+
+
+//!	@brief	Returns the `Window` that opened `hWnd`, identified by the window procedure of its class.
+easywin32::Window * easywin32::Window::fromHandle(HWND hWnd)
+{
+	auto proc = reinterpret_cast<WNDPROC>(::GetClassLongPtr(hWnd, GCLP_WNDPROC));
+
+	if ((proc != &Window::procedure<true>) && (proc != &Window::procedure<false>))
+		return nullptr;
+
+	return reinterpret_cast<Window*>(::GetWindowLongPtr(hWnd, GWLP_USERDATA));
+}
+
+
+/**
+ *	@brief		Dispatches a message to the callbacks of `window`.
+ *	@details	Called by `procedure` for every message that is not handled internally, and by `replay`.
+ *	@return		The result of the callback, or `-1` if the message is not handled (`DefWindowProc` is then called).
+ */
+easywin32::Result easywin32::Window::dispatch(Window * window, UINT uMsg, WPARAM wParam, LPARAM lParam)
+{
+	Result result = -1;
+
+	// Forward messages to the user-defined callback first.
+	if (window->forwardMessage)
+	{
+		result = window->forwardMessage(window->m_hWnd, uMsg, wParam, lParam);
+
+		if (result != -1)
+			return result;
+	}
+
+	//	Dispatch standard messages to callbacks
+	switch (uMsg)
+	{
+		case WM_CLOSE:			if (window->onClose)			result = window->onClose();			break;
+		case WM_PAINT:
+		{
+			if (window->onPaint)
+			{
+				result = window->onPaint();
+			}
+			else if (window->m_framebuffer.isValid())
+			{
+				window->paintFramebuffer();
+
+				result = 0;
+			}
+
+			break;
+		}
+		case WM_TIMER:
+		{
+			if (wParam == window->liveResizeTimerId())
+			{
+				if (window->m_frameTick)				window->m_frameTick();
+				else if (window->onLiveResizeTick)		window->onLiveResizeTick();
+
+				result = 0;
+			}
+			else if (window->onTimer)
+			{
+				result = window->onTimer(wParam);
+			}
+
+			break;
+		}
+		case WM_SETFOCUS:		if (window->onFocus)			result = window->onFocus(true);		break;
+		case WM_KILLFOCUS:		if (window->onFocus)			result = window->onFocus(false);	break;
+		case WM_MOUSELEAVE:		if (window->onMouseLeave)		result = window->onMouseLeave();	break;
+		case WM_EXITSIZEMOVE:
+		{
+			if (window->m_inSizeMove)
+			{
+				::KillTimer(window->m_hWnd, window->liveResizeTimerId());
+
+				window->m_inSizeMove = false;
+
+				if (window->m_resizePending && !window->isMinimized())
+				{
+					window->resizeSurfaces(window->m_clientExtent.cx, window->m_clientExtent.cy);
+
+					::InvalidateRect(window->m_hWnd, nullptr, FALSE);
+				}
+
+				window->m_resizePending = false;
+			}
+
+			if (window->onExitMove)		result = window->onExitMove();
+
+			break;
+		}
+		case WM_ENTERSIZEMOVE:
+		{
+			if (window->m_enableLiveResize)
+			{
+				window->m_inSizeMove = true;
+
+				::SetTimer(window->m_hWnd, window->liveResizeTimerId(), window->m_liveResizeInterval, nullptr);
+			}
+
+			if (window->onEnterMove)	result = window->onEnterMove();
+
+			break;
+		}
+
+		case WM_CHAR:			if (window->onInputCharacter)	result = window->onInputCharacter(static_cast<wchar_t>(wParam));	break;
+		case WM_SYSCHAR:		if (window->onInputCharacter)	result = window->onInputCharacter(static_cast<wchar_t>(wParam));	break;
+		case WM_UNICHAR:		if (window->onInputCharacter)	result = window->onInputCharacter(static_cast<wchar_t>(wParam));	break;
+
+		case WM_MOVE:			if (window->onMove)				result = window->onMove(GET_X_LPARAM(lParam), GET_Y_LPARAM(lParam));				break;
+		case WM_DPICHANGED:
+		{
+			// Per-monitor aware windows are not rescaled by Windows, apply the suggested rectangle (WM_SIZE follows)
+			auto rect = reinterpret_cast<const RECT*>(lParam);
+
+			::SetWindowPos(window->m_hWnd, nullptr, rect->left, rect->top, rect->right - rect->left, rect->bottom - rect->top, SWP_NOZORDER | SWP_NOACTIVATE);
+
+			result = window->onDpiChanged ? window->onDpiChanged(HIWORD(wParam)) : 0;
+
+			break;
+		}
+		case WM_SIZE:
+		{
+			// Keep the framebuffer and presenter in sync with the client area (skip the 0x0 extent reported when minimized),
+			// once the size settles during a live resize
+			if (window->m_inSizeMove)
+			{
+				window->m_resizePending = true;
+			}
+			else if (wParam != SIZE_MINIMIZED)
+			{
+				window->resizeSurfaces(GET_X_LPARAM(lParam), GET_Y_LPARAM(lParam));
+			}
+
+			if (window->onResize)
+			{
+				result = window->onResize(GET_X_LPARAM(lParam), GET_Y_LPARAM(lParam));
+			}
+
+			break;
+		}
+		case WM_NCHITTEST:		if (window->onHitTest)			result = (Result)window->onHitTest(GET_X_LPARAM(lParam), GET_Y_LPARAM(lParam));		break;
+
+		case WM_KEYUP:			if (window->onKeyboardPress)	result = window->onKeyboardPress(static_cast<Key>(wParam), KeyAction::Release);		break;
+		case WM_SYSKEYUP:		if (window->onKeyboardPress)	result = window->onKeyboardPress(static_cast<Key>(wParam), KeyAction::Release);		break;
+
+		case WM_KEYDOWN:		if (window->onKeyboardPress)	result = window->onKeyboardPress(static_cast<Key>(wParam), (lParam & (1 << 30)) ? KeyAction::Repeat : KeyAction::Press);		break;
+		case WM_SYSKEYDOWN:		if (window->onKeyboardPress)	result = window->onKeyboardPress(static_cast<Key>(wParam), (lParam & (1 << 30)) ? KeyAction::Repeat : KeyAction::Press);		break;
+
+		case WM_MOUSEMOVE:
+		{
+			if (window->onMouseMoveHistory)
+			{
+				if (window->m_replaying)		// The live history has nothing to do with the recorded point
+					window->m_moveHistory.assign(1, Point{ GET_X_LPARAM(lParam), GET_Y_LPARAM(lParam) });
+				else
+					window->collectMouseMoveHistory(GET_X_LPARAM(lParam), GET_Y_LPARAM(lParam));
+
+				result = window->onMouseMoveHistory(window->m_moveHistory.data(), window->m_moveHistory.size(), static_cast<MouseState>(wParam & 127));
+			}
+			else if (window->onMouseMove)
+			{
+				result = window->onMouseMove(GET_X_LPARAM(lParam), GET_Y_LPARAM(lParam), static_cast<MouseState>(wParam & 127));
+			}
+
+			break;
+		}
+		case WM_MOUSEWHEEL:		if (window->onWheelScroll)		result = window->onWheelScroll(0, static_cast<SHORT>(HIWORD(wParam)) / WHEEL_DELTA, static_cast<MouseState>(wParam & 127));		break;
+		case WM_MOUSEHWHEEL:	if (window->onWheelScroll)		result = window->onWheelScroll(static_cast<SHORT>(HIWORD(wParam)) / WHEEL_DELTA, 0, static_cast<MouseState>(wParam & 127));		break;
+
+		case WM_LBUTTONUP:		if (window->onMouseClick)		result = window->onMouseClick(MouseButton::Left, MouseAction::Up, static_cast<MouseState>(wParam & 127));		break;
+		case WM_RBUTTONUP:		if (window->onMouseClick)		result = window->onMouseClick(MouseButton::Right, MouseAction::Up, static_cast<MouseState>(wParam & 127));		break;
+		case WM_MBUTTONUP:		if (window->onMouseClick)		result = window->onMouseClick(MouseButton::Middle, MouseAction::Up, static_cast<MouseState>(wParam & 127));		break;
+
+		case WM_LBUTTONDOWN:	if (window->onMouseClick)		result = window->onMouseClick(MouseButton::Left, MouseAction::Down, static_cast<MouseState>(wParam & 127));			break;
+		case WM_RBUTTONDOWN:	if (window->onMouseClick)		result = window->onMouseClick(MouseButton::Right, MouseAction::Down, static_cast<MouseState>(wParam & 127));		break;
+		case WM_MBUTTONDOWN:	if (window->onMouseClick)		result = window->onMouseClick(MouseButton::Middle, MouseAction::Down, static_cast<MouseState>(wParam & 127));		break;
+
+		case WM_LBUTTONDBLCLK:	if (window->onMouseClick)		result = window->onMouseClick(MouseButton::Left, MouseAction::DoubleClick, static_cast<MouseState>(wParam & 127));		break;
+		case WM_RBUTTONDBLCLK:	if (window->onMouseClick)		result = window->onMouseClick(MouseButton::Right, MouseAction::DoubleClick, static_cast<MouseState>(wParam & 127));		break;
+		case WM_MBUTTONDBLCLK:	if (window->onMouseClick)		result = window->onMouseClick(MouseButton::Middle, MouseAction::DoubleClick, static_cast<MouseState>(wParam & 127));	break;
+
+		case WM_XBUTTONUP:
+		case WM_XBUTTONDOWN:
+		case WM_XBUTTONDBLCLK:
+		{
+			if (window->onMouseClick)
+			{
+				auto button = GET_XBUTTON_WPARAM(wParam);
+
+				auto action = (uMsg == WM_XBUTTONUP) ? MouseAction::Up : (uMsg == WM_XBUTTONDOWN) ? MouseAction::Down : MouseAction::DoubleClick;
+
+				if (button == XBUTTON1)
+				{
+					result = window->onMouseClick(MouseButton::XButton1, action, static_cast<MouseState>(wParam & 127));
+				}
+				else if (button == XBUTTON2)
+				{
+					result = window->onMouseClick(MouseButton::XButton2, action, static_cast<MouseState>(wParam & 127));
+				}
+			}
+
+			break;
+		}
+		case WM_INPUT:
+		{
+			RAWINPUT rawInput = {};
+
+			UINT size = sizeof(rawInput);
+
+			// Packets larger than `RAWINPUT` (HID devices) are not dispatched
+			if (::GetRawInputData(reinterpret_cast<HRAWINPUT>(lParam), RID_INPUT, &rawInput, &size, sizeof(RAWINPUTHEADER)) != static_cast<UINT>(-1))
+			{
+				window->dispatchRawInput(rawInput);
+			}
+
+			window->processRawInput();
+
+			break;		// `DefWindowProc` must still be called to release the raw input data
+		}
+		case WM_DROPFILES:
+		{
+			HDROP hDrop = (HDROP)wParam;
+
+			if (window->onDropPaths)
+			{
+				window->collectDropPaths(hDrop);
+
+				result = window->onDropPaths(window->m_dropPaths.data(), window->m_dropPaths.size());
+			}
+			else if (window->onDropFiles)
+			{
+				window->collectDropPaths(hDrop);
+
+				std::vector<string_type> filePaths(window->m_dropPaths.begin(), window->m_dropPaths.end());
+
+				result = window->onDropFiles(filePaths);
+			}
+
+			::DragFinish(hDrop);
+
+			break;
+		}
+	}
+
+	return result;
+}
+
+
+/**
+ *	@brief		Internal method to create a Win32 window with specified parameters.
+ *	@details	Creates a window using `CreateWindowEx` with the provided title, styles, and dimensions.
+ *				Registers a window class (either "EasyWin32" or "EasyWin32-NoTitleBar" based on EraseTitleBar)
+ *				to handle message dispatching. The window class is registered once per application lifetime and
+ *				unregistered upon destruction. Stores the window handle in m_hWnd and associates this Window instance
+ *				with the native handle for message processing.
+ *	@tparam		SkipCaption - If true, registers a window class without a title bar.
+ *	@param[in]	title - The window title text, displayed in the title bar (if applicable).
+ *	@param[in]	dwStyle - The native window style flags (e.g., WS_OVERLAPPEDWINDOW, WS_POPUP).
+ *	@param[in]	dwExStyle - The native extended window style flags (e.g., WS_EX_LAYERED, WS_EX_TOPMOST).
+ *	@param[in]	x - The x-coordinate of the window's top-left corner in screen coordinates (e.g., CW_USEDEFAULT).
+ *	@param[in]	y - The y-coordinate of the window's top-left corner in screen coordinates (e.g., CW_USEDEFAULT).
+ *	@param[in]	w - The width of the window in pixels, including non-client areas.
+ *	@param[in]	h - The height of the window in pixels, including non-client areas.
+ *	@note		The window class is registered only once per application, ensuring efficient resource usage.
+ *	@note		If the window class registration fails, an assertion is triggered.
+ */
+template<bool SkipCaption> void easywin32::Window::internalOpen(string_type title, DWORD dwStyle, DWORD dwExStyle, int x, int y, int w, int h)
+{
+	/**
+	 *	@brief	Static window class wrapper for Win32 window registration.
+	 *
+	 *	This struct inherits from `WNDCLASSEX` and is used to register a single
+	 *	window class with the Win32 API. The class is automatically registered
+	 *	upon construction and unregistered upon destruction. This ensures that
+	 *	the registration occurs only once during the application's lifetime.
+	 */
+	static struct NativeClass : public WNDCLASSEX
+	{
+		bool isRegistered;
+
+		NativeClass() : isRegistered(false)
+		{
+			cbSize			= sizeof(WNDCLASSEXW);
+			style			= CS_HREDRAW | CS_VREDRAW | CS_DBLCLKS;
+			lpfnWndProc		= Window::procedure<SkipCaption>;
+			cbClsExtra		= 0;
+			cbWndExtra		= 0;
+			hInstance		= ::GetModuleHandle(NULL);
+			hIcon			= ::LoadIcon(NULL, IDI_APPLICATION);
+			hCursor			= NULL;
+			hbrBackground	= (HBRUSH)::GetStockObject(NULL_BRUSH);
+			lpszMenuName	= NULL;
+			hIconSm			= ::LoadIcon(NULL, IDI_WINLOGO);
+		#ifdef UNICODE
+			lpszClassName	= SkipCaption ? L"EasyWin32-SkipCaption" : L"EasyWin32";
+		#else
+			lpszClassName	= SkipCaption ? "EasyWin32-SkipCaption" : "EasyWin32";
+		#endif
+			isRegistered	= ::RegisterClassEx(this);
+		}
+
+		~NativeClass()
+		{
+			if (isRegistered)
+			{
+				::UnregisterClass(lpszClassName, hInstance);
+			}
+		}
+	} s_win32Class;
+
+	assert(s_win32Class.isRegistered);
+
+	if (s_win32Class.isRegistered)
+	{
+		m_hWnd = ::CreateWindowEx(dwExStyle, s_win32Class.lpszClassName, title.c_str(), dwStyle,
+								  x, y, w, h, NULL, NULL, s_win32Class.hInstance,
+								  this /* Additional application data */);
+
+		//	Read back once, Win32 may add bits (e.g. WS_CLIPSIBLINGS), then kept in sync by `updateCachedState`
+		if (m_hWnd != nullptr)
+		{
+			m_dwStyle = static_cast<DWORD>(::GetWindowLongPtr(m_hWnd, GWL_STYLE));
+
+			m_dwExStyle = static_cast<DWORD>(::GetWindowLongPtr(m_hWnd, GWL_EXSTYLE));
+
+			m_dpi = details::DpiFunctions::windowDpi(m_hWnd);
+
+			Rect rect = {};		::GetClientRect(m_hWnd, &rect);
+
+			m_clientExtent = Size{ rect.right, rect.bottom };
+
+			m_clientPos = Point{ 0, 0 };		::ClientToScreen(m_hWnd, &m_clientPos);
+
+			this->watchVisibility();
+
+			m_postTarget = m_hWnd;
+		}
+
+		//! Keep in sync with the `m_opacity`.
+		if (dwExStyle & WS_EX_LAYERED)
+		{
+			this->setOpacity(m_opacity);
+		}
+	}
+}
+
+
+/**
+ *	@brief		Opens a new window with the specified title, bounds and styles.
+ *	@details	Creates a Win32 window using `CreateWindowEx`, applying the provided style flags and extended style flags.
+ *				Adjusts the window's bounding rectangle to account for non-client areas (e.g., borders, title bar) based on the style flags.
+ *				If the window is already open (m_hWnd is valid), this method does nothing. Stores the window handle and updates m_styleFlags and m_bounds.
+ *	@param[in]	title - The title of the window.
+ *	@param[in]	bounds - The rectangular area defining the window's position (left, top) and bounds (right, bottom) in screen coordinates.
+ *	@param[in]	styleFlags - The combination of window styles (e.g., `Style::OverlappedWindow`). Defaults to `Style::OverlappedWindow`.
+ *	@param[in]	exStyleFlags - The combination of extended window styles (e.g., ExStyle::Layered, ExStyle::TopMost). Defaults to 0 (no extended styles).
+ */
+void easywin32::Window::open(string_type title, Rect bounds, Flags<Style> styleFlags, Flags<ExStyle> exStyleFlags)
+{
+	if (::IsWindow(m_hWnd) != 0)	return;
+
+	const int clientWidth = bounds.right - bounds.left;
+	const int clientHeight = bounds.bottom - bounds.top;
+
+	DWORD dwStyle = Window::toNativeStyle(styleFlags);
+
+	if (Window::shouldSkipCaption(styleFlags))
+	{
+		m_skipCaption = true;
+
+		Window::adjustWindowRect<true>(bounds, dwStyle, exStyleFlags, details::DpiFunctions::systemDpi());
+
+		this->internalOpen<true>(title, dwStyle, exStyleFlags, bounds.left, bounds.top,
+								 bounds.right - bounds.left, bounds.bottom - bounds.top);
+	}
+	else
+	{
+		m_skipCaption = false;
+
+		Window::adjustWindowRect<false>(bounds, dwStyle, exStyleFlags, details::DpiFunctions::systemDpi());
+
+		this->internalOpen<false>(title, dwStyle, exStyleFlags, bounds.left, bounds.top,
+								  bounds.right - bounds.left, bounds.bottom - bounds.top);
+	}
+
+	this->fitFrameToDpi(clientWidth, clientHeight);
+}
+
+
+/**
+ *	@brief		Opens a new window with the specified title, size and styles.
+ *	@details	Creates a Win32 window using `CreateWindowEx`, applying the provided style flags and extended style flags.
+ *				The window is positioned at default screen coordinates (CW_USEDEFAULT) and sized according to the provided Size structure.
+ *				Adjusts the window's bounding rectangle to account for non-client areas (e.g., borders, title bar) based on the style flags.
+ *				If the window is already open (m_hWnd is valid), this method does nothing. Updates m_styleFlags and m_bounds accordingly.
+ *	@param[in]	title - The title of the window.
+ *	@param[in]	with - The with of the window in pixels.
+ *	@param[in]	height - The height of the window in pixels.
+ *	@param[in]	styleFlags - The combination of window styles (e.g., `Style::OverlappedWindow`). Defaults to `Style::OverlappedWindow`.
+ *	@param[in]	exStyleFlags - The combination of extended window styles (e.g., `ExStyle::Layered`, `ExStyle::TopMost`). Defaults to 0 (no extended styles).
+ *	@note		The window is created at default screen coordinates (CW_USEDEFAULT). Use setPos to specify a custom position.
+ */
+void easywin32::Window::open(string_type title, int width, int height, Flags<Style> styleFlags, Flags<ExStyle> exStyleFlags)
+{
+	if (::IsWindow(m_hWnd) != 0)	return;
+
+	RECT bounds = { 0, 0, width, height };
+
+	DWORD dwStyle = Window::toNativeStyle(styleFlags);
+
+	if (Window::shouldSkipCaption(styleFlags))
+	{
+		m_skipCaption = true;
+
+		Window::adjustWindowRect<true>(bounds, dwStyle, exStyleFlags, details::DpiFunctions::systemDpi());
+
+		this->internalOpen<true>(title, dwStyle, exStyleFlags, CW_USEDEFAULT, CW_USEDEFAULT,
+								 bounds.right - bounds.left, bounds.bottom - bounds.top);
+	}
+	else
+	{
+		m_skipCaption = false;
+
+		Window::adjustWindowRect<false>(bounds, dwStyle, exStyleFlags, details::DpiFunctions::systemDpi());
+
+		this->internalOpen<false>(title, dwStyle, exStyleFlags, CW_USEDEFAULT, CW_USEDEFAULT,
+								  bounds.right - bounds.left, bounds.bottom - bounds.top);
+	}
+
+	this->fitFrameToDpi(width, height);
+}
+
+
+/**
+ *	@brief		Recomputes the frame if the window was created on a monitor whose DPI differs from the system DPI.
+ *	@details	`open` computes the frame before the window exists, with the system DPI. A per-monitor aware window
+ *				created on another monitor gets frame metrics of that monitor, so the requested client extent is
+ *				restored with the actual DPI. Unaware windows always report 96 DPI and are left untouched.
+ */
+void easywin32::Window::fitFrameToDpi(int clientWidth, int clientHeight)
+{
+	if ((m_hWnd != nullptr) && (m_dpi != details::DpiFunctions::systemDpi()))
+	{
+		auto pos = this->getClientPos();
+
+		this->setPos(pos.x, pos.y, pos.x + clientWidth, pos.y + clientHeight);
+	}
+}
+
+
+/**
+ *	@brief		Opens a new window described by `desc`, with all of its styles and DWM attributes applied before it is first shown.
+ *	@details	The window is created hidden, its DWM attributes are set in a single pass, and it is then shown only
+ *				if `desc.styleFlags` has `Style::Visible`.
+ */
+void easywin32::Window::open(const WindowDesc & desc)
+{
+	if (::IsWindow(m_hWnd) != 0)	return;
+
+	const Flags<Style> styleFlags = desc.styleFlags & ~Style::Visible;
+
+	if ((desc.pos.x == CW_USEDEFAULT) || (desc.pos.y == CW_USEDEFAULT))
+	{
+		this->open(desc.title, desc.width, desc.height, styleFlags, desc.exStyleFlags);
+	}
+	else
+	{
+		this->open(desc.title, Rect{ desc.pos.x, desc.pos.y, desc.pos.x + desc.width, desc.pos.y + desc.height }, styleFlags, desc.exStyleFlags);
+	}
+
+	if (m_hWnd == nullptr)	return;
+
+	if (desc.immersiveDarkMode)		this->enableImmersiveDarkMode(*desc.immersiveDarkMode);
+	if (desc.backdrop)				this->setBackdrop(*desc.backdrop);
+	if (desc.cornerStyle)			this->setCornerStyle(*desc.cornerStyle);
+	if (desc.captionColor)			this->setCaptionColor(*desc.captionColor);
+	if (desc.borderColor)			this->setBorderColor(*desc.borderColor);
+	if (desc.textColor)				this->setTextColor(*desc.textColor);
+
+	if (desc.styleFlags.has(Style::Visible))
+	{
+		this->show();
+	}
+}
+
+
+//! @brief	Adjust the given client rectangle based on window styles, extended styles and the DPI of the frame.
+template<bool SkipCaption> void easywin32::Window::adjustWindowRect(Rect & rect, DWORD dwStyle, DWORD dwExStyle, UINT dpi)
+{
+	auto top = rect.top;
+
+	details::DpiFunctions::adjustWindowRect(&rect, dwStyle, dwExStyle, dpi);
+
+	if constexpr (SkipCaption)
+	{
+		rect.top = top;		// Preserve top edge to skip caption adjustment
+	}
+}
+
+
+//! @brief	Convert easywin32 style flags to native Win32 window style bits.
+DWORD easywin32::Window::toNativeStyle(Flags<Style> styleFlags)
+{
+	DWORD dwStyle = WS_POPUP;	// Base style (Win32 auto-adds WS_CAPTION if not using WS_POPUP)
+	
+	if (styleFlags.has(Style::Border))
+		dwStyle |= WS_BORDER;
+
+	if (styleFlags.has(Style::Visible))
+		dwStyle |= WS_VISIBLE;
+
+	if (styleFlags.has(Style::SysMenu))
+		dwStyle |= WS_SYSMENU;
+
+	if (styleFlags.has(Style::Disabled))
+		dwStyle |= WS_DISABLED;
+
+	if (styleFlags.has(Style::Resizable))
+		dwStyle |= WS_THICKFRAME;
+
+	if (styleFlags.has(Style::MinimizeBox))
+		dwStyle |= WS_MINIMIZEBOX;
+
+	if (styleFlags.has(Style::MaximizeBox))
+		dwStyle |= WS_MAXIMIZEBOX;
+
+	// Add caption if explicitly requested or when thick frame is used (required by Win32 for proper window behavior)
+	if (styleFlags.has(Style::Caption) || styleFlags.has(Style::ThickFrame))
+		dwStyle |= WS_CAPTION;
+
+	return dwStyle;
+}
+
+
+//!	@brief	Gets styles of the window.
+easywin32::Flags<easywin32::Style> easywin32::Window::getStyleFlags() const
+{
+	DWORD dwStyle = m_dwStyle;
+
+	Flags<Style> style = 0;
+	
+	if ((dwStyle & WS_BORDER) == WS_BORDER)
+		style |= Style::Border;
+
+	if ((dwStyle & WS_VISIBLE) == WS_VISIBLE)
+		style |= Style::Visible;
+
+	if ((dwStyle & WS_SYSMENU) == WS_SYSMENU)
+		style |= Style::SysMenu;
+
+	if ((dwStyle & WS_DISABLED) == WS_DISABLED)
+		style |= Style::Disabled;
+
+	if ((dwStyle & WS_THICKFRAME) == WS_THICKFRAME)
+		style |= Style::Resizable;
+
+	if ((dwStyle & WS_MINIMIZEBOX) == WS_MINIMIZEBOX)
+		style |= Style::MinimizeBox;
+
+	if ((dwStyle & WS_MAXIMIZEBOX) == WS_MAXIMIZEBOX)
+		style |= Style::MaximizeBox;
+
+	if ((dwStyle & WS_CAPTION) == WS_CAPTION)
+	{
+		style |= Style::ThickFrame;
+
+		if (!m_skipCaption)
+			style |= Style::Caption;
+	}
+
+	return style;
+}
+
+
+//!	@brief	Rest style of the window, keeping its client rectangle.
+void easywin32::Window::setStyle(Flags<Style> styleFlags)
+{
+	m_dwStyle = Window::toNativeStyle(styleFlags);
+
+	m_skipCaption = Window::shouldSkipCaption(styleFlags);
+
+	::SetWindowLongPtr(m_hWnd, GWL_STYLE, static_cast<LONG_PTR>(m_dwStyle));
+
+	if (m_skipCaption)
+		::SetWindowLongPtr(m_hWnd, GWLP_WNDPROC, (LONG_PTR)Window::procedure<true>);
+	else
+		::SetWindowLongPtr(m_hWnd, GWLP_WNDPROC, (LONG_PTR)Window::procedure<false>);
+
+	this->requestLayout(LayoutRequest{ m_hWnd, {}, {}, false, false, true, true });
+}
+
+
+//!	@brief	Rest ex-style of the window.
+void easywin32::Window::setExStyle(Flags<ExStyle> styleFlags)
+{
+	m_dwExStyle = static_cast<DWORD>(styleFlags.mask);
+
+	::SetWindowLongPtr(m_hWnd, GWL_EXSTYLE, static_cast<LONG_PTR>(styleFlags.mask));
+
+	this->requestLayout(LayoutRequest{ m_hWnd, {}, {}, false, false, true, false });
+
+	//! Keep in sync with the `m_opacity`.
+	if (styleFlags.has(ExStyle::Layered))
+	{
+		this->setOpacity(m_opacity);
+	}
+}
+
+
+//!	@brief	Set position of the window.
+void easywin32::Window::setPos(int left, int top)
+{
+	//	Inside a layout transaction, the current position may already be overridden by a pending request
+	if (Window::layoutTransaction().depth == 0)
+	{
+		auto pos = this->getClientPos();
+
+		if ((pos.x == left) && (pos.y == top))
+			return;
+	}
+
+	this->requestLayout(LayoutRequest{ m_hWnd, Point{ left, top }, {}, true, false, false, false });
+}
+
+
+//!	@brief	Set position of the window.
+void easywin32::Window::setPos(int left, int top, int right, int bottom)
+{
+	if (Window::layoutTransaction().depth == 0)
+	{
+		auto extent = this->getClientExtent();
+
+		if ((right - left == extent.cx) && (bottom - top == extent.cy))
+		{
+			this->setPos(left, top);
+
+			return;
+		}
+	}
+
+	this->requestLayout(LayoutRequest{ m_hWnd, Point{ left, top }, Size{ right - left, bottom - top }, true, true, false, false });
+}
+
+
+//!	@brief	Centers the window in the current monitor's work area.
+void easywin32::Window::centerToScreen()
+{
+	HMONITOR hMon = ::MonitorFromWindow(m_hWnd, MONITOR_DEFAULTTONEAREST);
+	MONITORINFO mi = { sizeof(mi) };
+	::GetMonitorInfo(hMon, &mi);
+
+	auto extent = this->getClientExtent();
+
+	for (const auto & request : Window::layoutTransaction().requests)
+	{
+		if ((request.hWnd == m_hWnd) && request.size)
+			extent = request.extent;		// Pending resize
+	}
+
+	int workW = mi.rcWork.right - mi.rcWork.left;
+	int workH = mi.rcWork.bottom - mi.rcWork.top;
+	int winW = extent.cx;
+	int winH = extent.cy;
+
+	int x = mi.rcWork.left + (workW - winW) / 2;
+	int y = mi.rcWork.top + (workH - winH) / 2;
+
+	this->setPos(x, y);
+}
+
+
+/**
+ *	@brief		Applies `request` at once, or merges it into the layout transaction of the calling thread.
+ *	@details	Several requests for the same window are merged field by field, the latest winning.
+ */
+void easywin32::Window::requestLayout(const LayoutRequest & request)
+{
+	auto & transaction = Window::layoutTransaction();
+
+	if (transaction.depth == 0)
+	{
+		Window::applyLayout(request, nullptr);
+
+		return;
+	}
+
+	for (auto & pending : transaction.requests)
+	{
+		if (pending.hWnd == request.hWnd)
+		{
+			if (request.move)
+			{
+				pending.pos = request.pos;
+
+				pending.move = true;
+			}
+
+			if (request.size)
+			{
+				pending.extent = request.extent;
+
+				pending.size = true;
+			}
+
+			pending.frameChanged |= request.frameChanged;
+
+			pending.keepClient |= request.keepClient;
+
+			return;
+		}
+	}
+
+	transaction.requests.push_back(request);
+}
+
+
+/**
+ *	@brief		Applies `request` with `SetWindowPos`, or adds it to `hDwp` with `DeferWindowPos` if not null.
+ *	@details	The window rectangle is computed from the cached style bits, so no `GetWindowLongPtr` is involved.
+ *	@return		The handle returned by `DeferWindowPos` (null on failure), or `hDwp` if the window is closed.
+ */
+HDWP easywin32::Window::applyLayout(const LayoutRequest & request, HDWP hDwp)
+{
+	if (!::IsWindow(request.hWnd))
+		return hDwp;
+
+	auto window = reinterpret_cast<Window*>(::GetWindowLongPtr(request.hWnd, GWLP_USERDATA));
+
+	if (window == nullptr)
+		return hDwp;
+
+	Point pos = request.pos;
+	Size extent = request.extent;
+	UINT flags = SWP_NOZORDER;
+
+	if (request.keepClient)
+	{
+		if (!request.move)		pos = window->getClientPos();
+		if (!request.size)		extent = window->getClientExtent();
+	}
+	else
+	{
+		if (!request.move)		flags |= SWP_NOMOVE;
+		if (!request.size)		flags |= SWP_NOSIZE;
+	}
+
+	if (request.frameChanged)
+		flags |= SWP_FRAMECHANGED;
+	else if (!request.size)
+		flags |= SWP_NOREDRAW;		// Moving only, DWM keeps the content
+
+	Rect rect = { pos.x, pos.y, pos.x + extent.cx, pos.y + extent.cy };
+
+	if (window->m_skipCaption)
+		Window::adjustWindowRect<true>(rect, window->m_dwStyle, window->m_dwExStyle, window->m_dpi);
+	else
+		Window::adjustWindowRect<false>(rect, window->m_dwStyle, window->m_dwExStyle, window->m_dpi);
+
+	if (hDwp != nullptr)
+	{
+		return ::DeferWindowPos(hDwp, request.hWnd, NULL, rect.left, rect.top, rect.right - rect.left, rect.bottom - rect.top, flags);
+	}
+
+	::SetWindowPos(request.hWnd, NULL, rect.left, rect.top, rect.right - rect.left, rect.bottom - rect.top, flags);
+
+	return nullptr;
+}
+
+
+/**
+ *	@brief		Closes and destroys the window.
+ *	@details	Calls DestroyWindow to close the window and releases the associated window handle (m_hWnd),
+ *				together with the GDI resources owned by the window (framebuffer, cached update region).
+ */
+void easywin32::Window::close()
+{
+	//	DestroyWindow fails on windows of other threads, let the owning thread close it
+	if ((m_hWnd != nullptr) && ::IsWindow(m_hWnd) && (::GetWindowThreadProcessId(m_hWnd, nullptr) != ::GetCurrentThreadId()))
+	{
+		//	bounded wait: the owning thread may be blocked on this one (a posted task that joins it, an `invoke` in
+		//	progress), on timeout the sent message stays queued and is processed once the owning thread pumps again
+		::SendMessageTimeout(m_hWnd, Window::postedTasksMessage(), Window::CloseRequest, Window::closeRequestToken(),
+							 SMTO_NORMAL | SMTO_ABORTIFHUNG, Window::CrossThreadCloseTimeout, nullptr);
+
+		return;
+	}
+
+	//	Before the handle is destroyed, producers may be posting to it
+	this->clearPostedTasks();
+
+	::DestroyWindow(m_hWnd);
+
+	this->killPreciseTimers();
+
+	this->unwatchVisibility();
+
+	m_hWnd = nullptr;
+
+	m_enableBlurBeind = false;
+
+	m_inSizeMove = m_resizePending = false;
+
+	m_framebuffer.release();
+
+	this->unshareFramebuffer();
+
+	m_layeredSurface.release();
+
+	m_layeredContent = false;
+
+	if (m_enableRawMouse || m_enableRawKeyboard)
+	{
+		this->enableRawInput(false, false);
+	}
+
+	if (m_hUpdateRgn != nullptr)
+	{
+		::DeleteObject(m_hUpdateRgn);
+
+		m_hUpdateRgn = nullptr;
+	}
+}
+
+
+/**
+ *	@brief		Posts a task to be run on the thread that owns the window. Can be called from any thread.
+ *	@return		`false` if the window is not open (the task is discarded).
+ */
+bool easywin32::Window::post(Callback<void()> task)
+{
+	if (!task)
+	{
+		return false;
+	}
+
+	//	Announced before reading the handle: `clearPostedTasks` waits for this call before its final drain
+	m_postsInFlight.fetch_add(1);
+
+	HWND hWnd = m_postTarget.load();
+
+	if (hWnd == nullptr)
+	{
+		m_postsInFlight.fetch_sub(1);
+
+		return false;
+	}
+
+	bool isWoken = true;
+
+	PostedTask * node = new PostedTask{ std::move(task), m_postedTasks.load(std::memory_order_relaxed) };
+
+	while (!m_postedTasks.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed));
+
+	//	Only the first task of a batch wakes up the window thread
+	if (!m_wakePending.exchange(true))
+	{
+		if (!::PostMessage(hWnd, Window::postedTasksMessage(), 0, 0))
+		{
+			m_wakePending = false;
+
+			isWoken = false;
+		}
+	}
+
+	m_postsInFlight.fetch_sub(1);
+
+	return isWoken;
+}
+
+
+namespace easywin32
+{
+	namespace details
+	{
+		/**
+		 *	@brief		Windows of the process registered for raw input, per device class (mouse, keyboard).
+		 *	@details	Registration is per process: the last registered window is the target, and removing the class
+		 *				only happens when no window is left, otherwise the target moves back to the previous one.
+		 */
+		struct RawInputTargets
+		{
+			std::mutex				mutex;
+			std::vector<Window*>	windows[2];
+
+			static RawInputTargets & instance() { static RawInputTargets targets;	return targets; }
+		};
+
+
+		/**
+		 *	@brief		Whether this is a 32-bit process on 64-bit Windows.
+		 *	@details	`GetRawInputBuffer` then returns packets with a 64-bit header (8-byte handles and alignment).
+		 */
+		static inline bool isWow64Process()
+		{
+		#ifdef _WIN64
+			return false;
+		#else
+			static const bool wow64 = []() { BOOL result = FALSE;	return ::IsWow64Process(::GetCurrentProcess(), &result) && result; }();
+
+			return wow64;
+		#endif
+		}
+	}
+}
+
+
+/**
+ *	@brief		Registers this window for raw input (`WM_INPUT`), delivered to `onRawMouse` / `onRawKeyboard`.
+ *	@details	Registrations of the windows of the process are counted per device class, so disabling it on one
+ *				window gives the input back to the previously registered one instead of removing it for all.
+ *	@param[in]	mouse - Whether to receive raw mouse input.
+ *	@param[in]	keyboard - Whether to receive raw keyboard input.
+ */
+bool easywin32::Window::enableRawInput(bool mouse, bool keyboard)
+{
+	auto & targets = details::RawInputTargets::instance();
+
+	std::lock_guard<std::mutex> lock(targets.mutex);
+
+	const bool enable[2] = { mouse, keyboard };
+
+	const bool enabled[2] = { m_enableRawMouse, m_enableRawKeyboard };
+
+	const USHORT usages[2] = { 0x02, 0x06 };		// HID_USAGE_GENERIC_MOUSE, HID_USAGE_GENERIC_KEYBOARD
+
+	RAWINPUTDEVICE devices[2] = {};
+
+	UINT count = 0;
+
+	for (int i = 0; i < 2; i++)
+	{
+		if (enable[i] == enabled[i])
+			continue;
+
+		const auto & windows = targets.windows[i];
+
+		RAWINPUTDEVICE & device = devices[count];
+		device = RAWINPUTDEVICE{};
+		device.usUsagePage = 0x01;		// HID_USAGE_PAGE_GENERIC
+		device.usUsage = usages[i];
+
+		if (enable[i])
+		{
+			device.hwndTarget = m_hWnd;
+		}
+		else if (windows.size() <= 1)
+		{
+			device.dwFlags = RIDEV_REMOVE;		// Last one of the process
+		}
+		else if (windows.back() == this)
+		{
+			device.hwndTarget = windows[windows.size() - 2]->m_hWnd;		// Back to the previous target
+		}
+		else
+		{
+			continue;			// Not the target, nothing to register
+		}
+
+		count++;
+	}
+
+	if ((count != 0) && !::RegisterRawInputDevices(devices, count, sizeof(RAWINPUTDEVICE)) && (mouse || keyboard))
+	{
+		return false;		// Removing always succeeds for this window, even if the new target could not be registered
+	}
+
+	for (int i = 0; i < 2; i++)
+	{
+		auto & windows = targets.windows[i];
+
+		if (enable[i] && !enabled[i])
+			windows.push_back(this);
+		else if (!enable[i] && enabled[i])
+			windows.erase(std::remove(windows.begin(), windows.end(), this), windows.end());
+	}
+
+	m_enableRawMouse = mouse;
+
+	m_enableRawKeyboard = keyboard;
+
+	m_hasRawAbsolutePos = false;
+
+	m_rawKeysDown.reset();
+
+	return true;
+}
+
+
+/**
+ *	@brief		Dispatches all buffered raw input packets with `GetRawInputBuffer`, in batches.
+ *	@return		The number of packets dispatched.
+ */
+size_t easywin32::Window::processRawInput()
+{
+	UINT minSize = 0;
+
+	if ((::GetRawInputBuffer(nullptr, &minSize, sizeof(RAWINPUTHEADER)) != 0) || (minSize == 0))
+	{
+		return 0;
+	}
+
+	//	Room for a batch of packets per call
+	size_t minCount = (static_cast<size_t>(minSize) * 32 + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+	if (m_rawInputBuffer.size() < minCount)
+	{
+		m_rawInputBuffer.resize(minCount);
+	}
+
+	size_t numPackets = 0;
+
+	while (true)
+	{
+		UINT size = static_cast<UINT>(m_rawInputBuffer.size() * sizeof(uint64_t));
+
+		RAWINPUT * rawInput = reinterpret_cast<RAWINPUT*>(m_rawInputBuffer.data());
+
+		UINT count = ::GetRawInputBuffer(rawInput, &size, sizeof(RAWINPUTHEADER));
+
+		if ((count == 0) || (count == static_cast<UINT>(-1)))
+		{
+			break;
+		}
+
+		const bool wow64 = details::isWow64Process();
+
+		for (UINT i = 0; i < count; i++)
+		{
+			if (wow64)
+			{
+				//	64-bit header: `hDevice` and `wParam` take 8 bytes each, blocks are 8-byte aligned
+				Byte * block = reinterpret_cast<Byte*>(rawInput);
+
+				constexpr size_t headerSize = 24;
+
+				RAWINPUT packet = {};
+				packet.header.dwType = rawInput->header.dwType;
+				packet.header.dwSize = rawInput->header.dwSize;
+				std::memcpy(&packet.header.hDevice, block + 8, sizeof(packet.header.hDevice));
+				std::memcpy(&packet.header.wParam, block + 16, sizeof(packet.header.wParam));
+
+				const size_t dataSize = (rawInput->header.dwSize > headerSize) ? rawInput->header.dwSize - headerSize : 0;
+
+				std::memcpy(&packet.data, block + headerSize, (dataSize < sizeof(packet.data)) ? dataSize : sizeof(packet.data));
+
+				this->dispatchRawInput(packet);
+
+				rawInput = reinterpret_cast<RAWINPUT*>(block + ((rawInput->header.dwSize + 7) & ~7u));
+			}
+			else
+			{
+				this->dispatchRawInput(*rawInput);
+
+				rawInput = NEXTRAWINPUTBLOCK(rawInput);
+			}
+		}
+
+		numPackets += count;
+	}
+
+	return numPackets;
+}
+
+
+/**
+ *	@brief		Collects the mouse points (client coordinates, oldest first) since the previous `WM_MOUSEMOVE` into `m_moveHistory`.
+ *	@details	`GetMouseMovePointsEx` returns up to 64 of the most recent points (at the mouse sampling rate, before
+ *				coalescing), newest first. Points up to the last delivered one are dropped, so that each point is
+ *				delivered exactly once. The current point (`x`, `y`) is always the last element, and the only one
+ *				on the first move.
+ */
+void easywin32::Window::collectMouseMoveHistory(int x, int y)
+{
+	constexpr int maxPoints = 64;
+
+	MOUSEMOVEPOINT points[maxPoints] = {};
+
+	Point current = { x, y };
+
+	::ClientToScreen(m_hWnd, &current);
+
+	MOUSEMOVEPOINT input = {};
+	input.x = current.x & 0xFFFF;
+	input.y = current.y & 0xFFFF;
+	input.time = static_cast<DWORD>(::GetMessageTime());
+
+	int count = ::GetMouseMovePointsEx(sizeof(MOUSEMOVEPOINT), &input, points, maxPoints, GMMP_USE_DISPLAY_POINTS);
+
+	m_moveHistory.clear();
+
+	//	Newest first: stop at the last point already delivered. On the first move, the history before it is
+	//	not delivered (it may be from long before the window got the mouse), only the current point seeds it.
+	int numNew = (m_hasLastMovePoint || (count <= 0)) ? 0 : 1;
+
+	for (; m_hasLastMovePoint && (numNew < count); numNew++)
+	{
+		const MOUSEMOVEPOINT & point = points[numNew];
+
+		if ((point.x == m_lastMovePoint.x) && (point.y == m_lastMovePoint.y) && (point.time == m_lastMovePoint.time))
+		{
+			break;
+		}
+	}
+
+	for (int i = numNew - 1; i > 0; i--)
+	{
+		//	Display points are 16-bit, coordinates left/above the primary monitor wrap around
+		Point point = { points[i].x > 32767 ? points[i].x - 65536 : points[i].x, points[i].y > 32767 ? points[i].y - 65536 : points[i].y };
+
+		::ScreenToClient(m_hWnd, &point);
+
+		m_moveHistory.push_back(point);
+	}
+
+	m_moveHistory.push_back(Point{ x, y });
+
+	m_hasLastMovePoint = (count > 0);
+
+	m_lastMovePoint = (count > 0) ? points[0] : MOUSEMOVEPOINT{};
+}
+
+
+/**
+ *	@brief		Reads all paths of a drop into `m_dropBuffer` / `m_dropPaths`.
+ *	@details	The paths are packed into one reused buffer, each followed by a NUL terminator (so that
+ *				`view.data()` can be passed to Win32 functions), without any per-file allocation.
+ */
+void easywin32::Window::collectDropPaths(HDROP hDrop)
+{
+	UINT count = ::DragQueryFile(hDrop, UINT32_MAX, nullptr, 0);
+
+	//	First pass: total length, including terminators
+	size_t totalLength = 0;
+
+	for (UINT i = 0; i < count; ++i)
+	{
+		totalLength += ::DragQueryFile(hDrop, i, nullptr, 0) + 1;
+	}
+
+	if (m_dropBuffer.size() < totalLength)
+	{
+		m_dropBuffer.resize(totalLength);
+	}
+
+	m_dropPaths.resize(count);
+
+	//	Second pass: copy the paths back to back
+	size_t offset = 0;
+
+	for (UINT i = 0; i < count; ++i)
+	{
+		auto * path = m_dropBuffer.data() + offset;
+
+		UINT length = ::DragQueryFile(hDrop, i, path, static_cast<UINT>(totalLength - offset));
+
+		m_dropPaths[i] = string_view_type(path, length);
+
+		offset += length + 1;
+	}
+}
+
+
+//!	@brief	Dispatches one raw input packet to `onRawMouse` / `onRawKeyboard`.
+void easywin32::Window::dispatchRawInput(const RAWINPUT & rawInput)
+{
+	if ((rawInput.header.dwType == RIM_TYPEMOUSE) && onRawMouse)
+	{
+		const RAWMOUSE & mouse = rawInput.data.mouse;
+
+		int dx = mouse.lLastX;
+		int dy = mouse.lLastY;
+
+		//	Absolute devices report normalized coordinates [0, 65535]: convert to pixel deltas
+		if (mouse.usFlags & MOUSE_MOVE_ABSOLUTE)
+		{
+			bool virtualDesktop = (mouse.usFlags & MOUSE_VIRTUAL_DESKTOP) != 0;
+
+			int width = ::GetSystemMetrics(virtualDesktop ? SM_CXVIRTUALSCREEN : SM_CXSCREEN);
+			int height = ::GetSystemMetrics(virtualDesktop ? SM_CYVIRTUALSCREEN : SM_CYSCREEN);
+
+			Point pos = { ::MulDiv(mouse.lLastX, width, 65535), ::MulDiv(mouse.lLastY, height, 65535) };
+
+			dx = m_hasRawAbsolutePos ? pos.x - m_rawAbsolutePos.x : 0;
+			dy = m_hasRawAbsolutePos ? pos.y - m_rawAbsolutePos.y : 0;
+
+			m_hasRawAbsolutePos = true;
+
+			m_rawAbsolutePos = pos;
+		}
+
+		onRawMouse(dx, dy, static_cast<RawMouseButton>(mouse.usButtonFlags & 0x03FF));
+	}
+	else if ((rawInput.header.dwType == RIM_TYPEKEYBOARD) && onRawKeyboard)
+	{
+		const RAWKEYBOARD & keyboard = rawInput.data.keyboard;
+
+		if ((keyboard.VKey == 0) || (keyboard.VKey >= 0xFF))		// 0xFF: fake key of an escaped sequence
+		{
+			return;
+		}
+
+		if (keyboard.Flags & RI_KEY_BREAK)
+		{
+			m_rawKeysDown[keyboard.VKey] = false;
+
+			onRawKeyboard(static_cast<Key>(keyboard.VKey), KeyAction::Release);
+		}
+		else
+		{
+			KeyAction action = m_rawKeysDown[keyboard.VKey] ? KeyAction::Repeat : KeyAction::Press;
+
+			m_rawKeysDown[keyboard.VKey] = true;
+
+			onRawKeyboard(static_cast<Key>(keyboard.VKey), action);
+		}
+	}
+}
+
+
+/**
+ *	@brief		Feeds recorded events back through the callbacks, as fast as possible.
+ *	@return		The number of events dispatched.
+ */
+size_t easywin32::Window::replay(const Event * events, size_t count)
+{
+	size_t numDispatched = 0;
+
+	m_replaying = true;
+
+	for (size_t i = 0; i < count; i++)
+	{
+		if (!EventRecorder::isRecorded(events[i].message))		// E.g. from a file saved by an older version
+			continue;
+
+		Window::dispatch(this, events[i].message, events[i].wParam, events[i].lParam);
+
+		numDispatched++;
+	}
+
+	m_replaying = false;
+
+	return numDispatched;
+}
+
+
+//!	@brief	Feeds the events held by `recorder` back through the callbacks, from the oldest to the newest.
+size_t easywin32::Window::replay(const EventRecorder & recorder)
+{
+	std::vector<Event> events = recorder.getEvents();
+
+	return this->replay(events.data(), events.size());
+}
+
+
+#ifdef EZWIN32_ENABLE_PROFILER
+
+//!	@brief	Returns the statistics of every message type dispatched at least once.
+std::vector<easywin32::DispatchStats> easywin32::DispatchProfiler::getStats() const
+{
+	std::vector<DispatchStats> stats;
+
+	const double secondsPerTick = 1.0 / m_frequency;
+
+	for (UINT message = 0; message <= WM_USER; message++)
+	{
+		const Histogram * histogram = m_histograms[message].get();
+
+		if ((histogram == nullptr) || (histogram->count == 0))
+		{
+			continue;
+		}
+
+		//	Quantiles from the cumulative bucket counts
+		int64_t p50 = 0, p99 = 0;
+
+		uint64_t cumulative = 0;
+
+		for (int i = 0; i < NumBuckets; i++)
+		{
+			uint64_t next = cumulative + histogram->buckets[i];
+
+			if ((cumulative * 2 < histogram->count) && (next * 2 >= histogram->count))		p50 = DispatchProfiler::bucketUpperBound(i);
+
+			if ((cumulative * 100 < histogram->count * 99) && (next * 100 >= histogram->count * 99))		p99 = DispatchProfiler::bucketUpperBound(i);
+
+			cumulative = next;
+		}
+
+		DispatchStats item = {};
+		item.message = message;
+		item.count = histogram->count;
+		item.total = histogram->total * secondsPerTick;
+		item.p50 = (p50 < histogram->max ? p50 : histogram->max) * secondsPerTick;
+		item.p99 = (p99 < histogram->max ? p99 : histogram->max) * secondsPerTick;
+		item.max = histogram->max * secondsPerTick;
+
+		stats.push_back(item);
+	}
+
+	return stats;
+}
+
+#ifdef EZWIN32_ENABLE_TRACELOGGING
+
+//	Provider "EasyWin32" {eb963507-f61d-47be-95b6-95ecdf7cb013}, registered for the lifetime of the process.
+TRACELOGGING_DEFINE_PROVIDER(g_easywin32TraceProvider, "EasyWin32", (0xeb963507, 0xf61d, 0x47be, 0x95, 0xb6, 0x95, 0xec, 0xdf, 0x7c, 0xb0, 0x13));
+
+namespace easywin32
+{
+	namespace details
+	{
+		static struct TraceProviderRegistration
+		{
+			TraceProviderRegistration() { TraceLoggingRegister(g_easywin32TraceProvider); }
+
+			~TraceProviderRegistration() { TraceLoggingUnregister(g_easywin32TraceProvider); }
+		} s_traceProviderRegistration;
+	}
+}
+
+#endif
+#endif
+
+
+//!	@brief	Copies the events held, from the oldest to the newest.
+std::vector<easywin32::Event> easywin32::EventRecorder::getEvents() const
+{
+	std::vector<Event> events(this->size());
+
+	for (size_t i = 0; i < events.size(); i++)
+	{
+		events[i] = (*this)[i];
+	}
+
+	return events;
+}
+
+
+namespace easywin32
+{
+	namespace details
+	{
+		//!	@brief	Header of the files written by `EventRecorder::save`.
+		struct EventFileHeader
+		{
+			char			magic[4];		// "EZEV"
+			uint32_t		eventSize;		// sizeof(Event), differs between 32-bit and 64-bit builds
+			int64_t			frequency;		// QPC frequency of the timestamps
+			uint64_t		count;			// Number of events that follow
+		};
+	}
+}
+
+
+//!	@brief	Saves the events held to a binary file.
+bool easywin32::EventRecorder::save(const string_type & path) const
+{
+	HANDLE hFile = ::CreateFile(path.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+	if (hFile == INVALID_HANDLE_VALUE)
+	{
+		return false;
+	}
+
+	std::vector<Event> events = this->getEvents();
+
+	details::EventFileHeader header = { { 'E', 'Z', 'E', 'V' }, sizeof(Event), m_frequency, events.size() };
+
+	DWORD headerBytes = 0, eventBytes = 0;
+
+	DWORD bytes = static_cast<DWORD>(events.size() * sizeof(Event));
+
+	bool succeeded = ::WriteFile(hFile, &header, sizeof(header), &headerBytes, nullptr) && ::WriteFile(hFile, events.data(), bytes, &eventBytes, nullptr);
+
+	::CloseHandle(hFile);
+
+	return succeeded && (headerBytes == sizeof(header)) && (eventBytes == bytes);
+}
+
+
+//!	@brief	Replaces the events held by the ones of a file written by `save`.
+bool easywin32::EventRecorder::load(const string_type & path)
+{
+	HANDLE hFile = ::CreateFile(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+	if (hFile == INVALID_HANDLE_VALUE)
+	{
+		return false;
+	}
+
+	details::EventFileHeader header = {};
+
+	DWORD bytes = 0;
+
+	bool succeeded = ::ReadFile(hFile, &header, sizeof(header), &bytes, nullptr) && (bytes == sizeof(header)) &&
+					 (std::string_view(header.magic, 4) == "EZEV") && (header.eventSize == sizeof(Event));
+
+	//	The count is not trusted: it must match the file size, and the events must fit in one `ReadFile`
+	LARGE_INTEGER fileSize = {};
+
+	succeeded = succeeded && ::GetFileSizeEx(hFile, &fileSize) &&
+				(header.count <= static_cast<uint64_t>(fileSize.QuadPart - sizeof(header)) / sizeof(Event)) &&
+				(header.count <= MAXDWORD / sizeof(Event));
+
+	if (succeeded)
+	{
+		size_t capacity = 1;
+
+		while (capacity < header.count)		capacity <<= 1;
+
+		std::vector<Event> events(capacity);
+
+		DWORD eventBytes = static_cast<DWORD>(header.count * sizeof(Event));
+
+		succeeded = ::ReadFile(hFile, events.data(), eventBytes, &bytes, nullptr) && (bytes == eventBytes);
+
+		if (succeeded)
+		{
+			m_events.swap(events);
+
+			m_numRecorded = header.count;
+
+			m_frequency = header.frequency;
+		}
+	}
+
+	::CloseHandle(hFile);
+
+	return succeeded;
+}
+
+
+void easywin32::InputQueue::push(UINT message, WPARAM wParam, LPARAM lParam)
+{
+	const bool isKey = (message == WM_KEYDOWN) || (message == WM_KEYUP) || (message == WM_SYSKEYDOWN) || (message == WM_SYSKEYUP);
+
+	const bool isMouse = (message >= WM_MOUSEFIRST) && (message <= WM_MOUSELAST);
+
+	if (message == WM_KILLFOCUS)
+	{
+		//	Releases are sent to the window getting the focus
+		std::fill(std::begin(m_state.keyDown), std::end(m_state.keyDown), 0);
+
+		m_state.mouseState = 0;
+
+		return;
+	}
+	else if (!isKey && !isMouse)
+	{
+		return;
+	}
+
+	LARGE_INTEGER counter = {};		::QueryPerformanceCounter(&counter);
+
+	Event event = { counter.QuadPart, message, wParam, lParam };
+
+	if (m_queued.size() < m_queued.capacity())
+		m_queued.push_back(event);
+	else
+		m_numDropped++;
+
+	if (isKey)
+	{
+		const unsigned int vk = static_cast<unsigned int>(wParam) & 255;
+
+		const uint64_t bit = uint64_t(1) << (vk & 63);
+
+		const bool down = (message == WM_KEYDOWN) || (message == WM_SYSKEYDOWN);
+
+		if (down)	m_state.keyDown[vk >> 6] |= bit;
+		else		m_state.keyDown[vk >> 6] &= ~bit;
+
+		//	Keeps the modifiers in sync until the next mouse message
+		if (vk == VK_SHIFT)			m_state.mouseState = down ? (m_state.mouseState | MouseState::Shift) : (m_state.mouseState & ~Flags<MouseState>(MouseState::Shift));
+		else if (vk == VK_CONTROL)	m_state.mouseState = down ? (m_state.mouseState | MouseState::Ctrl) : (m_state.mouseState & ~Flags<MouseState>(MouseState::Ctrl));
+	}
+	else
+	{
+		m_state.mouseState = event.mouseState();
+
+		if ((message != WM_MOUSEWHEEL) && (message != WM_MOUSEHWHEEL))		// Wheel messages carry screen coordinates
+		{
+			m_state.mousePos = event.mousePos();
+		}
+	}
+}
+
+
+//!	@brief	Returns the registered message used to wake up the window thread for posted tasks.
+UINT easywin32::Window::postedTasksMessage()
+{
+	static const UINT message = ::RegisterWindowMessage(TEXT("EasyWin32.PostedTasks"));
+
+	return message;
+}
+
+
+//!	@brief	Returns the per-process `lParam` of a `CloseRequest`, unpredictable from other processes.
+LPARAM easywin32::Window::closeRequestToken()
+{
+	static const LPARAM token = []()
+	{
+		LARGE_INTEGER counter = {};
+
+		::QueryPerformanceCounter(&counter);
+
+		static const int anchor = 0;
+
+		return static_cast<LPARAM>(counter.QuadPart) ^ reinterpret_cast<LPARAM>(&anchor) ^ static_cast<LPARAM>(::GetCurrentProcessId());
+	}();
+
+	return token;
+}
+
+
+//!	@brief	Returns the registered message posted by DXGI when the occlusion status changes.
+UINT easywin32::Window::occlusionStatusMessage()
+{
+	static const UINT message = ::RegisterWindowMessage(TEXT("EasyWin32.OcclusionStatus"));
+
+	return message;
+}
+
+
+namespace easywin32
+{
+	namespace details
+	{
+		//!	@brief	Windows of the current thread receiving cloaking events, through one out-of-context event hook.
+		struct CloakWatch
+		{
+			HWINEVENTHOOK				hHook = nullptr;
+			std::vector<Window*>		windows;
+
+			~CloakWatch()
+			{
+				if (hHook != nullptr)
+				{
+					::UnhookWinEvent(hHook);
+				}
+			}
+
+			static CloakWatch & forThisThread()
+			{
+				static thread_local CloakWatch watch;
+
+				return watch;
+			}
+		};
+	}
+}
+
+
+/**
+ *	@brief		Starts tracking the cloaking and session lock of the window, after it is created.
+ *	@details	Cloaking changes are not notified by a window message: they are received through `SetWinEventHook`,
+ *				installed when the first window of the thread is opened. Hooks out of context are delivered by the
+ *				message loop of the thread, so `cloakEventProc` runs on the window thread.
+ */
+void easywin32::Window::watchVisibility()
+{
+	DWORD cloaked = 0;
+
+	m_cloaked = SUCCEEDED(::DwmGetWindowAttribute(m_hWnd, DWMWA_CLOAKED, &cloaked, sizeof(cloaked))) && (cloaked != 0);
+
+	m_sessionLocked = m_occluded = false;
+
+	::WTSRegisterSessionNotification(m_hWnd, NOTIFY_FOR_THIS_SESSION);
+
+	auto & watch = details::CloakWatch::forThisThread();
+
+	if (watch.hHook == nullptr)
+	{
+		watch.hHook = ::SetWinEventHook(EVENT_OBJECT_CLOAKED, EVENT_OBJECT_UNCLOAKED, nullptr, Window::cloakEventProc,
+										::GetCurrentProcessId(), ::GetCurrentThreadId(), WINEVENT_OUTOFCONTEXT);
+	}
+
+	watch.windows.push_back(this);
+
+	m_visibility = this->getVisibility();
+}
+
+
+//!	@brief	Stops tracking the cloaking and session lock of the window, before it is destroyed.
+void easywin32::Window::unwatchVisibility()
+{
+	auto & watch = details::CloakWatch::forThisThread();
+
+	auto iter = std::find(watch.windows.begin(), watch.windows.end(), this);
+
+	if (iter == watch.windows.end())
+		return;
+
+	watch.windows.erase(iter);
+
+	if (watch.windows.empty() && (watch.hHook != nullptr))
+	{
+		::UnhookWinEvent(watch.hHook);
+
+		watch.hHook = nullptr;
+	}
+
+	if (m_hWnd != nullptr)
+	{
+		::WTSUnRegisterSessionNotification(m_hWnd);
+	}
+
+	m_cloaked = m_sessionLocked = m_occluded = false;
+
+	m_visibility = Visibility::Hidden;
+}
+
+
+//!	@brief	Calls `onVisibilityChanged` if `getVisibility` changed since the last call.
+void easywin32::Window::updateVisibility()
+{
+	Visibility visibility = this->getVisibility();
+
+	if (visibility != m_visibility)
+	{
+		m_visibility = visibility;
+
+		if (onVisibilityChanged)	onVisibilityChanged(visibility);
+	}
+}
+
+
+//!	@brief	Receives `EVENT_OBJECT_CLOAKED` and `EVENT_OBJECT_UNCLOAKED` for the windows of this thread.
+void CALLBACK easywin32::Window::cloakEventProc(HWINEVENTHOOK, DWORD event, HWND hWnd, LONG idObject, LONG idChild, DWORD, DWORD)
+{
+	if ((idObject != OBJID_WINDOW) || (idChild != CHILDID_SELF))
+		return;
+
+	auto & windows = details::CloakWatch::forThisThread().windows;
+
+	for (size_t i = 0; i < windows.size(); i++)
+	{
+		if (windows[i]->m_hWnd == hWnd)
+		{
+			windows[i]->m_cloaked = (event == EVENT_OBJECT_CLOAKED);
+
+			windows[i]->updateVisibility();		// May close the window and invalidate `windows`
+
+			break;
+		}
+	}
+}
+
+
+//!	@brief	Reports whether the content is occluded, see `getVisibility`.
+void easywin32::Window::setOccluded(bool occluded)
+{
+	if ((m_hWnd != nullptr) && (m_occluded != occluded))
+	{
+		m_occluded = occluded;
+
+		this->updateVisibility();
+	}
+}
+
+
+//!	@brief	Runs all tasks queued by `post`, in FIFO order.
+void easywin32::Window::runPostedTasks()
+{
+	//	Clear the flag before taking the batch: tasks pushed from now on post a new wake-up
+	m_wakePending = false;
+
+	PostedTask * node = m_postedTasks.exchange(nullptr, std::memory_order_acquire);
+
+	PostedTask * head = nullptr;
+
+	while (node != nullptr)
+	{
+		PostedTask * next = node->next;
+
+		node->next = head;
+
+		head = node;
+
+		node = next;
+	}
+
+	while (head != nullptr)
+	{
+		PostedTask * next = head->next;
+
+		head->task();
+
+		delete head;
+
+		head = next;
+
+		//	A task closed the window: the rest of the batch is discarded, as the tasks queued at close
+		if (m_hWnd == nullptr)
+		{
+			while (head != nullptr)
+			{
+				next = head->next;
+
+				delete head;
+
+				head = next;
+			}
+		}
+	}
+}
+
+
+//!	@brief	Makes `post` fail from now on, then discards all tasks queued by `post`.
+void easywin32::Window::clearPostedTasks()
+{
+	m_postTarget = nullptr;
+
+	//	A producer that read the handle before it was cleared may still be pushing its task
+	while (m_postsInFlight.load() != 0)
+	{
+		std::this_thread::yield();
+	}
+
+	PostedTask * node = m_postedTasks.exchange(nullptr, std::memory_order_acquire);
+
+	while (node != nullptr)
+	{
+		PostedTask * next = node->next;
+
+		delete node;
+
+		node = next;
+	}
+
+	m_wakePending = false;
+}
+
+
+/*********************************************************************************
+*****************************    TimerScheduler    *****************************
+*********************************************************************************/
+
+namespace easywin32
+{
+	namespace details
+	{
+		/**
+		 *	@brief		Process-wide thread scheduling the timers of `Window::setPreciseTimer`.
+		 *	@details	Deadlines are kept in a min-heap, the thread sleeps on a high-resolution waitable timer until the
+		 *				earliest one (or until `m_hWake` signals an earlier one) and posts the due ticks. Killed timers
+		 *				leave stale heap entries, recognized by their generation and discarded when they come up.
+		 */
+		class TimerScheduler
+		{
+			using Key = std::pair<Window*, UINT_PTR>;
+
+			struct Timer
+			{
+				LONGLONG	period;				// QPC ticks
+				uint64_t	generation;			// Changes each time the timer is (re)started
+				bool		pending;			// A tick is posted and has not run yet
+			};
+
+			struct Deadline
+			{
+				LONGLONG	time;				// QPC timestamp
+				Key			key;
+				uint64_t	generation;
+
+				bool operator<(const Deadline & rhs) const { return time > rhs.time; }		// Earliest on top of the heap
+			};
+
+		public:
+
+			static TimerScheduler & instance()
+			{
+				static TimerScheduler scheduler;
+
+				return scheduler;
+			}
+
+
+			void set(Window * window, UINT_PTR id, double interval)
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+
+				const LONGLONG period = static_cast<LONGLONG>(interval * m_frequency);
+
+				Timer & timer = m_timers[Key(window, id)];
+
+				timer = Timer{ period > 0 ? period : 1, ++m_generation, false };
+
+				// Drop the stale entries once they outnumber the live ones
+				if (m_heap.size() > 2 * m_timers.size() + 16)
+				{
+					m_heap.erase(std::remove_if(m_heap.begin(), m_heap.end(), [this](const Deadline & deadline) { return !this->isLive(deadline); }), m_heap.end());
+
+					std::make_heap(m_heap.begin(), m_heap.end());
+				}
+
+				m_heap.push_back(Deadline{ TimerScheduler::now() + timer.period, Key(window, id), timer.generation });
+
+				std::push_heap(m_heap.begin(), m_heap.end());
+
+				if (!m_thread.joinable())
+				{
+					m_thread = std::thread(&TimerScheduler::threadMain, this);
+				}
+				else if (m_heap.front().generation == timer.generation)
+				{
+					::SetEvent(m_hWake);		// New earliest deadline
+				}
+			}
+
+
+			void kill(Window * window, UINT_PTR id)
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+
+				m_timers.erase(Key(window, id));
+			}
+
+
+			void killAll(Window * window)
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+
+				m_timers.erase(m_timers.lower_bound(Key(window, 0)), m_timers.upper_bound(Key(window, UINTPTR_MAX)));
+			}
+
+
+			//!	@brief	Called on the window thread when a tick runs, returns whether the timer is still the one that posted it.
+			bool acknowledge(Window * window, UINT_PTR id, uint64_t generation)
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+
+				auto iter = m_timers.find(Key(window, id));
+
+				if ((iter == m_timers.end()) || (iter->second.generation != generation))
+				{
+					return false;
+				}
+
+				iter->second.pending = false;
+
+				return true;
+			}
+
+		private:
+
+			TimerScheduler()
+			{
+				LARGE_INTEGER frequency = {};		::QueryPerformanceFrequency(&frequency);
+
+				m_frequency = frequency.QuadPart;
+
+				m_hWake = ::CreateEvent(nullptr, FALSE, FALSE, nullptr);
+
+				m_hTimer = ::CreateWaitableTimerEx(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+
+				if (m_hTimer == nullptr)
+				{
+					m_hTimer = ::CreateWaitableTimerEx(nullptr, nullptr, 0, TIMER_ALL_ACCESS);
+				}
+			}
+
+
+			~TimerScheduler()
+			{
+				if (m_thread.joinable())
+				{
+					m_mutex.lock();
+
+					m_stopping = true;
+
+					m_mutex.unlock();
+
+					::SetEvent(m_hWake);
+
+					m_thread.join();
+				}
+
+				::CloseHandle(m_hTimer);
+
+				::CloseHandle(m_hWake);
+			}
+
+
+			static LONGLONG now() { LARGE_INTEGER counter = {};		::QueryPerformanceCounter(&counter);		return counter.QuadPart; }
+
+
+			bool isLive(const Deadline & deadline) const
+			{
+				auto iter = m_timers.find(deadline.key);
+
+				return (iter != m_timers.end()) && (iter->second.generation == deadline.generation);
+			}
+
+
+			void threadMain()
+			{
+				std::unique_lock<std::mutex> lock(m_mutex);
+
+				while (!m_stopping)
+				{
+					const LONGLONG time = TimerScheduler::now();
+
+					while (!m_heap.empty() && (m_heap.front().time <= time))
+					{
+						std::pop_heap(m_heap.begin(), m_heap.end());
+
+						Deadline deadline = m_heap.back();
+
+						m_heap.pop_back();
+
+						auto iter = m_timers.find(deadline.key);
+
+						if ((iter == m_timers.end()) || (iter->second.generation != deadline.generation))
+						{
+							continue;
+						}
+
+						Timer & timer = iter->second;
+
+						if (!timer.pending)
+						{
+							Window * window = deadline.key.first;
+
+							const UINT_PTR id = deadline.key.second;
+
+							const uint64_t generation = deadline.generation;
+
+							// Under the lock: `Window` kills its timers before its handle is cleared
+							timer.pending = window->post([window, id, generation]()
+							{
+								if (TimerScheduler::instance().acknowledge(window, id, generation) && window->onPreciseTimer)
+								{
+									window->onPreciseTimer(id);
+								}
+							});
+						}
+
+						// Next deadline on the grid of the first one, skipping the ones already missed
+						deadline.time += timer.period;
+
+						if (deadline.time <= time)
+						{
+							deadline.time += ((time - deadline.time) / timer.period + 1) * timer.period;
+						}
+
+						m_heap.push_back(deadline);
+
+						std::push_heap(m_heap.begin(), m_heap.end());
+					}
+
+					HANDLE handles[2] = { m_hWake, m_hTimer };
+
+					DWORD count = 1;
+
+					if (!m_heap.empty() && (m_hTimer != nullptr))
+					{
+						LARGE_INTEGER dueTime = {};		dueTime.QuadPart = -(((m_heap.front().time - time) * 10'000'000) / m_frequency + 1);
+
+						::SetWaitableTimer(m_hTimer, &dueTime, 0, nullptr, nullptr, FALSE);
+
+						count = 2;
+					}
+
+					lock.unlock();
+
+					::WaitForMultipleObjects(count, handles, FALSE, INFINITE);
+
+					lock.lock();
+				}
+			}
+
+		private:
+
+			std::mutex					m_mutex;
+			std::map<Key, Timer>		m_timers;
+			std::vector<Deadline>		m_heap;
+			uint64_t					m_generation = 0;
+			LONGLONG					m_frequency = 0;
+			HANDLE						m_hWake = nullptr;		// Auto-reset, signaled for an earlier deadline or to stop
+			HANDLE						m_hTimer = nullptr;
+			std::thread					m_thread;
+			bool						m_stopping = false;		// Guarded by `m_mutex`
+		};
+	}
+}
+
+
+/**
+ *	@brief		Starts (or restarts) a high-resolution periodic timer, whose ticks call `onPreciseTimer` on the window thread.
+ *	@return		`false` if the window is not open or `interval` is not positive.
+ */
+bool easywin32::Window::setPreciseTimer(UINT_PTR id, double interval)
+{
+	if ((m_hWnd == nullptr) || !(interval > 0.0))
+	{
+		return false;
+	}
+
+	m_hasPreciseTimers = true;
+
+	details::TimerScheduler::instance().set(this, id, interval);
+
+	return true;
+}
+
+
+//!	@brief	Stops a timer started by `setPreciseTimer`, a tick already posted is not delivered.
+void easywin32::Window::killPreciseTimer(UINT_PTR id)
+{
+	if (m_hasPreciseTimers)
+	{
+		details::TimerScheduler::instance().kill(this, id);
+	}
+}
+
+
+//!	@brief	Stops all timers started by `setPreciseTimer`.
+void easywin32::Window::killPreciseTimers()
+{
+	if (m_hasPreciseTimers)
+	{
+		details::TimerScheduler::instance().killAll(this);
+
+		m_hasPreciseTimers = false;
+	}
+}
+
+
+//!	@brief	Enables or disables the DWM "blur-behind" effect for the window (aka. alpha-composition).
+void easywin32::Window::enableBlurBeindWindow(bool enable)
+{
+	BOOL composition = FALSE;
+
+	if (SUCCEEDED(::DwmIsCompositionEnabled(&composition)) && composition)
+	{
+		HRGN region = ::CreateRectRgn(0, 0, -1, -1);
+
+		DWM_BLURBEHIND		bb = {};
+		bb.dwFlags			= DWM_BB_ENABLE | DWM_BB_BLURREGION;
+		bb.hRgnBlur			= enable ? region : NULL;
+		bb.fEnable			= enable ? TRUE : FALSE;
+
+		::DwmEnableBlurBehindWindow(m_hWnd, &bb);
+		::DeleteObject(region);
+
+		m_enableBlurBeind = enable;
+	}
+}
+
+
+/**
+ *	@brief		Collects the rectangles of the pending update region.
+ *	@details	The update region is read with `GetUpdateRgn` (before `BeginPaint` validates it) and split into
+ *				its rectangles, so a paint triggered by a few small dirty rectangles only copies those pixels.
+ *				If the region is too fragmented, `m_updateRects` is left empty and `PAINTSTRUCT::rcPaint` is used instead.
+ */
+void easywin32::Window::collectUpdateRects()
+{
+	constexpr DWORD maxRects = 16;		// Beyond this, a single blit of the bounding box is cheaper
+
+	m_updateRects.clear();
+
+	if (m_hUpdateRgn == nullptr)
+	{
+		m_hUpdateRgn = ::CreateRectRgn(0, 0, 0, 0);
+	}
+
+	if (::GetUpdateRgn(m_hWnd, m_hUpdateRgn, FALSE) == COMPLEXREGION)
+	{
+		DWORD bytes = ::GetRegionData(m_hUpdateRgn, 0, nullptr);
+
+		if (m_regionData.size() < bytes)
+		{
+			m_regionData.resize(bytes);
+		}
+
+		RGNDATA * data = reinterpret_cast<RGNDATA*>(m_regionData.data());
+
+		if ((::GetRegionData(m_hUpdateRgn, bytes, data) != 0) && (data->rdh.nCount <= maxRects))
+		{
+			const Rect * rects = reinterpret_cast<const Rect*>(data->Buffer);
+
+			m_updateRects.assign(rects, rects + data->rdh.nCount);
+		}
+	}
+}
+
+
+/**
+ *	@brief		Blits a 32-bit top-down DIB to the client area.
+ *	@details	Shared by all `drawBitmap` overloads. The blit is clipped to the update region of the current
+ *				`WM_PAINT`, so only the rows and columns that were invalidated are handed to GDI.
+ *	@param[in]	pixels - Pointer to the first row of the DIB.
+ *	@param[in]	pitch - Distance between two rows in bytes (`bmi->biWidth` must be `pitch / 4`).
+ *	@param[in]	bmi - Bitmap description, `biHeight` is overwritten per clipped rectangle.
+ */
+void easywin32::Window::paintBitmap(const void * pixels, size_t pitch, BITMAPINFO * bmi, int width, int height, int dstX, int dstY)
+{
+	this->collectUpdateRects();
+
+	PAINTSTRUCT ps = {};
+
+	// Begin painting
+	HDC hdc = ::BeginPaint(m_hWnd, &ps);
+
+	const Rect bounds = { dstX, dstY, dstX + width, dstY + height };
+	const Rect * clipRects = m_updateRects.empty() ? &ps.rcPaint : m_updateRects.data();
+	const size_t clipCount = m_updateRects.empty() ? 1 : m_updateRects.size();
+
+	for (size_t i = 0; i < clipCount; i++)
+	{
+		Rect rect = {};
+
+		if (!::IntersectRect(&rect, &clipRects[i], &bounds))
+			continue;
+
+		int srcX = rect.left - dstX;
+		int srcY = rect.top - dstY;
+		int w = rect.right - rect.left;
+		int h = rect.bottom - rect.top;
+
+		bmi->bmiHeader.biHeight = -h;		// Negative = top-down bitmap, starting at row `srcY`
+
+		// Draw image directly to window
+		::SetDIBitsToDevice(
+			hdc,
+			rect.left, rect.top,									// Destination X, Y
+			w, h,													// Width, Height
+			srcX, 0,												// Source X, Y
+			0, h,													// Start scan line, number of scan lines
+			static_cast<const Byte*>(pixels) + srcY * pitch,		// Pointer to the first visible row
+			bmi,
+			DIB_RGB_COLORS											// RGB mode
+		);
+	}
+
+	// End painting
+	::EndPaint(m_hWnd, &ps);
+}
+
+
+/**
+ *	@brief		Draws a raw RGB bitmap onto the window at the specified position.
+ *	@details	This function copies pixel data directly to the window's client area
+ *				using GDI without relying on any GPU or graphics API.
+ *	@param[in]	pixels - Pointer to the RGB pixel data in row-major order.
+ *	@param[in]	width - Width of the bitmap in pixels.
+ *	@param[in]	height - Height of the bitmap in pixels.
+ *	@param[in]	dstX - Destination X coordinate in the client area.
+ *	@param[in]	dstY - Destination Y coordinate in the client area.
+ *	@note		24-bit DIB rows must be DWORD-aligned, which tightly packed `ColorRGB` rows generally are not,
+ *				so the pixels are first converted to 32-bit BGRX with `convertPixels` into a reused buffer.
+ *				Prefer the `ColorBGRA` overload (or `Framebuffer`) to avoid the conversion entirely.
+ *	@warning	This function must be called only inside `onPaint`, because it uses BeginPaint/EndPaint.
+ *				Calling it outside `onPaint` causes undefined behavior in Win32.
+ */
+void easywin32::Window::drawBitmap(const ColorRGB * pixels, int width, int height, int dstX, int dstY)
+{
+	size_t count = static_cast<size_t>(width) * height;
+
+	if (m_convertBuffer.size() < count)
+	{
+		m_convertBuffer.resize(count);
+	}
+
+	easywin32::convertPixels(pixels, m_convertBuffer.data(), count);
+
+	this->drawBitmap(m_convertBuffer.data(), width, height, 0, dstX, dstY);
+}
+
+
+/**
+ *	@brief		Draws a raw 32-bit BGRX/BGRA bitmap onto the window at the specified position.
+ *	@details	The pixels are handed to GDI in their native layout, so no conversion is performed.
+ *	@param[in]	pixels - Pointer to the first row of pixels (top-down).
+ *	@param[in]	width - Width of the bitmap in pixels.
+ *	@param[in]	height - Height of the bitmap in pixels.
+ *	@param[in]	pitch - Distance between two rows in bytes, must be a multiple of 4 (0 = `width * 4`).
+ *	@param[in]	dstX - Destination X coordinate in the client area.
+ *	@param[in]	dstY - Destination Y coordinate in the client area.
+ *	@warning	This function must be called only inside `onPaint`, because it uses BeginPaint/EndPaint.
+ */
+void easywin32::Window::drawBitmap(const ColorBGRA * pixels, int width, int height, size_t pitch, int dstX, int dstY)
+{
+	if (pitch == 0)		pitch = static_cast<size_t>(width) * sizeof(ColorBGRA);
+
+	assert((pitch % sizeof(ColorBGRA) == 0) && (pitch >= static_cast<size_t>(width) * sizeof(ColorBGRA)));
+
+	BITMAPINFO bmi = {};
+	bmi.bmiHeader.biSize			= sizeof(BITMAPINFOHEADER);
+	bmi.bmiHeader.biWidth			= static_cast<LONG>(pitch / sizeof(ColorBGRA));		// Row pitch in pixels
+	bmi.bmiHeader.biPlanes			= 1;
+	bmi.bmiHeader.biBitCount		= sizeof(ColorBGRA) * 8;							// 32-bit (BGRX)
+	bmi.bmiHeader.biCompression		= BI_RGB;											// No compression
+
+	this->paintBitmap(pixels, pitch, &bmi, width, height, dstX, dstY);
+}
+
+
+/**
+ *	@brief		Draws a raw 32-bit RGBA bitmap onto the window at the specified position.
+ *	@details	The channel order is described to GDI with `BI_BITFIELDS` masks, so no conversion is performed
+ *				on the caller side. The alpha channel is ignored.
+ *	@param[in]	pitch - Distance between two rows in bytes, must be a multiple of 4 (0 = `width * 4`).
+ *	@warning	This function must be called only inside `onPaint`, because it uses BeginPaint/EndPaint.
+ */
+void easywin32::Window::drawBitmap(const ColorRGBA * pixels, int width, int height, size_t pitch, int dstX, int dstY)
+{
+	static_assert(sizeof(ColorRGBA) == 4, "ColorRGBA must be tightly packed.");
+
+	if (pitch == 0)		pitch = static_cast<size_t>(width) * sizeof(ColorRGBA);
+
+	assert((pitch % sizeof(ColorRGBA) == 0) && (pitch >= static_cast<size_t>(width) * sizeof(ColorRGBA)));
+
+	struct { BITMAPINFOHEADER bmiHeader; DWORD masks[3]; } bmi = {};
+	bmi.bmiHeader.biSize			= sizeof(BITMAPINFOHEADER);
+	bmi.bmiHeader.biWidth			= static_cast<LONG>(pitch / sizeof(ColorRGBA));		// Row pitch in pixels
+	bmi.bmiHeader.biPlanes			= 1;
+	bmi.bmiHeader.biBitCount		= sizeof(ColorRGBA) * 8;							// 32-bit (RGBA)
+	bmi.bmiHeader.biCompression		= BI_BITFIELDS;										// Channel masks follow the header
+	bmi.masks[0]					= 0x000000FF;										// Red
+	bmi.masks[1]					= 0x0000FF00;										// Green
+	bmi.masks[2]					= 0x00FF0000;										// Blue
+
+	this->paintBitmap(pixels, pitch, reinterpret_cast<BITMAPINFO*>(&bmi), width, height, dstX, dstY);
+}
+
+
+/**
+ *	@brief		Allocates the DIB section with the given extent.
+ *	@details	The memory DC is created once and kept for the lifetime of the framebuffer. A new DIB section
+ *				is only created when the requested extent differs from the current one.
+ *	@return		`true` if the framebuffer is valid after the call.
+ */
+bool easywin32::Framebuffer::resize(int width, int height)
+{
+	if ((width == m_width) && (height == m_height) && (m_hBitmap != nullptr))
+		return true;
+
+	if ((width <= 0) || (height <= 0))
+	{
+		this->release();
+
+		return false;
+	}
+
+	if (m_hMemDC == nullptr)
+	{
+		m_hMemDC = ::CreateCompatibleDC(nullptr);
+
+		if (m_hMemDC == nullptr)
+			return false;
+	}
+
+	BITMAPINFO bmi = {};
+	bmi.bmiHeader.biSize			= sizeof(BITMAPINFOHEADER);
+	bmi.bmiHeader.biWidth			= width;
+	bmi.bmiHeader.biHeight			= -height;					// Negative = top-down bitmap
+	bmi.bmiHeader.biPlanes			= 1;
+	bmi.bmiHeader.biBitCount		= sizeof(ColorBGRA) * 8;	// 32-bit (BGRX)
+	bmi.bmiHeader.biCompression		= BI_RGB;					// No compression
+
+	void * bits = nullptr;
+
+	if ((m_hSection != nullptr) && (static_cast<size_t>(width) * height * sizeof(ColorBGRA) > m_sectionCapacity))
+	{
+		this->release();
+
+		return false;
+	}
+
+	HBITMAP hBitmap = ::CreateDIBSection(m_hMemDC, &bmi, DIB_RGB_COLORS, &bits, m_hSection, m_sectionOffset);
+
+	if (hBitmap == nullptr)
+		return false;
+
+	HGDIOBJ hPrevBitmap = ::SelectObject(m_hMemDC, hBitmap);
+
+	if (m_hBitmap == nullptr)
+		m_hDefaultBitmap = hPrevBitmap;		// Remember the stock bitmap for restoration
+	else
+		::DeleteObject(m_hBitmap);
+
+	m_pixels = static_cast<ColorBGRA*>(bits);
+	m_hBitmap = hBitmap;
+	m_height = height;
+	m_width = width;
+
+	return true;
+}
+
+
+//!	@brief	Releases the DIB section and the cached memory DC.
+void easywin32::Framebuffer::release()
+{
+	if (m_hMemDC != nullptr)
+	{
+		if (m_hBitmap != nullptr)
+		{
+			::SelectObject(m_hMemDC, m_hDefaultBitmap);
+
+			::DeleteObject(m_hBitmap);
+		}
+
+		::DeleteDC(m_hMemDC);
+	}
+
+	m_hDefaultBitmap = nullptr;
+	m_hBitmap = nullptr;
+	m_hMemDC = nullptr;
+	m_pixels = nullptr;
+	m_height = 0;
+	m_width = 0;
+}
+
+
+//!	@brief	Places the pixels of the following DIB sections in a file mapping.
+void easywin32::Framebuffer::setSection(HANDLE hSection, DWORD offset, size_t capacity)
+{
+	this->release();
+
+	m_hSection = hSection;
+
+	m_sectionOffset = (hSection != nullptr) ? offset : 0;
+
+	m_sectionCapacity = (hSection != nullptr) ? capacity : 0;
+}
+
+
+//!	@brief	Opens the framebuffer shared under `name`.
+bool easywin32::SharedFramebufferWriter::open(const string_type & name)
+{
+	this->close();
+
+	m_hSection = ::OpenFileMapping(FILE_MAP_READ | FILE_MAP_WRITE, FALSE, name.c_str());
+
+	if (m_hSection == nullptr)
+		return false;
+
+	auto header = static_cast<SharedFramebufferHeader*>(::MapViewOfFile(m_hSection, FILE_MAP_READ | FILE_MAP_WRITE, 0, 0, 0));
+
+	m_hFrameEvent = ::OpenEvent(EVENT_MODIFY_STATE | SYNCHRONIZE, FALSE, (name + TEXT(".Frame")).c_str());
+
+	m_hPresentedEvent = ::OpenEvent(EVENT_MODIFY_STATE | SYNCHRONIZE, FALSE, (name + TEXT(".Presented")).c_str());
+
+	//	The header is not trusted: the pixels it describes must lie inside the view
+	MEMORY_BASIC_INFORMATION view = {};
+
+	if ((header != nullptr) && (::VirtualQuery(header, &view, sizeof(view)) != sizeof(view)))
+		view.RegionSize = 0;
+
+	if ((header == nullptr) || (std::memcmp(header->magic, "EZFB", 4) != 0) || (header->version != SharedFramebufferHeader::Version) ||
+		(header->pixelOffset < sizeof(SharedFramebufferHeader)) || (static_cast<uint64_t>(header->pixelOffset) + header->capacity > view.RegionSize) ||
+		(m_hFrameEvent == nullptr) || (m_hPresentedEvent == nullptr))
+	{
+		if (header != nullptr)		::UnmapViewOfFile(header);
+
+		this->close();
+
+		return false;
+	}
+
+	m_header = header;
+
+	m_sequence = header->sequence.load(std::memory_order_relaxed);
+
+	return true;
+}
+
+
+//!	@brief	Unmaps the framebuffer.
+void easywin32::SharedFramebufferWriter::close()
+{
+	if (m_header != nullptr)			::UnmapViewOfFile(m_header);		// A frame left unfinished stays odd, the next writer completes it
+	if (m_hFrameEvent != nullptr)		::CloseHandle(m_hFrameEvent);
+	if (m_hPresentedEvent != nullptr)	::CloseHandle(m_hPresentedEvent);
+	if (m_hSection != nullptr)			::CloseHandle(m_hSection);
+
+	m_header = nullptr;
+	m_hFrameEvent = nullptr;
+	m_hPresentedEvent = nullptr;
+	m_hSection = nullptr;
+	m_sequence = 0;
+	m_width = 0;
+	m_height = 0;
+}
+
+
+/**
+ *	@brief		Starts a frame, at the extent presented by the viewer.
+ *	@details	Makes the sequence odd before any pixel is written, so that the viewer skips the frame until `endWrite`.
+ */
+easywin32::ColorBGRA * easywin32::SharedFramebufferWriter::beginWrite(int & width, int & height)
+{
+	width = height = 0;
+
+	if (m_header == nullptr)
+		return nullptr;
+
+	int w = m_header->width.load(std::memory_order_acquire);
+
+	int h = m_header->height.load(std::memory_order_acquire);
+
+	if ((w <= 0) || (h <= 0) || (static_cast<uint64_t>(w) * static_cast<uint64_t>(h) * sizeof(ColorBGRA) > m_header->capacity))
+		return nullptr;
+
+	if ((m_sequence & 1) == 0)		// Not already inside a frame (e.g. after a crash of the previous writer)
+	{
+		m_sequence++;
+
+		m_header->sequence.store(m_sequence, std::memory_order_relaxed);
+
+		std::atomic_thread_fence(std::memory_order_release);		// Odd before the pixels
+	}
+
+	m_width = width = w;
+
+	m_height = height = h;
+
+	return reinterpret_cast<ColorBGRA*>(reinterpret_cast<char*>(m_header) + m_header->pixelOffset);
+}
+
+
+//!	@brief	Publishes the frame started by `beginWrite` and wakes up the viewer.
+void easywin32::SharedFramebufferWriter::endWrite()
+{
+	if ((m_header == nullptr) || ((m_sequence & 1) == 0))
+		return;
+
+	m_header->frameWidth.store(m_width, std::memory_order_relaxed);
+
+	m_header->frameHeight.store(m_height, std::memory_order_relaxed);
+
+	m_header->sequence.store(++m_sequence, std::memory_order_release);		// Even after the pixels
+
+	::SetEvent(m_hFrameEvent);
+}
+
+
+//!	@brief	Copies the framebuffer to the target device context.
+void easywin32::Framebuffer::present(HDC hdc, int dstX, int dstY) const
+{
+	if (m_hBitmap != nullptr)
+	{
+		::GdiFlush();	// Ensure pending GDI operations on the DIB section have completed
+
+		::BitBlt(hdc, dstX, dstY, m_width, m_height, m_hMemDC, 0, 0, SRCCOPY);
+	}
+}
+
+
+//!	@brief	Copies only the given regions of the framebuffer to the target device context.
+void easywin32::Framebuffer::present(HDC hdc, const Rect * rects, size_t count, int dstX, int dstY) const
+{
+	if (m_hBitmap != nullptr)
+	{
+		::GdiFlush();	// Ensure pending GDI operations on the DIB section have completed
+
+		const Rect bounds = { 0, 0, m_width, m_height };
+
+		for (size_t i = 0; i < count; i++)
+		{
+			Rect rect = {};
+
+			if (::IntersectRect(&rect, &rects[i], &bounds))
+			{
+				::BitBlt(hdc, dstX + rect.left, dstY + rect.top, rect.right - rect.left, rect.bottom - rect.top, m_hMemDC, rect.left, rect.top, SRCCOPY);
+			}
+		}
+	}
+}
+
+
+//!	@brief	Sets the window opacity, through `UpdateLayeredWindow` once `presentLayered` owns the content.
+void easywin32::Window::setOpacity(Byte opacity)
+{
+	m_opacity = opacity;
+
+	if (m_layeredContent)
+	{
+		BLENDFUNCTION blend = { AC_SRC_OVER, 0, opacity, AC_SRC_ALPHA };
+
+		::UpdateLayeredWindow(m_hWnd, nullptr, nullptr, nullptr, nullptr, nullptr, 0, &blend, ULW_ALPHA);		// Keeps the current content
+	}
+	else
+	{
+		::SetLayeredWindowAttributes(m_hWnd, 0, opacity, LWA_ALPHA);
+	}
+}
+
+
+/**
+ *	@brief		Sets the content of the layered window to the given straight-alpha pixels.
+ *	@details	`UpdateLayeredWindowIndirect` accepts a single dirty rectangle, so the dirty rectangles are only
+ *				converted individually and their bounding box is recomposed.
+ */
+bool easywin32::Window::presentLayered(const ColorRGBA * pixels, int width, int height, size_t pitch, const Rect * dirtyRects, size_t count)
+{
+	if ((m_dwExStyle & WS_EX_LAYERED) == 0)		return false;
+
+	if (pitch == 0)		pitch = static_cast<size_t>(width) * sizeof(ColorRGBA);
+
+	assert((pitch % sizeof(ColorRGBA) == 0) && (pitch >= static_cast<size_t>(width) * sizeof(ColorRGBA)));
+
+	const bool fullUpdate = !m_layeredContent || (dirtyRects == nullptr) || (m_layeredSurface.getWidth() != width) || (m_layeredSurface.getHeight() != height);
+
+	if (!m_layeredSurface.resize(width, height))
+		return false;
+
+	if (!m_layeredContent)
+	{
+		//	UpdateLayeredWindow fails after SetLayeredWindowAttributes until the layered bit is set again
+		const DWORD dwExStyle = m_dwExStyle;
+
+		::SetWindowLongPtr(m_hWnd, GWL_EXSTYLE, static_cast<LONG_PTR>(dwExStyle & ~WS_EX_LAYERED));
+
+		::SetWindowLongPtr(m_hWnd, GWL_EXSTYLE, static_cast<LONG_PTR>(dwExStyle));
+
+		m_layeredContent = true;
+	}
+
+	const Rect bounds = { 0, 0, width, height };
+
+	const Rect * rects = fullUpdate ? &bounds : dirtyRects;
+
+	const size_t rectCount = fullUpdate ? 1 : count;
+
+	Rect dirty = {};
+
+	for (size_t i = 0; i < rectCount; i++)
+	{
+		Rect rect = {};
+
+		if (::IntersectRect(&rect, &rects[i], &bounds))
+		{
+			for (int y = rect.top; y < rect.bottom; y++)
+			{
+				auto row = reinterpret_cast<const ColorRGBA*>(reinterpret_cast<const Byte*>(pixels) + pitch * y);
+
+				easywin32::premultiplyPixels(row + rect.left, m_layeredSurface.getRow(y) + rect.left, static_cast<size_t>(rect.right - rect.left));
+			}
+
+			::UnionRect(&dirty, &dirty, &rect);
+		}
+	}
+
+	if (::IsRectEmpty(&dirty))
+		return true;
+
+	::GdiFlush();	// Ensure the DIB section is up to date before DWM reads it
+
+	SIZE size = { width, height };
+
+	POINT srcPos = { 0, 0 };
+
+	BLENDFUNCTION blend = { AC_SRC_OVER, 0, m_opacity, AC_SRC_ALPHA };
+
+	UPDATELAYEREDWINDOWINFO info = {};
+	info.cbSize		= sizeof(UPDATELAYEREDWINDOWINFO);
+	info.psize		= &size;
+	info.hdcSrc		= m_layeredSurface.nativeDC();
+	info.pptSrc		= &srcPos;
+	info.pblend		= &blend;
+	info.dwFlags	= ULW_ALPHA;
+	info.prcDirty	= fullUpdate ? nullptr : &dirty;
+
+	return ::UpdateLayeredWindowIndirect(m_hWnd, &info) != FALSE;
+}
+
+
+//!	@brief	Resizes the framebuffer and the presenter to the given client extent.
+void easywin32::Window::resizeSurfaces(int width, int height)
+{
+	if (m_enableFramebuffer)
+	{
+		this->resizeFramebuffer(width, height);
+	}
+
+	if (m_presenter != nullptr)
+	{
+		m_presenter->resize(width, height);
+	}
+}
+
+
+//!	@brief	Enables or disables the persistent window framebuffer.
+void easywin32::Window::enableFramebuffer(bool enable)
+{
+	m_enableFramebuffer = enable;
+
+	if (enable)
+	{
+		auto extent = this->getClientExtent();
+
+		this->resizeFramebuffer(extent.cx, extent.cy);
+	}
+	else
+	{
+		this->resizeFramebuffer(0, 0);		// Releases it, and publishes the empty extent if shared
+	}
+}
+
+
+//!	@brief	Resizes the framebuffer to the given client extent, clamped to the shared section and published in its header.
+void easywin32::Window::resizeFramebuffer(int width, int height)
+{
+	if (m_shared.header != nullptr)
+	{
+		width = (width < m_shared.maxExtent.cx) ? width : m_shared.maxExtent.cx;
+
+		height = (height < m_shared.maxExtent.cy) ? height : m_shared.maxExtent.cy;
+	}
+
+	m_framebuffer.resize(width, height);
+
+	if (m_shared.header != nullptr)
+	{
+		//	Read by the producer before each frame, a torn pair is caught by the capacity check of `beginWrite`
+		m_shared.header->width.store(m_framebuffer.getWidth(), std::memory_order_release);
+
+		m_shared.header->height.store(m_framebuffer.getHeight(), std::memory_order_release);
+	}
+}
+
+
+//!	@brief	Blits the window framebuffer to the client area immediately.
+void easywin32::Window::presentFramebuffer()
+{
+	if (m_framebuffer.isValid())
+	{
+		HDC hdc = ::GetDC(m_hWnd);
+
+		m_framebuffer.present(hdc);
+
+		::ReleaseDC(m_hWnd, hdc);
+
+		::ValidateRect(m_hWnd, nullptr);	// The client area is up to date, drop pending WM_PAINT
+
+		if (m_frameCapture != nullptr)
+		{
+			m_frameCapture->capture(m_framebuffer);
+		}
+	}
+}
+
+
+//!	@brief	Blits only the given dirty rectangles (client coordinates) of the window framebuffer.
+void easywin32::Window::presentFramebuffer(const Rect * dirtyRects, size_t count)
+{
+	if (m_framebuffer.isValid())
+	{
+		HDC hdc = ::GetDC(m_hWnd);
+
+		m_framebuffer.present(hdc, dirtyRects, count);
+
+		::ReleaseDC(m_hWnd, hdc);
+
+		for (size_t i = 0; i < count; i++)
+		{
+			::ValidateRect(m_hWnd, &dirtyRects[i]);
+		}
+
+		if (m_frameCapture != nullptr)
+		{
+			m_frameCapture->capture(m_framebuffer);		// The whole frame, the rest of it is still on screen
+		}
+	}
+}
+
+
+/**
+ *	@brief		Enables the framebuffer and moves its pixels into a named section that other processes can write to.
+ *	@details	Only the header page is mapped here: the pixels are mapped by `CreateDIBSection`, so GDI blits them
+ *				straight from the pages written by the producer.
+ */
+bool easywin32::Window::shareFramebuffer(const string_type & name, int maxWidth, int maxHeight, const SECURITY_ATTRIBUTES * security)
+{
+	this->unshareFramebuffer();
+
+	const uint64_t capacity = static_cast<uint64_t>(maxWidth > 0 ? maxWidth : 0) * static_cast<uint64_t>(maxHeight > 0 ? maxHeight : 0) * sizeof(ColorBGRA);
+
+	if ((m_hWnd == nullptr) || (capacity == 0) || (capacity > UINT32_MAX))
+		return false;
+
+	const uint64_t size = SharedFramebufferHeader::PixelOffset + capacity;
+
+	auto attributes = const_cast<SECURITY_ATTRIBUTES*>(security);
+
+	HANDLE hSection = ::CreateFileMapping(INVALID_HANDLE_VALUE, attributes, PAGE_READWRITE, static_cast<DWORD>(size >> 32), static_cast<DWORD>(size), name.c_str());
+
+	if ((hSection == nullptr) || (::GetLastError() == ERROR_ALREADY_EXISTS))		// Shared by another viewer
+	{
+		if (hSection != nullptr)		::CloseHandle(hSection);
+
+		return false;
+	}
+
+	void * view = ::MapViewOfFile(hSection, FILE_MAP_ALL_ACCESS, 0, 0, SharedFramebufferHeader::PixelOffset);
+
+	m_shared.hSection = hSection;
+
+	m_shared.hFrameEvent = ::CreateEvent(attributes, FALSE, FALSE, (name + TEXT(".Frame")).c_str());
+
+	const bool frameEventExists = (::GetLastError() == ERROR_ALREADY_EXISTS);
+
+	m_shared.hPresentedEvent = ::CreateEvent(attributes, FALSE, FALSE, (name + TEXT(".Presented")).c_str());
+
+	const bool presentedEventExists = (::GetLastError() == ERROR_ALREADY_EXISTS);
+
+	//	Events already created by someone else could be signaled at will, or never
+	if ((view == nullptr) || (m_shared.hFrameEvent == nullptr) || (m_shared.hPresentedEvent == nullptr) || frameEventExists || presentedEventExists)
+	{
+		if (view != nullptr)		::UnmapViewOfFile(view);
+
+		this->unshareFramebuffer();
+
+		return false;
+	}
+
+	auto header = new (view) SharedFramebufferHeader{};		// The pages of a new section are zeroed
+
+	header->version			= SharedFramebufferHeader::Version;
+	header->pixelOffset		= SharedFramebufferHeader::PixelOffset;
+	header->capacity		= static_cast<uint32_t>(capacity);
+
+	std::atomic_thread_fence(std::memory_order_release);
+
+	std::memcpy(header->magic, "EZFB", 4);		// Last, writers check it
+
+	m_shared.header = header;
+
+	m_shared.maxExtent = Size{ maxWidth, maxHeight };
+
+	m_shared.presented = 0;
+
+	m_framebuffer.setSection(hSection, SharedFramebufferHeader::PixelOffset, static_cast<size_t>(capacity));
+
+	this->enableFramebuffer(true);
+
+	const Size extent = this->getClientExtent();
+
+	if (m_framebuffer.isValid() || (extent.cx <= 0) || (extent.cy <= 0))		// Minimized: the DIB section follows at the next `WM_SIZE`
+		return true;
+
+	this->unshareFramebuffer();
+
+	return false;
+}
+
+
+//!	@brief	Closes the shared section, the framebuffer (if still enabled) moves back to private memory.
+void easywin32::Window::unshareFramebuffer()
+{
+	if (m_shared.hSection == nullptr)
+		return;
+
+	m_framebuffer.setSection(nullptr, 0, 0);		// The DIB section must be deleted before its section is closed
+
+	if (m_shared.header != nullptr)				::UnmapViewOfFile(m_shared.header);
+	if (m_shared.hFrameEvent != nullptr)		::CloseHandle(m_shared.hFrameEvent);
+	if (m_shared.hPresentedEvent != nullptr)	::CloseHandle(m_shared.hPresentedEvent);
+
+	::CloseHandle(m_shared.hSection);
+
+	m_shared = SharedSection{};
+
+	if (m_enableFramebuffer && (m_hWnd != nullptr))
+	{
+		auto extent = this->getClientExtent();
+
+		m_framebuffer.resize(extent.cx, extent.cy);
+	}
+}
+
+
+//!	@brief	Presents the last frame written into the shared framebuffer, if it is complete and not presented yet.
+bool easywin32::Window::presentSharedFrame()
+{
+	auto header = m_shared.header;
+
+	if ((header == nullptr) || !m_framebuffer.isValid())
+		return false;
+
+	const uint32_t sequence = header->sequence.load(std::memory_order_acquire);
+
+	if ((sequence & 1) || (sequence == m_shared.presented))		// Being written, or already presented
+		return false;
+
+	if ((header->frameWidth.load(std::memory_order_relaxed) != m_framebuffer.getWidth()) ||
+		(header->frameHeight.load(std::memory_order_relaxed) != m_framebuffer.getHeight()))
+	{
+		return false;		// Written before a resize, the next one will fit
+	}
+
+	this->presentFramebuffer();
+
+	::GdiFlush();		// The blit must have read the pages before the sequence is checked again
+
+	//	Seqlock validation: the producer did not start another frame during the blit
+	std::atomic_thread_fence(std::memory_order_acquire);
+
+	if (header->sequence.load(std::memory_order_relaxed) != sequence)
+		return false;
+
+	m_shared.presented = sequence;
+
+	header->presented.store(sequence, std::memory_order_release);
+
+	::SetEvent(m_shared.hPresentedEvent);
+
+	return true;
+}
+
+
+/**
+ *	@brief		Blits the framebuffer in response to `WM_PAINT`, clipped to the update region.
+ *	@details	A shared framebuffer is only blitted while its pages still hold the last frame presented: otherwise
+ *				the producer is writing (or has written) another one, which `presentSharedFrame` presents whole.
+ */
+void easywin32::Window::paintFramebuffer()
 {
-	// Retrieve the stored Window* from the window's user data
-	auto window = reinterpret_cast<Window*>(::GetWindowLongPtr(hWnd, GWLP_USERDATA));
+	this->collectUpdateRects();
 
-	if (uMsg == WM_CREATE)	// Retrieve the use pointer
+	PAINTSTRUCT ps = {};
+
+	HDC hdc = ::BeginPaint(m_hWnd, &ps);
+
+	const bool pending = (m_shared.header != nullptr) && (m_shared.header->sequence.load(std::memory_order_acquire) != m_shared.presented);
+
+	if (!pending)
 	{
-		CREATESTRUCT * createStrcut = reinterpret_cast<CREATESTRUCT*>(lParam);
+		if (m_updateRects.empty())
+			m_framebuffer.present(hdc, &ps.rcPaint, 1);
+		else
+			m_framebuffer.present(hdc, m_updateRects.data(), m_updateRects.size());
+	}
 
-		::SetWindowLongPtr(hWnd, GWLP_USERDATA, reinterpret_cast<LONG_PTR>(createStrcut->lpCreateParams));
+	::EndPaint(m_hWnd, &ps);
+}
+
+
+/**
+ *	@brief		Waits for and processes the next window message.
+ *	@details	This call will block until a new message is available in the queue for this window.
+ *				It retrieves the message with `GetMessage`, translates it (e.g. converts virtual-key
+ *				messages into character messages), and dispatches it to the window procedure.
+ */
+void easywin32::Window::waitEvent()
+{
+	if (m_hWnd != nullptr)
+	{
+		MSG message = {};
+
+		if (::GetMessage(&message, m_hWnd, 0, 0))
+		{
+			::TranslateMessage(&message);
+
+			::DispatchMessage(&message);
+		};
 	}
-	else if (uMsg == WM_NCCALCSIZE)
+}
+
+
+/**
+ *	@brief		Processes all pending window messages, if available.
+ *	@details	Uses `PeekMessage` to check for all messages in the queue for this window.
+ *				If a message exists, it is translated and dispatched to the window procedure.
+ *	@return		`true` if a message was processed, `false` if no messages were pending.
+ */
+bool easywin32::Window::processEvents()
+{
+	bool hasEvent = false;
+
+	if (m_hWnd != nullptr)
 	{
-		if constexpr (SkipCaption)
+		MSG message = {};
+
+		while (::PeekMessage(&message, m_hWnd, 0, 0, PM_REMOVE))
 		{
-			// When skipping the caption area, adjust the client region manually.
-			NCCALCSIZE_PARAMS * params = (NCCALCSIZE_PARAMS*)lParam;
+			::TranslateMessage(&message);
+
+			::DispatchMessage(&message);
+
+			hasEvent = true;
+		};
+	}
+
+	return hasEvent;
+}
+
+
+namespace easywin32
+{
+	namespace details
+	{
+		//!	@brief	Shared implementation of `Window::waitEvents` (`hWnd` != nullptr) and `ThreadWindows::waitEvents`.
+		static inline WaitResult waitEvents(HWND hWnd, const HANDLE * handles, size_t count, DWORD timeout)
+		{
+			auto processEvents = [hWnd]()
+			{
+				MSG message = {};
+
+				bool hasEvent = false;
+
+				while (::PeekMessage(&message, hWnd, 0, 0, PM_REMOVE))
+				{
+					::TranslateMessage(&message);
+
+					::DispatchMessage(&message);
+
+					hasEvent = true;
+				}
+
+				return hasEvent;
+			};
+
+			assert(count < MAXIMUM_WAIT_OBJECTS);
+
+			if (processEvents())
+			{
+				return WaitResult{ WaitSource::Message, 0 };
+			}
+
+			//	Messages of other windows may still be queued when filtering by window: only wake up on new ones then
+			DWORD flags = (hWnd == nullptr) ? MWMO_INPUTAVAILABLE : 0;
+
+			DWORD numHandles = static_cast<DWORD>(count);
+
+			DWORD status = ::MsgWaitForMultipleObjectsEx(numHandles, handles, timeout, QS_ALLINPUT, flags);
+
+			if (status < WAIT_OBJECT_0 + numHandles)
+			{
+				return WaitResult{ WaitSource::Handle, status - WAIT_OBJECT_0 };
+			}
+			else if (status == WAIT_OBJECT_0 + numHandles)
+			{
+				processEvents();
+
+				return WaitResult{ WaitSource::Message, 0 };
+			}
+			else if ((status >= WAIT_ABANDONED_0) && (status < WAIT_ABANDONED_0 + numHandles))
+			{
+				return WaitResult{ WaitSource::Abandoned, status - WAIT_ABANDONED_0 };
+			}
+			else if (status == WAIT_TIMEOUT)
+			{
+				return WaitResult{ WaitSource::Timeout, 0 };
+			}
+
+			return WaitResult{ WaitSource::Failed, 0 };
+		}
+	}
+}
+
+
+/**
+ *	@brief		Sleeps until a message of this window arrives, one of `handles` is signaled, or `timeout` elapses.
+ */
+easywin32::WaitResult easywin32::Window::waitEvents(const HANDLE * handles, size_t count, DWORD timeout)
+{
+	if (m_hWnd == nullptr)
+	{
+		return WaitResult{ WaitSource::Failed, 0 };
+	}
+
+	return details::waitEvents(m_hWnd, handles, count, timeout);
+}
+
+
+/**
+ *	@brief		Runs a paced frame loop until the window is closed or `callback` returns `false`.
+ *	@param[in]	targetHz - Target frame rate, or `<= 0` to pace frames to DWM composition.
+ *	@param[in]	callback - Called once per frame, returns `false` to stop.
+ */
+void easywin32::Window::runFrameLoop(double targetHz, Callback<bool(const FrameStats & stats)> callback)
+{
+	LARGE_INTEGER frequency = {};		::QueryPerformanceFrequency(&frequency);
+
+	auto now = []() { LARGE_INTEGER counter = {};	::QueryPerformanceCounter(&counter);	return counter.QuadPart; };
+
+	auto toSeconds = [&](LONGLONG ticks) { return static_cast<double>(ticks) / frequency.QuadPart; };
+
+	FrameStats stats = {};
+
+	HANDLE hTimer = nullptr;
+
+	LONGLONG interval = 0;
+
+	if (targetHz > 0.0)
+	{
+		hTimer = ::CreateWaitableTimerEx(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+
+		if (hTimer == nullptr)
+		{
+			hTimer = ::CreateWaitableTimerEx(nullptr, nullptr, 0, TIMER_ALL_ACCESS);
+		}
+
+		interval = static_cast<LONGLONG>(frequency.QuadPart / targetHz);
+	}
+	else
+	{
+		DWM_TIMING_INFO timingInfo = {};		timingInfo.cbSize = sizeof(timingInfo);
+
+		if (SUCCEEDED(::DwmGetCompositionTimingInfo(nullptr, &timingInfo)))
+		{
+			interval = static_cast<LONGLONG>(timingInfo.qpcRefreshPeriod);
+		}
+	}
+
+	stats.targetInterval = toSeconds(interval);
+
+	LONGLONG startTime = now();
+	LONGLONG deadline = startTime;
+	LONGLONG lastFrameTime = startTime;
+	LONGLONG periodStartTime = startTime;
+	uint64_t periodFrames = 0;
+	double periodMaxJitter = 0.0;
+	bool keepRunning = true;
+
+	//	Runs one frame, returns the time at which it was presented
+	auto runFrame = [&]()
+	{
+		LONGLONG frameTime = now();
+
+		stats.time = toSeconds(frameTime - startTime);
+
+		stats.deltaTime = toSeconds(frameTime - lastFrameTime);
+
+		stats.jitter = (stats.frameIndex != 0) && (interval != 0) ? std::abs(stats.deltaTime - stats.targetInterval) : 0.0;
+
+		if (stats.jitter > periodMaxJitter)		periodMaxJitter = stats.jitter;
+
+		lastFrameTime = frameTime;
+
+		periodFrames++;
+
+		//	Refresh averages every half second
+		if (frameTime - periodStartTime >= frequency.QuadPart / 2)
+		{
+			stats.fps = static_cast<double>(periodFrames) / toSeconds(frameTime - periodStartTime);
+
+			stats.maxJitter = periodMaxJitter;
+
+			periodStartTime = frameTime;
+
+			periodMaxJitter = 0.0;
+
+			periodFrames = 0;
+		}
+
+		keepRunning = callback(stats);
+
+		LONGLONG callbackEndTime = now();
+
+		if ((m_hWnd != nullptr) && m_framebuffer.isValid())
+		{
+			this->presentFramebuffer();
+		}
+
+		LONGLONG presentEndTime = now();
+
+		stats.cpuTime = toSeconds(callbackEndTime - frameTime);
+
+		stats.presentTime = toSeconds(presentEndTime - callbackEndTime);
+
+		stats.frameIndex++;
+
+		return presentEndTime;
+	};
+
+	//	Frames driven by the live-resize timer while `processEvents` is stuck in the modal size/move loop
+	m_frameTick = [&]() { if (keepRunning)	runFrame(); };
+
+	while (m_hWnd != nullptr)
+	{
+		ThreadWindows::processEvents();
+
+		if ((m_hWnd == nullptr) || !keepRunning)		break;
+
+		//	Not visible: nothing to draw, sleep until the next message (all changes but occlusion come with one)
+		Visibility visibility = this->getVisibility();
+
+		if (visibility != Visibility::Visible)
+		{
+			//	Occlusion ends silently, unless the presenter registered for DXGI notifications: test it 4 times per second
+			DWORD timeout = (visibility == Visibility::Occluded) ? 250 : INFINITE;
+
+			if (::MsgWaitForMultipleObjectsEx(0, nullptr, timeout, QS_ALLINPUT, MWMO_INPUTAVAILABLE) == WAIT_TIMEOUT)
+			{
+				this->setOccluded((m_presenter != nullptr) && m_presenter->testOcclusion());
+			}
+
+			deadline = now();
+
+			continue;
+		}
+
+		//	Wait for the frame deadline, waking up early to dispatch messages
+		if (hTimer != nullptr)
+		{
+			LONGLONG remaining = deadline - now();
+
+			if (remaining > 0)
+			{
+				LARGE_INTEGER dueTime = {};		dueTime.QuadPart = -((remaining * 10'000'000) / frequency.QuadPart + 1);
+
+				::SetWaitableTimer(hTimer, &dueTime, 0, nullptr, nullptr, FALSE);
+
+				if (::MsgWaitForMultipleObjectsEx(1, &hTimer, INFINITE, QS_ALLINPUT, MWMO_INPUTAVAILABLE) != WAIT_OBJECT_0)
+				{
+					continue;
+				}
+			}
+		}
+		else if (FAILED(::DwmFlush()))
+		{
+			::MsgWaitForMultipleObjectsEx(0, nullptr, 16, QS_ALLINPUT, MWMO_INPUTAVAILABLE);
+		}
+
+		LONGLONG presentEndTime = runFrame();
+
+		if (!keepRunning)		break;
+
+		//	Schedule the next frame on a fixed cadence, resynchronizing instead of bursting after a stall
+		deadline += interval;
+
+		if (presentEndTime - deadline > interval)
+		{
+			deadline = presentEndTime;
+		}
+	}
+
+	m_frameTick = nullptr;
+
+	if (hTimer != nullptr)
+	{
+		::CloseHandle(hTimer);
+	}
+}
+
+
+/**
+ *	@brief		Sleeps until a message arrives, one of `handles` is signaled, or `timeout` elapses.
+ */
+easywin32::WaitResult easywin32::ThreadWindows::waitEvents(const HANDLE * handles, size_t count, DWORD timeout)
+{
+	return details::waitEvents(nullptr, handles, count, timeout);
+}
+
+
+/**
+ *	@brief		Waits for and processes the next message for all windows belonging to the current thread.
+ *	@details	This function blocks until a message is available in the message queue of the
+ *				current thread (regardless of which window it belongs to).
+ *	@note		Unlike per-window message processing, passing `nullptr` as `hWnd` allows
+ *				messages for any window in this thread to be retrieved.
+ */
+void easywin32::ThreadWindows::waitEvent()
+{
+	MSG message = {};
+
+	if (::GetMessage(&message, nullptr, 0, 0))
+	{
+		::TranslateMessage(&message);
+
+		::DispatchMessage(&message);
+	};
+}
+
+
+/**
+ * @brief      Processes all pending messages, if available.
+ * @details    Uses `PeekMessage` to check for all messages in the queue for this thread.
+ *             If a message exists, it is translated and dispatched to the window procedure.
+ * @return     `true` if an event was processed, `false` if no messages were pending.
+ */
+bool easywin32::ThreadWindows::processEvents()
+{
+	MSG message = {};
+
+	bool hasEvent = false;
+
+	while (::PeekMessage(&message, nullptr, 0, 0, PM_REMOVE))
+	{
+		::TranslateMessage(&message);
+
+		::DispatchMessage(&message);
+
+		hasEvent = true;
+	};
 
-			long top = params->rgrc[0].top;		// Backup original top value
+	return hasEvent;
+}
 
-			// Let the default window proc calculate the base frame
-			LRESULT res = ::DefWindowProc(hWnd, uMsg, wParam, lParam);
 
-			if (::IsZoomed(hWnd))
-			{
-				constexpr int frameSize = 8;		//	win32 default size for drag
+//!	@brief	Starts a layout transaction for the windows of the current thread.
+void easywin32::ThreadWindows::beginLayout()
+{
+	Window::layoutTransaction().depth++;
+}
 
-				// When maximized, keep a small draggable frame area at the top
-				params->rgrc[0].top = top + frameSize;
-			}
-			else
-			{
-				// Otherwise, keep the top edge unchanged to fully skip caption area
-				params->rgrc[0].top = top;
-			}
 
-			return res;
-		}
-	}
-	else if (uMsg == WM_GETMINMAXINFO)
-	{
-		if (window != nullptr)
-		{
-			MINMAXINFO * mmi = (MINMAXINFO*)lParam;
+/**
+ *	@brief		Ends the transaction started by `beginLayout`, applying all recorded changes at once.
+ *	@details	If `DeferWindowPos` fails, the whole batch is discarded by Win32, so every request is applied again with `SetWindowPos`.
+ */
+bool easywin32::ThreadWindows::commitLayout()
+{
+	auto & transaction = Window::layoutTransaction();
 
-			mmi->ptMinTrackSize.x = window->m_minTrackSize.cx;
-			mmi->ptMinTrackSize.y = window->m_minTrackSize.cy;
-			mmi->ptMaxTrackSize.x = window->m_maxTrackSize.cx;
-			mmi->ptMaxTrackSize.y = window->m_maxTrackSize.cy;
+	assert(transaction.depth > 0);
 
-			return 0;
-		}
-	}
-	else if (uMsg == WM_DESTROY)	// Handle window destruction
+	if ((transaction.depth == 0) || (--transaction.depth > 0))
+		return true;
+
+	HDWP hDwp = ::BeginDeferWindowPos(static_cast<int>(transaction.requests.size()));
+
+	for (size_t i = 0; (i < transaction.requests.size()) && (hDwp != nullptr); i++)
 	{
-		::PostQuitMessage(0);		// Post a quit message to end the application message loop
-		
-		return 0;	// Message handled
+		hDwp = Window::applyLayout(transaction.requests[i], hDwp);
 	}
-	else if (window != nullptr)
-	{
-		Result result = -1;
 
-		// Forward messages to the user-defined callback first.
-		if (window->forwardMessage)
-		{
-			result = window->forwardMessage(hWnd, uMsg, wParam, lParam);
+	bool batched = (hDwp != nullptr) && ::EndDeferWindowPos(hDwp);
 
-			if (result != -1)
-				return result;
+	if (!batched)
+	{
+		for (const auto & request : transaction.requests)
+		{
+			Window::applyLayout(request, nullptr);
 		}
+	}
 
-		//	Dispatch standard messages to callbacks
-		switch (uMsg)
-		{
-			case WM_CLOSE:			if (window->onClose)			result = window->onClose();			break;
-			case WM_PAINT:			if (window->onPaint)			result = window->onPaint();			break;
-			case WM_TIMER:			if (window->onTimer)			result = window->onTimer(wParam);	break;
-			case WM_SETFOCUS:		if (window->onFocus)			result = window->onFocus(true);		break;
-			case WM_KILLFOCUS:		if (window->onFocus)			result = window->onFocus(false);	break;
-			case WM_MOUSELEAVE:		if (window->onMouseLeave)		result = window->onMouseLeave();	break;
-			case WM_EXITSIZEMOVE:	if (window->onExitMove)			result = window->onExitMove();		break;
-			case WM_ENTERSIZEMOVE:	if (window->onEnterMove)		result = window->onEnterMove();		break;
+	transaction.requests.clear();
 
-			case WM_CHAR:			if (window->onInputCharacter)	result = window->onInputCharacter(static_cast<wchar_t>(wParam));	break;
-			case WM_SYSCHAR:		if (window->onInputCharacter)	result = window->onInputCharacter(static_cast<wchar_t>(wParam));	break;
-			case WM_UNICHAR:		if (window->onInputCharacter)	result = window->onInputCharacter(static_cast<wchar_t>(wParam));	break;
+	return batched;
+}
 
-			case WM_MOVE:			if (window->onMove)				result = window->onMove(GET_X_LPARAM(lParam), GET_Y_LPARAM(lParam));				break;
-			case WM_SIZE:			if (window->onResize)			result = window->onResize(GET_X_LPARAM(lParam), GET_Y_LPARAM(lParam));				break;
-			case WM_NCHITTEST:		if (window->onHitTest)			result = (Result)window->onHitTest(GET_X_LPARAM(lParam), GET_Y_LPARAM(lParam));		break;
 
-			case WM_KEYUP:			if (window->onKeyboardPress)	result = window->onKeyboardPress(static_cast<Key>(wParam), KeyAction::Release);		break;
-			case WM_SYSKEYUP:		if (window->onKeyboardPress)	result = window->onKeyboardPress(static_cast<Key>(wParam), KeyAction::Release);		break;
+//!	@brief	Makes the windows opened afterwards by the current thread per-monitor DPI aware (v2).
+bool easywin32::ThreadWindows::enablePerMonitorDpiAwareness()
+{
+	auto setThreadDpiAwarenessContext = details::DpiFunctions::instance().setThreadDpiAwarenessContext;
 
-			case WM_KEYDOWN:		if (window->onKeyboardPress)	result = window->onKeyboardPress(static_cast<Key>(wParam), (lParam & (1 << 30)) ? KeyAction::Repeat : KeyAction::Press);		break;
-			case WM_SYSKEYDOWN:		if (window->onKeyboardPress)	result = window->onKeyboardPress(static_cast<Key>(wParam), (lParam & (1 << 30)) ? KeyAction::Repeat : KeyAction::Press);		break;
+	return (setThreadDpiAwarenessContext != nullptr) && (setThreadDpiAwarenessContext(DPI_AWARENESS_CONTEXT_PER_MONITOR_AWARE_V2) != nullptr);
+}
 
-			case WM_MOUSEMOVE:		if (window->onMouseMove)		result = window->onMouseMove(GET_X_LPARAM(lParam), GET_Y_LPARAM(lParam), static_cast<MouseState>(wParam & 127));				break;
-			case WM_MOUSEWHEEL:		if (window->onWheelScroll)		result = window->onWheelScroll(0, static_cast<SHORT>(HIWORD(wParam)) / WHEEL_DELTA, static_cast<MouseState>(wParam & 127));		break;
-			case WM_MOUSEHWHEEL:	if (window->onWheelScroll)		result = window->onWheelScroll(static_cast<SHORT>(HIWORD(wParam)) / WHEEL_DELTA, 0, static_cast<MouseState>(wParam & 127));		break;
+/*********************************************************************************
+*****************************    convertPixels    ********************************
+*********************************************************************************/
 
-			case WM_LBUTTONUP:		if (window->onMouseClick)		result = window->onMouseClick(MouseButton::Left, MouseAction::Up, static_cast<MouseState>(wParam & 127));		break;
-			case WM_RBUTTONUP:		if (window->onMouseClick)		result = window->onMouseClick(MouseButton::Right, MouseAction::Up, static_cast<MouseState>(wParam & 127));		break;
-			case WM_MBUTTONUP:		if (window->onMouseClick)		result = window->onMouseClick(MouseButton::Middle, MouseAction::Up, static_cast<MouseState>(wParam & 127));		break;
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+	#define EZWIN32_ARCH_X86
+	#if defined(_MSC_VER) && !defined(__clang__)
+		#include <intrin.h>
+		#define EZWIN32_TARGET(isa)
+	#else
+		#include <cpuid.h>
+		#include <immintrin.h>
+		#define EZWIN32_TARGET(isa)		__attribute__((target(isa)))
+	#endif
+#endif
 
-			case WM_LBUTTONDOWN:	if (window->onMouseClick)		result = window->onMouseClick(MouseButton::Left, MouseAction::Down, static_cast<MouseState>(wParam & 127));			break;
-			case WM_RBUTTONDOWN:	if (window->onMouseClick)		result = window->onMouseClick(MouseButton::Right, MouseAction::Down, static_cast<MouseState>(wParam & 127));		break;
-			case WM_MBUTTONDOWN:	if (window->onMouseClick)		result = window->onMouseClick(MouseButton::Middle, MouseAction::Down, static_cast<MouseState>(wParam & 127));		break;
+namespace easywin32
+{
+	namespace details
+	{
+		//!	@brief	Scalar RGB -> BGRX conversion, also used for the tails of the SIMD kernels.
+		static inline void convertPixelsScalar(const ColorRGB * src, ColorBGRA * dst, size_t count)
+		{
+			for (size_t i = 0; i < count; i++)
+			{
+				dst[i] = ColorBGRA{ src[i].b, src[i].g, src[i].r, 255 };
+			}
+		}
 
-			case WM_LBUTTONDBLCLK:	if (window->onMouseClick)		result = window->onMouseClick(MouseButton::Left, MouseAction::DoubleClick, static_cast<MouseState>(wParam & 127));		break;
-			case WM_RBUTTONDBLCLK:	if (window->onMouseClick)		result = window->onMouseClick(MouseButton::Right, MouseAction::DoubleClick, static_cast<MouseState>(wParam & 127));		break;
-			case WM_MBUTTONDBLCLK:	if (window->onMouseClick)		result = window->onMouseClick(MouseButton::Middle, MouseAction::DoubleClick, static_cast<MouseState>(wParam & 127));	break;
+	#ifdef EZWIN32_ARCH_X86
+		//!	@brief	Supported x86 instruction sets, detected once.
+		struct CpuFeatures
+		{
+			bool	ssse3 = false;
+			bool	sse41 = false;
+			bool	avx2 = false;
 
-			case WM_XBUTTONUP:
-			case WM_XBUTTONDOWN:
-			case WM_XBUTTONDBLCLK:
+			CpuFeatures()
 			{
-				if (window->onMouseClick)
+				int info[4] = {};
+			#if defined(_MSC_VER) && !defined(__clang__)
+				::__cpuid(info, 1);
+			#else
+				__cpuid(1, info[0], info[1], info[2], info[3]);
+			#endif
+				ssse3 = (info[2] & (1 << 9)) != 0;
+				sse41 = (info[2] & (1 << 19)) != 0;
+
+				bool osxsave = (info[2] & (1 << 27)) != 0;
+				bool avx = (info[2] & (1 << 28)) != 0;
+
+				if (osxsave && avx && ((CpuFeatures::xgetbv() & 0x6) == 0x6))	// OS saves XMM/YMM state
 				{
-					auto button = GET_XBUTTON_WPARAM(wParam);
-
-					auto action = (uMsg == WM_XBUTTONUP) ? MouseAction::Up : (uMsg == WM_XBUTTONDOWN) ? MouseAction::Down : MouseAction::DoubleClick;
-
-					if (button == XBUTTON1)
-					{
-						result = window->onMouseClick(MouseButton::XButton1, action, static_cast<MouseState>(wParam & 127));
-					}
-					else if (button == XBUTTON2)
-					{
-						result = window->onMouseClick(MouseButton::XButton2, action, static_cast<MouseState>(wParam & 127));
-					}
+				#if defined(_MSC_VER) && !defined(__clang__)
+					::__cpuidex(info, 7, 0);
+				#else
+					__cpuid_count(7, 0, info[0], info[1], info[2], info[3]);
+				#endif
+					avx2 = (info[1] & (1 << 5)) != 0;
 				}
-
-				break;
 			}
-			case WM_DROPFILES:
+
+			static unsigned long long xgetbv()
 			{
-				HDROP hDrop = (HDROP)wParam;
+			#if defined(_MSC_VER) && !defined(__clang__)
+				return ::_xgetbv(0);
+			#else
+				unsigned int eax = 0, edx = 0;
+				__asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+				return (static_cast<unsigned long long>(edx) << 32) | eax;
+			#endif
+			}
 
-				if (window->onDropFiles)
-				{
-					UINT count = ::DragQueryFile(hDrop, UINT32_MAX, nullptr, 0);
+			static const CpuFeatures & get() { static const CpuFeatures s_features;	return s_features; }
+		};
 
-					std::vector<string_type> filePaths(count);
 
-					for (UINT i = 0; i < count; ++i)
-					{
-						UINT bufferSize = ::DragQueryFile(hDrop, i, nullptr, 0);
+		//!	@brief	SSSE3 kernel: 16 pixels (48 bytes -> 64 bytes) per iteration.
+		EZWIN32_TARGET("ssse3") static void convertPixelsSSSE3(const ColorRGB * src, ColorBGRA * dst, size_t count)
+		{
+			const __m128i shuffle = _mm_setr_epi8(2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10, 9, -1);
+			const __m128i alpha = _mm_set1_epi32(static_cast<int>(0xFF000000));
 
-						filePaths[i].resize(bufferSize + 1, '\0');
+			size_t i = 0;
 
-						::DragQueryFile(hDrop, i, filePaths[i].data(), bufferSize + 1);
-					}
+			for (; i + 16 <= count; i += 16)
+			{
+				const __m128i * in = reinterpret_cast<const __m128i*>(src + i);
+				__m128i * out = reinterpret_cast<__m128i*>(dst + i);
+
+				__m128i v0 = _mm_loadu_si128(in + 0);	// pixels  0 ~  5.33
+				__m128i v1 = _mm_loadu_si128(in + 1);	// pixels  5.33 ~ 10.67
+				__m128i v2 = _mm_loadu_si128(in + 2);	// pixels 10.67 ~ 16
+
+				__m128i p0 = v0;
+				__m128i p1 = _mm_alignr_epi8(v1, v0, 12);
+				__m128i p2 = _mm_alignr_epi8(v2, v1, 8);
+				__m128i p3 = _mm_srli_si128(v2, 4);
+
+				_mm_storeu_si128(out + 0, _mm_or_si128(_mm_shuffle_epi8(p0, shuffle), alpha));
+				_mm_storeu_si128(out + 1, _mm_or_si128(_mm_shuffle_epi8(p1, shuffle), alpha));
+				_mm_storeu_si128(out + 2, _mm_or_si128(_mm_shuffle_epi8(p2, shuffle), alpha));
+				_mm_storeu_si128(out + 3, _mm_or_si128(_mm_shuffle_epi8(p3, shuffle), alpha));
+			}
 
-					result = window->onDropFiles(filePaths);
-				}
+			details::convertPixelsScalar(src + i, dst + i, count - i);
+		}
+
+
+		//!	@brief	AVX2 kernel: 8 pixels per iteration, each 128-bit lane converts 4 pixels.
+		EZWIN32_TARGET("avx2") static void convertPixelsAVX2(const ColorRGB * src, ColorBGRA * dst, size_t count)
+		{
+			const __m256i shuffle = _mm256_setr_epi8(2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10, 9, -1,
+													 2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10, 9, -1);
+			const __m256i alpha = _mm256_set1_epi32(static_cast<int>(0xFF000000));
 
-				::DragFinish(hDrop);
+			size_t i = 0;
 
-				break;
+			// Each 16-byte load reads 4 bytes past the 4 pixels it converts, keep 3 spare pixels at the end.
+			for (; i + 11 <= count; i += 8)
+			{
+				__m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+				__m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 4));
+
+				__m256i v = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_or_si256(_mm256_shuffle_epi8(v, shuffle), alpha));
 			}
-		}
 
-		if (result != -1)
-			return result;
+			details::convertPixelsScalar(src + i, dst + i, count - i);
+		}
+	#endif
 	}
-
-	//	Default handling for unprocessed messages
-	return ::DefWindowProc(hWnd, uMsg, wParam, lParam);
 }
 
 
 /**
- *	@brief		Internal method to create a Win32 window with specified parameters.
- *	@details	Creates a window using `CreateWindowEx` with the provided title, styles, and dimensions.
- *				Registers a window class (either "EasyWin32" or "EasyWin32-NoTitleBar" based on EraseTitleBar)
- *				to handle message dispatching. The window class is registered once per application lifetime and
- *				unregistered upon destruction. Stores the window handle in m_hWnd and associates this Window instance
- *				with the native handle for message processing.
- *	@tparam		SkipCaption - If true, registers a window class without a title bar.
- *	@param[in]	title - The window title text, displayed in the title bar (if applicable).
- *	@param[in]	dwStyle - The native window style flags (e.g., WS_OVERLAPPEDWINDOW, WS_POPUP).
- *	@param[in]	dwExStyle - The native extended window style flags (e.g., WS_EX_LAYERED, WS_EX_TOPMOST).
- *	@param[in]	x - The x-coordinate of the window's top-left corner in screen coordinates (e.g., CW_USEDEFAULT).
- *	@param[in]	y - The y-coordinate of the window's top-left corner in screen coordinates (e.g., CW_USEDEFAULT).
- *	@param[in]	w - The width of the window in pixels, including non-client areas.
- *	@param[in]	h - The height of the window in pixels, including non-client areas.
- *	@note		The window class is registered only once per application, ensuring efficient resource usage.
- *	@note		If the window class registration fails, an assertion is triggered.
+ *	@brief		Converts packed RGB pixels to 32-bit BGRX pixels (alpha is set to 255).
+ *	@details	The instruction set is selected at runtime: AVX2, then SSSE3, then scalar code.
  */
-template<bool SkipCaption> void easywin32::Window::internalOpen(string_type title, DWORD dwStyle, DWORD dwExStyle, int x, int y, int w, int h)
+void easywin32::convertPixels(const ColorRGB * src, ColorBGRA * dst, size_t count)
 {
-	/**
-	 *	@brief	Static window class wrapper for Win32 window registration.
-	 *
-	 *	This struct inherits from `WNDCLASSEX` and is used to register a single
-	 *	window class with the Win32 API. The class is automatically registered
-	 *	upon construction and unregistered upon destruction. This ensures that
-	 *	the registration occurs only once during the application's lifetime.
-	 */
-	static struct NativeClass : public WNDCLASSEX
-	{
-		bool isRegistered;
-
-		NativeClass() : isRegistered(false)
-		{
-			cbSize			= sizeof(WNDCLASSEXW);
-			style			= CS_HREDRAW | CS_VREDRAW | CS_DBLCLKS;
-			lpfnWndProc		= Window::procedure<SkipCaption>;
-			cbClsExtra		= 0;
-			cbWndExtra		= 0;
-			hInstance		= ::GetModuleHandle(NULL);
-			hIcon			= ::LoadIcon(NULL, IDI_APPLICATION);
-			hCursor			= NULL;
-			hbrBackground	= (HBRUSH)::GetStockObject(NULL_BRUSH);
-			lpszMenuName	= NULL;
-			hIconSm			= ::LoadIcon(NULL, IDI_WINLOGO);
-		#ifdef UNICODE
-			lpszClassName	= SkipCaption ? L"EasyWin32-SkipCaption" : L"EasyWin32";
-		#else
-			lpszClassName	= SkipCaption ? "EasyWin32-SkipCaption" : "EasyWin32";
-		#endif
-			isRegistered	= ::RegisterClassEx(this);
-		}
+	static_assert(sizeof(ColorRGB) == 3, "ColorRGB must be tightly packed.");
+	static_assert(sizeof(ColorBGRA) == 4, "ColorBGRA must be tightly packed.");
 
-		~NativeClass()
-		{
-			if (isRegistered)
-			{
-				::UnregisterClass(lpszClassName, hInstance);
-			}
-		}
-	} s_win32Class;
+#ifdef EZWIN32_ARCH_X86
+	const auto & features = details::CpuFeatures::get();
 
-	assert(s_win32Class.isRegistered);
-
-	if (s_win32Class.isRegistered)
+	if (features.avx2)
 	{
-		m_hWnd = ::CreateWindowEx(dwExStyle, s_win32Class.lpszClassName, title.c_str(), dwStyle,
-								  x, y, w, h, NULL, NULL, s_win32Class.hInstance,
-								  this /* Additional application data */);
-
-		//! Keep in sync with the `m_opacity`.
-		if (dwExStyle | WS_EX_LAYERED)
-		{
-			this->setOpacity(m_opacity);
-		}
+		details::convertPixelsAVX2(src, dst, count);
+	}
+	else if (features.ssse3)
+	{
+		details::convertPixelsSSSE3(src, dst, count);
+	}
+	else
+#endif
+	{
+		details::convertPixelsScalar(src, dst, count);
 	}
 }
 
 
 /**
- *	@brief		Opens a new window with the specified title, bounds and styles.
- *	@details	Creates a Win32 window using `CreateWindowEx`, applying the provided style flags and extended style flags.
- *				Adjusts the window's bounding rectangle to account for non-client areas (e.g., borders, title bar) based on the style flags.
- *				If the window is already open (m_hWnd is valid), this method does nothing. Stores the window handle and updates m_styleFlags and m_bounds.
- *	@param[in]	title - The title of the window.
- *	@param[in]	bounds - The rectangular area defining the window's position (left, top) and bounds (right, bottom) in screen coordinates.
- *	@param[in]	styleFlags - The combination of window styles (e.g., `Style::OverlappedWindow`). Defaults to `Style::OverlappedWindow`.
- *	@param[in]	exStyleFlags - The combination of extended window styles (e.g., ExStyle::Layered, ExStyle::TopMost). Defaults to 0 (no extended styles).
+ *	@brief		Converts straight-alpha RGBA pixels to premultiplied BGRA pixels.
+ *	@details	`c * a / 255` is computed exactly (rounded to nearest) without division.
  */
-void easywin32::Window::open(string_type title, Rect bounds, Flags<Style> styleFlags, Flags<ExStyle> exStyleFlags)
+void easywin32::premultiplyPixels(const ColorRGBA * src, ColorBGRA * dst, size_t count)
 {
-	if (::IsWindow(m_hWnd) != 0)	return;
+	static_assert(sizeof(ColorRGBA) == 4, "ColorRGBA must be tightly packed.");
 
-	DWORD dwStyle = Window::toNativeStyle(styleFlags);
+	auto mul = [](unsigned int c, unsigned int a) { unsigned int t = c * a + 128;	return static_cast<uint8_t>((t + (t >> 8)) >> 8); };
 
-	if (Window::shouldSkipCaption(styleFlags))
+	for (size_t i = 0; i < count; i++)
 	{
-		m_skipCaption = true;
+		const unsigned int a = src[i].a;
 
-		Window::adjustWindowRect<true>(bounds, dwStyle, exStyleFlags);
-
-		this->internalOpen<true>(title, dwStyle, exStyleFlags, bounds.left, bounds.top,
-								 bounds.right - bounds.left, bounds.bottom - bounds.top);
+		dst[i] = ColorBGRA{ mul(src[i].b, a), mul(src[i].g, a), mul(src[i].r, a), static_cast<uint8_t>(a) };
 	}
-	else
+}
+
+
+
+/*********************************************************************************
+*******************************    FrameCapture    *******************************
+*********************************************************************************/
+
+bool easywin32::FrameCapture::start(FrameEncoder * encoder)
+{
+	if ((m_encoder != nullptr) || (encoder == nullptr))
 	{
-		m_skipCaption = false;
+		return false;
+	}
 
-		Window::adjustWindowRect<false>(bounds, dwStyle, exStyleFlags);
+	m_hWake = ::CreateEvent(nullptr, FALSE, FALSE, nullptr);
 
-		this->internalOpen<false>(title, dwStyle, exStyleFlags, bounds.left, bounds.top,
-								  bounds.right - bounds.left, bounds.bottom - bounds.top);
+	if (m_hWake == nullptr)
+	{
+		return false;
 	}
+
+	m_head.store(0, std::memory_order_relaxed);
+	m_tail.store(0, std::memory_order_relaxed);
+	m_numDropped.store(0, std::memory_order_relaxed);
+	m_stopping.store(false, std::memory_order_relaxed);
+
+	m_encoder = encoder;
+
+	m_thread = std::thread(&FrameCapture::threadMain, this);
+
+	return true;
 }
 
 
-/**
- *	@brief		Opens a new window with the specified title, size and styles.
- *	@details	Creates a Win32 window using `CreateWindowEx`, applying the provided style flags and extended style flags.
- *				The window is positioned at default screen coordinates (CW_USEDEFAULT) and sized according to the provided Size structure.
- *				Adjusts the window's bounding rectangle to account for non-client areas (e.g., borders, title bar) based on the style flags.
- *				If the window is already open (m_hWnd is valid), this method does nothing. Updates m_styleFlags and m_bounds accordingly.
- *	@param[in]	title - The title of the window.
- *	@param[in]	with - The with of the window in pixels.
- *	@param[in]	height - The height of the window in pixels.
- *	@param[in]	styleFlags - The combination of window styles (e.g., `Style::OverlappedWindow`). Defaults to `Style::OverlappedWindow`.
- *	@param[in]	exStyleFlags - The combination of extended window styles (e.g., `ExStyle::Layered`, `ExStyle::TopMost`). Defaults to 0 (no extended styles).
- *	@note		The window is created at default screen coordinates (CW_USEDEFAULT). Use setPos to specify a custom position.
- */
-void easywin32::Window::open(string_type title, int width, int height, Flags<Style> styleFlags, Flags<ExStyle> exStyleFlags)
+void easywin32::FrameCapture::stop()
 {
-	if (::IsWindow(m_hWnd) != 0)	return;
-
-	RECT bounds = { 0, 0, width, height };
+	if (m_encoder == nullptr)	return;
 
-	DWORD dwStyle = Window::toNativeStyle(styleFlags);
+	m_stopping.store(true, std::memory_order_release);
 
-	if (Window::shouldSkipCaption(styleFlags))
-	{
-		m_skipCaption = true;
+	::SetEvent(m_hWake);
 
-		Window::adjustWindowRect<true>(bounds, dwStyle, exStyleFlags);
+	m_thread.join();
 
-		this->internalOpen<true>(title, dwStyle, exStyleFlags, CW_USEDEFAULT, CW_USEDEFAULT,
-								 bounds.right - bounds.left, bounds.bottom - bounds.top);
-	}
-	else
-	{
-		m_skipCaption = false;
+	::CloseHandle(m_hWake);
 
-		Window::adjustWindowRect<false>(bounds, dwStyle, exStyleFlags);
+	m_hWake = nullptr;
 
-		this->internalOpen<false>(title, dwStyle, exStyleFlags, CW_USEDEFAULT, CW_USEDEFAULT,
-								  bounds.right - bounds.left, bounds.bottom - bounds.top);
-	}
+	m_encoder = nullptr;
 }
 
 
-//! @brief	Adjust the given client rectangle based on window styles and extended styles.
-template<bool SkipCaption> void easywin32::Window::adjustWindowRect(Rect & rect, DWORD dwStyle, DWORD dwExStyle)
+bool easywin32::FrameCapture::capture(const ColorBGRA * pixels, int width, int height, size_t pitch)
 {
-	auto top = rect.top;
+	if ((m_encoder == nullptr) || (pixels == nullptr) || (width <= 0) || (height <= 0))
+	{
+		return false;
+	}
 
-	::AdjustWindowRectEx(&rect, dwStyle, FALSE, dwExStyle);
+	const uint64_t head = m_head.load(std::memory_order_relaxed);
 
-	if constexpr (SkipCaption)
+	if (head - m_tail.load(std::memory_order_acquire) == m_frames.size())
 	{
-		rect.top = top;		// Preserve top edge to skip caption adjustment
+		m_numDropped.fetch_add(1, std::memory_order_relaxed);
+
+		return false;
 	}
-}
 
+	FrameQueue::Frame & frame = m_frames[static_cast<size_t>(head % m_frames.size())];
 
-//! @brief	Convert easywin32 style flags to native Win32 window style bits.
-DWORD easywin32::Window::toNativeStyle(Flags<Style> styleFlags)
-{
-	DWORD dwStyle = WS_POPUP;	// Base style (Win32 auto-adds WS_CAPTION if not using WS_POPUP)
-	
-	if (styleFlags.has(Style::Border))
-		dwStyle |= WS_BORDER;
+	frame.resize(width, height);
 
-	if (styleFlags.has(Style::Visible))
-		dwStyle |= WS_VISIBLE;
+	const size_t rowBytes = frame.getPitch();
 
-	if (styleFlags.has(Style::SysMenu))
-		dwStyle |= WS_SYSMENU;
+	pitch = (pitch == 0) ? rowBytes : pitch;
+
+	if (pitch == rowBytes)
+	{
+		std::memcpy(frame.pixels.data(), pixels, rowBytes * static_cast<size_t>(height));
+	}
+	else
+	{
+		for (int y = 0; y < height; y++)
+		{
+			std::memcpy(frame.pixels.data() + static_cast<size_t>(y) * width, reinterpret_cast<const uint8_t*>(pixels) + y * pitch, rowBytes);
+		}
+	}
 
-	if (styleFlags.has(Style::Disabled))
-		dwStyle |= WS_DISABLED;
+	LARGE_INTEGER counter = {};		::QueryPerformanceCounter(&counter);
 
-	if (styleFlags.has(Style::Resizable))
-		dwStyle |= WS_THICKFRAME;
+	frame.index = head + 1;
 
-	if (styleFlags.has(Style::MinimizeBox))
-		dwStyle |= WS_MINIMIZEBOX;
+	frame.time = counter.QuadPart;
 
-	if (styleFlags.has(Style::MaximizeBox))
-		dwStyle |= WS_MAXIMIZEBOX;
+	m_head.store(head + 1, std::memory_order_release);
 
-	// Add caption if explicitly requested or when thick frame is used (required by Win32 for proper window behavior)
-	if (styleFlags.has(Style::Caption) || styleFlags.has(Style::ThickFrame))
-		dwStyle |= WS_CAPTION;
+	::SetEvent(m_hWake);
 
-	return dwStyle;
+	return true;
 }
 
 
-//!	@brief	Gets styles of the window.
-easywin32::Flags<easywin32::Style> easywin32::Window::getStyleFlags() const
+void easywin32::FrameCapture::threadMain()
 {
-	DWORD dwStyle = (DWORD)::GetWindowLongPtr(m_hWnd, GWL_STYLE);
+	uint64_t tail = m_tail.load(std::memory_order_relaxed);
 
-	Flags<Style> style = 0;
-	
-	if ((dwStyle & WS_BORDER) == WS_BORDER)
-		style |= Style::Border;
+	for (;;)
+	{
+		::WaitForSingleObject(m_hWake, INFINITE);
 
-	if ((dwStyle & WS_VISIBLE) == WS_VISIBLE)
-		style |= Style::Visible;
+		// Read before the queue, so that every frame queued before `stop` is encoded
+		const bool stopping = m_stopping.load(std::memory_order_acquire);
 
-	if ((dwStyle & WS_SYSMENU) == WS_SYSMENU)
-		style |= Style::SysMenu;
+		const uint64_t head = m_head.load(std::memory_order_acquire);
 
-	if ((dwStyle & WS_DISABLED) == WS_DISABLED)
-		style |= Style::Disabled;
+		while (tail != head)
+		{
+			m_encoder->encode(m_frames[static_cast<size_t>(tail % m_frames.size())]);
 
-	if ((dwStyle & WS_THICKFRAME) == WS_THICKFRAME)
-		style |= Style::Resizable;
+			m_tail.store(++tail, std::memory_order_release);
+		}
 
-	if ((dwStyle & WS_MINIMIZEBOX) == WS_MINIMIZEBOX)
-		style |= Style::MinimizeBox;
+		if (stopping)	break;
+	}
 
-	if ((dwStyle & WS_MAXIMIZEBOX) == WS_MAXIMIZEBOX)
-		style |= Style::MaximizeBox;
+	m_encoder->finish();
+}
 
-	if ((dwStyle & WS_CAPTION) == WS_CAPTION)
+
+/*********************************************************************************
+******************************    RawFrameWriter    ******************************
+*********************************************************************************/
+
+namespace easywin32
+{
+	namespace details
 	{
-		style |= Style::ThickFrame;
+		struct FrameFileHeader
+		{
+			char			magic[4];		// "EZFR"
+			uint32_t		pixelSize;		// sizeof(ColorBGRA)
+			int64_t			frequency;		// QPC frequency of the timestamps
+		};
 
-		if (!m_skipCaption)
-			style |= Style::Caption;
+		struct FrameRecordHeader
+		{
+			int32_t			width;
+			int32_t			height;
+			int64_t			time;			// QPC timestamp
+			uint64_t		index;			// Sequence number of the frame in the capture, gaps are dropped frames
+		};
 	}
-
-	return style;
 }
 
 
-//!	@brief	Rest style of the window.
-void easywin32::Window::setStyle(Flags<Style> styleFlags)
+void easywin32::RawFrameWriter::encode(const FrameQueue::Frame & frame)
 {
-	auto pos = this->getClientPos();
+	if (m_failed)	return;
 
-	auto extent = this->getClientExtent();
+	if (m_hFile == INVALID_HANDLE_VALUE)
+	{
+		m_hFile = ::CreateFile(m_path.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
 
-	DWORD dwStyle = Window::toNativeStyle(styleFlags);
+		if (m_hFile == INVALID_HANDLE_VALUE)
+		{
+			m_failed = true;
 
-	Rect rect = { pos.x, pos.y, pos.x + extent.cx, pos.y + extent.cy };
+			return;
+		}
 
-	::SetWindowLongPtr(m_hWnd, GWL_STYLE, static_cast<LONG_PTR>(dwStyle));
+		LARGE_INTEGER frequency = {};		::QueryPerformanceFrequency(&frequency);
 
-	if (Window::shouldSkipCaption(styleFlags))
-	{
-		m_skipCaption = true;
+		details::FrameFileHeader header = { { 'E', 'Z', 'F', 'R' }, sizeof(ColorBGRA), frequency.QuadPart };
 
-		Window::adjustWindowRect<true>(rect, dwStyle, (DWORD)GetWindowLongPtr(m_hWnd, GWL_EXSTYLE));
+		DWORD bytes = 0;
 
-		::SetWindowLongPtr(m_hWnd, GWLP_WNDPROC, (LONG_PTR)Window::procedure<true>);
+		m_failed = !::WriteFile(m_hFile, &header, sizeof(header), &bytes, nullptr) || (bytes != sizeof(header));
 	}
-	else
-	{
-		m_skipCaption = false;
 
-		Window::adjustWindowRect<false>(rect, dwStyle, (DWORD)GetWindowLongPtr(m_hWnd, GWL_EXSTYLE));
+	details::FrameRecordHeader record = { frame.width, frame.height, frame.time, frame.index };
 
-		::SetWindowLongPtr(m_hWnd, GWLP_WNDPROC, (LONG_PTR)Window::procedure<false>);
-	}
+	DWORD recordBytes = 0, pixelBytes = 0;
 
-	::SetWindowPos(m_hWnd, NULL, rect.left, rect.top, rect.right - rect.left, rect.bottom - rect.top, SWP_FRAMECHANGED | SWP_NOZORDER);
+	const DWORD size = static_cast<DWORD>(frame.getPitch() * static_cast<size_t>(frame.height));
+
+	m_failed = m_failed || !::WriteFile(m_hFile, &record, sizeof(record), &recordBytes, nullptr) || (recordBytes != sizeof(record)) ||
+			   !::WriteFile(m_hFile, frame.pixels.data(), size, &pixelBytes, nullptr) || (pixelBytes != size);
 }
 
 
-//!	@brief	Rest ex-style of the window.
-void easywin32::Window::setExStyle(Flags<ExStyle> styleFlags)
+void easywin32::RawFrameWriter::finish()
 {
-	::SetWindowLongPtr(m_hWnd, GWL_EXSTYLE, static_cast<LONG_PTR>(styleFlags.mask));
-
-	::SetWindowPos(m_hWnd, NULL, 0, 0, 0, 0, SWP_FRAMECHANGED | SWP_NOZORDER | SWP_NOMOVE | SWP_NOSIZE);
-
-	//! Keep in sync with the `m_opacity`.
-	if (styleFlags.has(ExStyle::Layered))
+	if (m_hFile != INVALID_HANDLE_VALUE)
 	{
-		this->setOpacity(m_opacity);
+		::CloseHandle(m_hFile);
+
+		m_hFile = INVALID_HANDLE_VALUE;
 	}
 }
 
 
-//!	@brief	Set position of the window.
-void easywin32::Window::setPos(int left, int top)
+/*********************************************************************************
+*****************************    WindowThreadPool    *****************************
+*********************************************************************************/
+
+easywin32::WindowThreadPool::WindowThreadPool(size_t numThreads)
 {
-	auto pos = this->getClientPos();
+	if (numThreads == 0)
+	{
+		numThreads = std::thread::hardware_concurrency();
+
+		numThreads = numThreads > 0 ? numThreads : 1;
+	}
 
-	if ((pos.x != left) || (pos.y != top))
+	for (size_t i = 0; i < numThreads; i++)
 	{
-		Rect rect = { left, top, 0, 0 };	// Ignores the right and bottom parameters
+		auto worker = std::make_unique<Worker>();
 
-		if (m_skipCaption)
-			Window::adjustWindowRect<true>(rect, (DWORD)GetWindowLongPtr(m_hWnd, GWL_STYLE), (DWORD)GetWindowLongPtr(m_hWnd, GWL_EXSTYLE));
-		else
-			Window::adjustWindowRect<false>(rect, (DWORD)GetWindowLongPtr(m_hWnd, GWL_STYLE), (DWORD)GetWindowLongPtr(m_hWnd, GWL_EXSTYLE));
+		worker->hReady = ::CreateEvent(nullptr, TRUE, FALSE, nullptr);
+
+		worker->thread = std::thread(&WindowThreadPool::threadMain, this, worker.get());
+
+		m_workers.push_back(std::move(worker));
+	}
 
-		::SetWindowPos(m_hWnd, NULL, rect.left, rect.top, 0, 0, SWP_FRAMECHANGED | SWP_NOZORDER | SWP_NOSIZE | SWP_NOREDRAW);
+	for (auto & worker : m_workers)
+	{
+		::WaitForSingleObject(worker->hReady, INFINITE);
 	}
 }
 
 
-//!	@brief	Set position of the window.
-void easywin32::Window::setPos(int left, int top, int right, int bottom)
+easywin32::WindowThreadPool::~WindowThreadPool()
 {
-	auto extent = this->getClientExtent();
+	m_stopping = true;
 
-	if ((right - left == extent.cx) && (bottom - top == extent.cy))
+	for (auto & worker : m_workers)
 	{
-		this->setPos(left, top);
+		worker->host.post([]() { ::PostQuitMessage(0); });
 	}
-	else
-	{
-		Rect rect = { left, top, right, bottom };
 
-		if (m_skipCaption)
-			Window::adjustWindowRect<true>(rect, (DWORD)GetWindowLongPtr(m_hWnd, GWL_STYLE), (DWORD)GetWindowLongPtr(m_hWnd, GWL_EXSTYLE));
-		else
-			Window::adjustWindowRect<false>(rect, (DWORD)GetWindowLongPtr(m_hWnd, GWL_STYLE), (DWORD)GetWindowLongPtr(m_hWnd, GWL_EXSTYLE));
+	for (auto & worker : m_workers)
+	{
+		worker->thread.join();
 
-		::SetWindowPos(m_hWnd, NULL, rect.left, rect.top, rect.right - rect.left, rect.bottom - rect.top, SWP_FRAMECHANGED | SWP_NOZORDER);
+		::CloseHandle(worker->hReady);
 	}
 }
 
 
-//!	@brief	Centers the window in the current monitor's work area.
-void easywin32::Window::centerToScreen()
+/**
+ *	@brief		Runs `task` on the thread at `threadIndex` and waits until it returns.
+ *	@details	The task and its completion event are shared with the queued call, which may outlive a timed out wait.
+ *	@return		`false` if the task could not be queued (the pool is being destroyed), or did not return within `timeout`.
+ */
+bool easywin32::WindowThreadPool::invoke(size_t threadIndex, Callback<void()> task, DWORD timeout)
 {
-	HMONITOR hMon = ::MonitorFromWindow(m_hWnd, MONITOR_DEFAULTTONEAREST);
-	MONITORINFO mi = { sizeof(mi) };
-	::GetMonitorInfo(hMon, &mi);
-
-	auto extent = this->getClientExtent();
-	int workW = mi.rcWork.right - mi.rcWork.left;
-	int workH = mi.rcWork.bottom - mi.rcWork.top;
-	int winW = extent.cx;
-	int winH = extent.cy;
+	Worker * worker = m_workers[threadIndex].get();
 
-	int x = mi.rcWork.left + (workW - winW) / 2;
-	int y = mi.rcWork.top + (workH - winH) / 2;
+	if (worker->threadId == ::GetCurrentThreadId())
+	{
+		task();
 
-	this->setPos(x, y);
-}
+		return true;
+	}
 
+	struct Invocation
+	{
+		Callback<void()>	task;
+		HANDLE				hDone = ::CreateEvent(nullptr, TRUE, FALSE, nullptr);
 
-//!	@brief	Enables or disables the DWM "blur-behind" effect for the window (aka. alpha-composition).
-void easywin32::Window::enableBlurBeindWindow(bool enable)
-{
-	BOOL composition = FALSE;
+		~Invocation() { ::CloseHandle(hDone); }
+	};
 
-	if (SUCCEEDED(::DwmIsCompositionEnabled(&composition)) && composition)
-	{
-		HRGN region = ::CreateRectRgn(0, 0, -1, -1);
+	auto invocation = std::make_shared<Invocation>();
 
-		DWM_BLURBEHIND		bb = {};
-		bb.dwFlags			= DWM_BB_ENABLE | DWM_BB_BLURREGION;
-		bb.hRgnBlur			= enable ? region : NULL;
-		bb.fEnable			= enable ? TRUE : FALSE;
+	invocation->task = std::move(task);
 
-		::DwmEnableBlurBehindWindow(m_hWnd, &bb);
-		::DeleteObject(region);
+	bool posted = worker->host.post([invocation]() { invocation->task();	::SetEvent(invocation->hDone); });
 
-		m_enableBlurBeind = enable;
-	}
+	return posted && (::WaitForSingleObject(invocation->hDone, timeout) == WAIT_OBJECT_0);
 }
 
 
 /**
- *	@brief		Draws a raw RGB bitmap onto the window at the specified position.
- *	@details	This function copies pixel data directly to the window's client area
- *				using GDI without relying on any GPU or graphics API.
- *	@param[in]	pixels - Pointer to the RGB pixel data in row-major order.
- *	@param[in]	width - Width of the bitmap in pixels.
- *	@param[in]	height - Height of the bitmap in pixels.
- *	@param[in]	dstX - Destination X coordinate in the client area.
- *	@param[in]	dstY - Destination Y coordinate in the client area.
- *	@note		The pixel format must match the expected 24-bit RGB format defined by `Color`.
- *				The function performs an immediate blit to the window using `SetDIBitsToDevice`.
- *	@warning	This function must be called only inside `onPaint`, because it uses BeginPaint/EndPaint.
- *				Calling it outside `onPaint` causes undefined behavior in Win32.
+ *	@brief		Message loop of a pool thread.
+ *	@details	Runs until the pool is destroyed, then closes the windows left on the thread through their
+ *				`Window` objects, which see `WM_DESTROY` while still alive.
  */
-void easywin32::Window::drawBitmap(const ColorRGB * pixels, int width, int height, int dstX, int dstY)
+void easywin32::WindowThreadPool::threadMain(Worker * worker)
 {
-	PAINTSTRUCT ps = {};
-	BITMAPINFO bmi = {};
-	bmi.bmiHeader.biSize			= sizeof(BITMAPINFOHEADER);
-	bmi.bmiHeader.biWidth			= width;
-	bmi.bmiHeader.biHeight			= -height;				// Negative = top-down bitmap
-	bmi.bmiHeader.biPlanes			= 1;
-	bmi.bmiHeader.biBitCount		= sizeof(ColorRGB) * 8;	// 24-bit (RGB)
-	bmi.bmiHeader.biCompression		= BI_RGB;				// No compression
+	worker->threadId = ::GetCurrentThreadId();
 
-	// Begin painting
-	HDC hdc = BeginPaint(m_hWnd, &ps);
-
-	// Draw image directly to window
-	SetDIBitsToDevice(
-		hdc,
-		dstX, dstY,			// Destination X, Y
-		width, height,		// Width, Height
-		0, 0,				// Source X, Y
-		0, height,			// Start scan line, number of scan lines
-		pixels,				// Pointer to pixel data
-		&bmi,
-		DIB_RGB_COLORS		// RGB mode
-	);
+	worker->host.setQuitOnClose(false);
 
-	// End painting
-	EndPaint(m_hWnd, &ps);
-}
+	worker->host.open(TEXT("EasyWin32.WindowThreadPool"), 0, 0, 0);
 
+	::SetEvent(worker->hReady);
 
-/**
- *	@brief		Waits for and processes the next window message.
- *	@details	This call will block until a new message is available in the queue for this window.
- *				It retrieves the message with `GetMessage`, translates it (e.g. converts virtual-key
- *				messages into character messages), and dispatches it to the window procedure.
- */
-void easywin32::Window::waitEvent()
-{
-	if (m_hWnd != nullptr)
+	MSG msg = {};
+
+	while (true)
 	{
-		MSG message = {};
+		BOOL status = ::GetMessage(&msg, nullptr, 0, 0);
 
-		if (::GetMessage(&message, m_hWnd, 0, 0))
+		if (status == -1)
 		{
-			::TranslateMessage(&message);
+			break;
+		}
+		else if (status == 0)		// WM_QUIT
+		{
+			if (m_stopping)		break;
+		}
+		else
+		{
+			::TranslateMessage(&msg);
 
-			::DispatchMessage(&message);
-		};
+			::DispatchMessage(&msg);
+		}
 	}
-}
 
+	worker->host.close();
 
-/**
- *	@brief		Processes all pending window messages, if available.
- *	@details	Uses `PeekMessage` to check for all messages in the queue for this window.
- *				If a message exists, it is translated and dispatched to the window procedure.
- *	@return		`true` if a message was processed, `false` if no messages were pending.
- */
-bool easywin32::Window::processEvents()
-{
-	bool hasEvent = false;
+	std::vector<HWND> windows;
 
-	if (m_hWnd != nullptr)
+	::EnumThreadWindows(::GetCurrentThreadId(), [](HWND hWnd, LPARAM lParam) -> BOOL
 	{
-		MSG message = {};
+		reinterpret_cast<std::vector<HWND>*>(lParam)->push_back(hWnd);
 
-		while (::PeekMessage(&message, m_hWnd, 0, 0, PM_REMOVE))
-		{
-			::TranslateMessage(&message);
+		return TRUE;
+	}, reinterpret_cast<LPARAM>(&windows));
 
-			::DispatchMessage(&message);
+	for (HWND hWnd : windows)
+	{
+		Window * window = Window::fromHandle(hWnd);
 
-			hasEvent = true;
-		};
+		if (window != nullptr)
+			window->close();			// Releases what the `Window` holds besides the handle
+		else if (::IsWindow(hWnd))		// Not ours (or already destroyed with its owner)
+			::DestroyWindow(hWnd);
 	}
-
-	return hasEvent;
 }
 
 
-/**
- *	@brief		Waits for and processes the next message for all windows belonging to the current thread.
- *	@details	This function blocks until a message is available in the message queue of the
- *				current thread (regardless of which window it belongs to).
- *	@note		Unlike per-window message processing, passing `nullptr` as `hWnd` allows
- *				messages for any window in this thread to be retrieved.
- */
-void easywin32::ThreadWindows::waitEvent()
+
+/*********************************************************************************
+********************************    WindowPool    ********************************
+*********************************************************************************/
+
+void easywin32::WindowPool::reserve(size_t count)
 {
-	MSG message = {};
+	m_windows.reserve(count);
 
-	if (::GetMessage(&message, nullptr, 0, 0))
+	while (m_windows.size() < count)
 	{
-		::TranslateMessage(&message);
+		m_idle.push_back(this->grow());
+	}
+}
 
-		::DispatchMessage(&message);
-	};
+
+easywin32::Window * easywin32::WindowPool::grow()
+{
+	m_windows.push_back(std::make_unique<Window>());
+
+	Window * window = m_windows.back().get();
+
+	window->setQuitOnClose(false);
+
+	window->open(m_desc);
+
+	return window;
 }
 
 
-/**
- * @brief      Processes all pending messages, if available.
- * @details    Uses `PeekMessage` to check for all messages in the queue for this thread.
- *             If a message exists, it is translated and dispatched to the window procedure.
- * @return     `true` if an event was processed, `false` if no messages were pending.
- */
-bool easywin32::ThreadWindows::processEvents()
+easywin32::Window & easywin32::WindowPool::acquire(int left, int top)
 {
-	MSG message = {};
+	Window * window = nullptr;
 
-	bool hasEvent = false;
+	if (m_idle.empty())
+	{
+		window = this->grow();
+	}
+	else
+	{
+		window = m_idle.back();
 
-	while (::PeekMessage(&message, nullptr, 0, 0, PM_REMOVE))
+		m_idle.pop_back();
+
+		window->open(m_desc);		// No-op unless the window was closed while acquired
+	}
+
+	window->setPos(left, top);
+
+	window->show();
+
+	return *window;
+}
+
+
+void easywin32::WindowPool::recycle(Window & window)
+{
+	for (auto & pooled : m_windows)
 	{
-		::TranslateMessage(&message);
+		if (pooled.get() == &window)
+		{
+			window.hide();
 
-		::DispatchMessage(&message);
+			if (std::find(m_idle.begin(), m_idle.end(), &window) == m_idle.end())
+			{
+				m_idle.push_back(&window);
+			}
 
-		hasEvent = true;
-	};
+			return;
+		}
+	}
 
-	return hasEvent;
+	assert(!"The window does not belong to this pool");
 }
 
 #endif
\ No newline at end of file
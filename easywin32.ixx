@@ -0,0 +1,188 @@
+﻿/**
+ *	Copyright (c) 2025 Wenchao Huang <physhuangwenchao@gmail.com>
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ * 
+ *	Repo URL: https://github.com/WenchaoHuang/easywin32.git
+ */
+
+/**
+ *	C++20 module interface of EasyWin32: `import easywin32;` instead of `#include "easywin32.h"`.
+ *
+ *	The headers are parsed once, when this interface is compiled, instead of by every translation unit.
+ *	The definitions still come from the `easywin32` library (`easywin32.cpp`), see `EZWIN32_BUILD_MODULE`.
+ *	Modules do not export macros: translation units calling Win32 directly still include <Windows.h>,
+ *	and the `EZWIN32_*` macros (e.g. `EZWIN32_ENABLE_PROFILER`) must match the library.
+ *	`easywin32_d3d11.h` is not part of the module, since it pulls in the Direct3D headers.
+ */
+module;
+
+#include "easywin32.h"
+#include "easywin32_pixelops.h"
+
+export module easywin32;
+
+/*********************************************************************************
+********************************    EasyWin32    *********************************
+*********************************************************************************/
+
+export namespace easywin32
+{
+	using easywin32::Window;
+	using easywin32::Framebuffer;
+	using easywin32::SharedFramebufferWriter;
+	using easywin32::FrameQueue;
+	using easywin32::Presenter;
+	using easywin32::EventRecorder;
+	using easywin32::InputQueue;
+	using easywin32::WindowThreadPool;
+	using easywin32::WindowPool;
+	using easywin32::DispatchProfiler;
+	using easywin32::FrameCapture;
+	using easywin32::FrameEncoder;
+	using easywin32::RawFrameWriter;
+
+	using easywin32::Event;
+	using easywin32::FrameStats;
+	using easywin32::WaitResult;
+	using easywin32::InputState;
+	using easywin32::WindowDesc;
+	using easywin32::SharedFramebufferHeader;
+	using easywin32::DispatchStats;
+	using easywin32::ColorRGB;
+	using easywin32::ColorRGBA;
+	using easywin32::ColorBGRA;
+
+	using easywin32::Flags;
+	using easywin32::Callback;
+
+	using easywin32::Byte;
+	using easywin32::Size;
+	using easywin32::Rect;
+	using easywin32::Point;
+	using easywin32::Result;
+	using easywin32::string_type;
+	using easywin32::string_view_type;
+
+	using easywin32::Key;
+	using easywin32::Style;
+	using easywin32::ExStyle;
+	using easywin32::Cursor;
+	using easywin32::Backdrop;
+	using easywin32::KeyAction;
+	using easywin32::MouseState;
+	using easywin32::WaitSource;
+	using easywin32::Visibility;
+	using easywin32::MouseAction;
+	using easywin32::MouseButton;
+	using easywin32::CornerStyle;
+	using easywin32::HitTestResult;
+	using easywin32::RawMouseButton;
+	using easywin32::NonClientRenderingPolicy;
+
+	using easywin32::operator|;
+	using easywin32::operator&;
+	using easywin32::operator~;
+	using easywin32::to_string;
+	using easywin32::convertPixels;
+	using easywin32::premultiplyPixels;
+}
+
+
+export namespace easywin32::ThreadWindows
+{
+	using easywin32::ThreadWindows::waitEvent;
+	using easywin32::ThreadWindows::processEvents;
+	using easywin32::ThreadWindows::waitEvents;
+	using easywin32::ThreadWindows::beginLayout;
+	using easywin32::ThreadWindows::commitLayout;
+	using easywin32::ThreadWindows::enablePerMonitorDpiAwareness;
+}
+
+
+export namespace easywin32::PixelOps
+{
+	using easywin32::PixelOps::Isa;
+	using easywin32::PixelOps::Filter;
+	using easywin32::PixelOps::to_string;
+	using easywin32::PixelOps::isSupported;
+	using easywin32::PixelOps::getIsa;
+	using easywin32::PixelOps::setIsa;
+	using easywin32::PixelOps::fill;
+	using easywin32::PixelOps::blit;
+	using easywin32::PixelOps::convert;
+	using easywin32::PixelOps::blend;
+	using easywin32::PixelOps::scale;
+}
+
+/*********************************************************************************
+********************************    Type alias    ********************************
+*********************************************************************************/
+
+export
+{
+	using ::EzKey;
+	using ::EzByte;
+	using ::EzSize;
+	using ::EzRect;
+	using ::EzPoint;
+	using ::EzStyle;
+	using ::EzResult;
+	using ::EzWindow;
+	using ::EzWindowDesc;
+	using ::EzWindowPool;
+	using ::EzCursor;
+	using ::EzExStyle;
+	using ::EzBackdrop;
+	using ::EzColorRGB;
+	using ::EzColorRGBA;
+	using ::EzColorBGRA;
+	using ::EzPresenter;
+	using ::EzFrameStats;
+	using ::EzFramebuffer;
+	using ::EzSharedFramebufferWriter;
+	using ::EzSharedFramebufferHeader;
+	using ::EzFrameQueue;
+	using ::EzFrameCapture;
+	using ::EzFrameEncoder;
+	using ::EzRawFrameWriter;
+	using ::EzEvent;
+	using ::EzEventRecorder;
+	using ::EzInputQueue;
+	using ::EzInputState;
+	using ::EzWindowThreadPool;
+	using ::EzDispatchStats;
+	using ::EzDispatchProfiler;
+	using ::EzWaitSource;
+	using ::EzVisibility;
+	using ::EzWaitResult;
+	using ::EzKeyAction;
+	using ::EzMouseState;
+	using ::EzMouseAction;
+	using ::EzMouseButton;
+	using ::EzCornerStyle;
+	using ::EzHitTestResult;
+	using ::EzMouseStateFlags;
+	using ::EzRawMouseButton;
+	using ::EzNonClientRenderingPolicy;
+	using ::EzFlags;
+}
+
+export namespace EzThreadWindows = easywin32::ThreadWindows;
+export namespace EzPixelOps = easywin32::PixelOps;
\ No newline at end of file
@@ -0,0 +1,796 @@
+﻿/**
+ *	Copyright (c) 2025 Wenchao Huang <physhuangwenchao@gmail.com>
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ *
+ *	Repo URL: https://github.com/WenchaoHuang/easywin32.git
+ */
+#pragma once
+
+#include "easywin32.h"
+
+// C headers
+#include <d3d11.h>
+#include <dxgi1_5.h>
+#include <d3dcompiler.h>
+
+// C++ headers
+#include <cstring>
+#include <wrl/client.h>
+
+// Link D3D11 / DXGI
+#pragma comment(lib, "d3d11.lib")
+#pragma comment(lib, "dxgi.lib")
+#pragma comment(lib, "d3dcompiler.lib")
+
+/*********************************************************************************
+********************************    SwapChain    *********************************
+*********************************************************************************/
+
+namespace easywin32
+{
+	class SwapChain;
+
+	//!	@brief	How CPU frames are placed into the back buffer by `SwapChain::endFrame` and `SwapChain::present`.
+	enum class ScaleMode
+	{
+		None,			//!< 1:1 copy to the top-left corner, cropped to the back buffer (no draw call), the rest is cleared.
+		Stretch,		//!< Stretched over the whole back buffer, ignoring the aspect ratio.
+		Letterbox,		//!< Largest extent keeping the aspect ratio, centered, the bars are cleared.
+		IntegerFit,		//!< Largest integer multiple of the frame (pixel-perfect), centered, the bars are cleared. Letterboxed if the frame is larger than the back buffer.
+	};
+
+	//!	@brief	Sampling of the frame by scaled presentation.
+	enum class ScaleFilter
+	{
+		Nearest,		//!< Point sampling, keeps hard pixel edges.
+		Linear,			//!< Bilinear sampling.
+	};
+}
+
+using EzSwapChain = easywin32::SwapChain;
+using EzScaleMode = easywin32::ScaleMode;
+using EzScaleFilter = easywin32::ScaleFilter;
+
+/**
+ *	@brief		Direct3D 11 presenter using a DXGI flip-discard swap chain.
+ *	@details	Alternative to the GDI path (`drawBitmap` / `Framebuffer`) supporting vsync, tear-free
+ *				and tearing (lowest latency) presentation. CPU pixels are uploaded through a dynamic texture
+ *				that is mapped directly for the caller (`beginFrame` / `endFrame`), while GPU renderers can
+ *				use the device, the back buffer and its render target view directly.
+ *	@note		Once created, the swap chain is attached as the window's presenter and its buffers follow
+ *				the client extent from `WM_SIZE` automatically.
+ *	@note		All methods must be called from the thread owning the window.
+ */
+class easywin32::SwapChain : public easywin32::Presenter
+{
+	template<typename Type> using ComPtr = Microsoft::WRL::ComPtr<Type>;
+
+public:
+
+	SwapChain() = default;
+
+	SwapChain(const SwapChain&) = delete;
+
+	void operator=(const SwapChain&) = delete;
+
+	~SwapChain() { this->release(); }
+
+public:
+
+	/**
+	 *	@brief		Creates the D3D11 device and a flip-discard swap chain on the window (`nativeHandle()`).
+	 *	@param[in]	window - An opened window, the swap chain attaches itself as its presenter.
+	 *	@param[in]	allowTearing - Enables `DXGI_PRESENT_ALLOW_TEARING` when the system supports it.
+	 *	@param[in]	bufferCount - Number of back buffers (2 for double buffering, 3 for triple buffering).
+	 *	@return		`true` on success.
+	 */
+	bool create(Window & window, bool allowTearing = false, UINT bufferCount = 2);
+
+
+	//!	@brief	Detaches from the window and releases all D3D11/DXGI objects.
+	void release();
+
+
+	/**
+	 *	@brief		Maps the upload texture for writing a CPU frame in place.
+	 *	@details	The upload texture is (re)created when the requested extent changes. The mapped memory is
+	 *				discarded on every call, so the whole frame must be written before `endFrame`.
+	 *	@param[in]	width, height - Extent of the frame in pixels.
+	 *	@param[out]	pitch - Row pitch of the mapped memory in bytes.
+	 *	@return		The pointer to the first row, `nullptr` on failure.
+	 */
+	ColorBGRA * beginFrame(int width, int height, size_t & pitch);
+
+
+	/**
+	 *	@brief		Unmaps the upload texture, places it into the back buffer according to the scale mode and presents.
+	 *	@param[in]	syncInterval - 0 = no vsync (tearing if enabled), 1 ~ 4 = number of vertical blanks to wait.
+	 *	@return		The result of `IDXGISwapChain::Present` (e.g. `DXGI_STATUS_OCCLUDED`).
+	 *	@note		The occlusion status is reported to the window (see `Window::getVisibility`), which pauses `runFrameLoop`
+	 *				until it gets visible again.
+	 */
+	HRESULT endFrame(UINT syncInterval = 1);
+
+
+	/**
+	 *	@brief		Uploads a CPU frame and presents it.
+	 *	@param[in]	pitch - Distance between two rows in bytes (0 = `width * 4`).
+	 *	@return		The result of `IDXGISwapChain::Present`, or `E_FAIL` if the upload failed.
+	 */
+	HRESULT present(const ColorBGRA * pixels, int width, int height, size_t pitch, UINT syncInterval = 1);
+
+
+	/**
+	 *	@brief		Presents the current back buffer, for callers rendering on the GPU.
+	 *	@note		With the flip model, the render target view must be bound again after each present.
+	 */
+	HRESULT present(UINT syncInterval = 1);
+
+
+	//!	@brief	Resizes the swap chain buffers (called by the window from `WM_SIZE`).
+	virtual void resize(int width, int height) override;
+
+
+	//!	@brief	Tests whether the window is occluded with `DXGI_PRESENT_TEST`, without presenting (called by the window).
+	virtual bool testOcclusion() override;
+
+
+	/**
+	 *	@brief		Selects how CPU frames are scaled to the back buffer.
+	 *	@details	Scaled modes draw the upload texture on the GPU with a full-screen triangle (shaders compiled once
+	 *				with `D3DCompile`) instead of copying it, so a small frame fills a large window at no CPU cost.
+	 *				The draw sets the render target, viewport, shaders and sampler of the immediate context.
+	 *	@param[in]	clearColor - Color of the bars left by `ScaleMode::Letterbox` and `ScaleMode::IntegerFit`, and around
+	 *				a `ScaleMode::None` frame smaller than the back buffer.
+	 */
+	void setScaleMode(ScaleMode mode, ScaleFilter filter = ScaleFilter::Linear, ColorBGRA clearColor = ColorBGRA{ 0, 0, 0, 255 });
+
+
+	/**
+	 *	@brief		Computes where a frame lands in the back buffer with the given scale mode.
+	 *	@param[in]	frame - Extent of the CPU frame.
+	 *	@param[in]	target - Extent of the back buffer.
+	 *	@return		The covered rectangle in back buffer pixels, empty if either extent is empty.
+	 */
+	static Rect computeFrameRect(ScaleMode mode, Size frame, Size target);
+
+	/**
+	 *	@brief		Whether the frame leaves part of the back buffer uncovered, which is then cleared to the clear color.
+	 *	@details	Flip-model back buffers are undefined after each present, so every pixel must be written.
+	 */
+	static bool leavesBars(ScaleMode mode, Size frame, Size target);
+
+public:
+
+	//!	@brief	Whether the swap chain has been created.
+	bool isValid() const { return m_swapChain != nullptr; }
+
+	//!	@brief	Whether presenting with `syncInterval = 0` uses `DXGI_PRESENT_ALLOW_TEARING`.
+	bool tearingEnabled() const { return m_tearingEnabled; }
+
+	//!	@brief	Returns the extent of the back buffers.
+	Size getExtent() const { return m_extent; }
+
+	//!	@brief	Returns how CPU frames are scaled to the back buffer.
+	ScaleMode getScaleMode() const { return m_scaleMode; }
+
+	//!	@brief	Returns the sampling used by scaled presentation.
+	ScaleFilter getScaleFilter() const { return m_scaleFilter; }
+
+	//!	@brief	Returns the rectangle covered by the last CPU frame, e.g. to map mouse positions to frame pixels.
+	Rect getFrameRect() const { return m_frameRect; }
+
+	//!	@brief	Returns the current back buffer.
+	ID3D11Texture2D * getBackBuffer() const { return m_backBuffer.Get(); }
+
+	//!	@brief	Returns the render target view of the current back buffer.
+	ID3D11RenderTargetView * getRenderTargetView() const { return m_renderTargetView.Get(); }
+
+	//!	@brief	Returns the D3D11 device.
+	ID3D11Device * nativeDevice() const { return m_device.Get(); }
+
+	//!	@brief	Returns the immediate context of the D3D11 device.
+	ID3D11DeviceContext * nativeContext() const { return m_context.Get(); }
+
+	//!	@brief	Returns the DXGI swap chain.
+	IDXGISwapChain1 * nativeHandle() const { return m_swapChain.Get(); }
+
+private:
+
+	//!	@brief	Acquires the back buffer and creates its render target view.
+	bool createBackBufferViews();
+
+	//!	@brief	Makes sure the upload texture has the requested extent.
+	bool prepareUploadTexture(int width, int height);
+
+	//!	@brief	Compiles the shaders and creates the samplers used by scaled presentation.
+	bool createScalingPipeline();
+
+	//!	@brief	Draws the upload texture into the back buffer according to the scale mode.
+	bool drawScaled();
+
+private:
+
+	Window *								m_window = nullptr;
+	ComPtr<IDXGIFactory2>					m_factory;				// Kept to unregister the occlusion status notifications
+	ComPtr<ID3D11Device>					m_device;
+	ComPtr<ID3D11DeviceContext>				m_context;
+	ComPtr<IDXGISwapChain1>					m_swapChain;
+	ComPtr<ID3D11Texture2D>					m_backBuffer;
+	ComPtr<ID3D11RenderTargetView>			m_renderTargetView;
+	ComPtr<ID3D11Texture2D>					m_uploadTexture;
+	ComPtr<ID3D11ShaderResourceView>		m_uploadView;			// Created on the first scaled present
+	ComPtr<ID3D11VertexShader>				m_vertexShader;
+	ComPtr<ID3D11PixelShader>				m_pixelShader;
+	ComPtr<ID3D11SamplerState>				m_pointSampler;
+	ComPtr<ID3D11SamplerState>				m_linearSampler;
+	ScaleMode								m_scaleMode = ScaleMode::None;
+	ScaleFilter								m_scaleFilter = ScaleFilter::Linear;
+	ColorBGRA								m_clearColor = { 0, 0, 0, 255 };
+	Rect									m_frameRect = { 0, 0, 0, 0 };
+	Size									m_uploadExtent = { 0, 0 };
+	Size									m_extent = { 0, 0 };
+	UINT									m_bufferCount = 2;
+	DWORD									m_occlusionCookie = 0;	// 0 if not registered
+	bool									m_tearingEnabled = false;
+	bool									m_mapped = false;
+};
+
+/*********************************************************************************
+******************************    Implementation    ******************************
+*********************************************************************************/
+
+#ifdef EZWIN32_IMPLEMENTATION
+
+/**
+ *	@brief		Creates the D3D11 device and a flip-discard swap chain on the window.
+ *	@details	The device is created with BGRA support, the swap chain uses `DXGI_FORMAT_B8G8R8A8_UNORM`
+ *				(the native layout of `ColorBGRA`) and `DXGI_SWAP_EFFECT_FLIP_DISCARD`. Tearing is only enabled
+ *				when `IDXGIFactory5::CheckFeatureSupport` reports `DXGI_FEATURE_PRESENT_ALLOW_TEARING`.
+ */
+bool easywin32::SwapChain::create(Window & window, bool allowTearing, UINT bufferCount)
+{
+	this->release();
+
+	if (!window.isOpen())
+		return false;
+
+	UINT deviceFlags = D3D11_CREATE_DEVICE_BGRA_SUPPORT;
+
+#ifdef _DEBUG
+	deviceFlags |= D3D11_CREATE_DEVICE_DEBUG;
+#endif
+
+	const D3D_FEATURE_LEVEL featureLevels[] = { D3D_FEATURE_LEVEL_11_1, D3D_FEATURE_LEVEL_11_0, D3D_FEATURE_LEVEL_10_1, D3D_FEATURE_LEVEL_10_0 };
+
+	HRESULT hr = ::D3D11CreateDevice(nullptr, D3D_DRIVER_TYPE_HARDWARE, nullptr, deviceFlags, featureLevels, ARRAYSIZE(featureLevels),
+									 D3D11_SDK_VERSION, m_device.GetAddressOf(), nullptr, m_context.GetAddressOf());
+
+#ifdef _DEBUG
+	if (FAILED(hr))		// The debug layer may not be installed
+	{
+		hr = ::D3D11CreateDevice(nullptr, D3D_DRIVER_TYPE_HARDWARE, nullptr, deviceFlags & ~D3D11_CREATE_DEVICE_DEBUG, featureLevels, ARRAYSIZE(featureLevels),
+								 D3D11_SDK_VERSION, m_device.GetAddressOf(), nullptr, m_context.GetAddressOf());
+	}
+#endif
+
+	if (FAILED(hr))
+		return false;
+
+	// Retrieve the factory that created the device
+	ComPtr<IDXGIDevice> dxgiDevice;
+	ComPtr<IDXGIAdapter> dxgiAdapter;
+	ComPtr<IDXGIFactory2> dxgiFactory;
+
+	if (FAILED(m_device.As(&dxgiDevice)) || FAILED(dxgiDevice->GetAdapter(dxgiAdapter.GetAddressOf())) ||
+		FAILED(dxgiAdapter->GetParent(IID_PPV_ARGS(dxgiFactory.GetAddressOf()))))
+	{
+		this->release();
+
+		return false;
+	}
+
+	if (allowTearing)
+	{
+		ComPtr<IDXGIFactory5> dxgiFactory5;
+
+		BOOL supported = FALSE;
+
+		if (SUCCEEDED(dxgiFactory.As(&dxgiFactory5)) &&
+			SUCCEEDED(dxgiFactory5->CheckFeatureSupport(DXGI_FEATURE_PRESENT_ALLOW_TEARING, &supported, sizeof(supported))))
+		{
+			m_tearingEnabled = (supported != FALSE);
+		}
+	}
+
+	m_bufferCount = (bufferCount < 2) ? 2 : bufferCount;
+
+	auto extent = window.getClientExtent();
+
+	DXGI_SWAP_CHAIN_DESC1 desc = {};
+	desc.Width					= static_cast<UINT>(extent.cx > 0 ? extent.cx : 1);
+	desc.Height					= static_cast<UINT>(extent.cy > 0 ? extent.cy : 1);
+	desc.Format					= DXGI_FORMAT_B8G8R8A8_UNORM;
+	desc.SampleDesc.Count		= 1;
+	desc.BufferUsage			= DXGI_USAGE_RENDER_TARGET_OUTPUT;
+	desc.BufferCount			= m_bufferCount;
+	desc.Scaling				= DXGI_SCALING_NONE;
+	desc.SwapEffect				= DXGI_SWAP_EFFECT_FLIP_DISCARD;
+	desc.AlphaMode				= DXGI_ALPHA_MODE_IGNORE;
+	desc.Flags					= m_tearingEnabled ? DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING : 0;
+
+	hr = dxgiFactory->CreateSwapChainForHwnd(m_device.Get(), window.nativeHandle(), &desc, nullptr, nullptr, m_swapChain.GetAddressOf());
+
+	if (FAILED(hr))
+	{
+		this->release();
+
+		return false;
+	}
+
+	// The window owns its mode changes, DXGI must not toggle fullscreen on Alt+Enter
+	dxgiFactory->MakeWindowAssociation(window.nativeHandle(), DXGI_MWA_NO_ALT_ENTER);
+
+	m_extent = Size{ static_cast<LONG>(desc.Width), static_cast<LONG>(desc.Height) };
+
+	if (!this->createBackBufferViews())
+	{
+		this->release();
+
+		return false;
+	}
+
+	m_window = &window;
+
+	m_window->setPresenter(this);
+
+	// Posts `Window::occlusionStatusMessage` when the window gets occluded or visible again, without polling
+	if (FAILED(dxgiFactory->RegisterOcclusionStatusWindow(window.nativeHandle(), Window::occlusionStatusMessage(), &m_occlusionCookie)))
+	{
+		m_occlusionCookie = 0;
+	}
+
+	m_factory = dxgiFactory;
+
+	return true;
+}
+
+
+//!	@brief	Detaches from the window and releases all D3D11/DXGI objects.
+void easywin32::SwapChain::release()
+{
+	if (m_mapped)
+	{
+		m_context->Unmap(m_uploadTexture.Get(), 0);
+
+		m_mapped = false;
+	}
+
+	if ((m_window != nullptr) && (m_window->getPresenter() == this))
+	{
+		m_window->setPresenter(nullptr);
+
+		m_window->setOccluded(false);
+	}
+
+	if (m_occlusionCookie != 0)
+	{
+		m_factory->UnregisterOcclusionStatus(m_occlusionCookie);
+
+		m_occlusionCookie = 0;
+	}
+
+	if (m_context != nullptr)
+	{
+		m_context->ClearState();
+	}
+
+	m_renderTargetView.Reset();
+	m_linearSampler.Reset();
+	m_pointSampler.Reset();
+	m_pixelShader.Reset();
+	m_vertexShader.Reset();
+	m_uploadView.Reset();
+	m_uploadTexture.Reset();
+	m_backBuffer.Reset();
+	m_swapChain.Reset();
+	m_context.Reset();
+	m_device.Reset();
+	m_factory.Reset();
+
+	m_uploadExtent = Size{ 0, 0 };
+	m_frameRect = Rect{ 0, 0, 0, 0 };
+	m_extent = Size{ 0, 0 };
+	m_tearingEnabled = false;
+	m_window = nullptr;
+}
+
+
+//!	@brief	Acquires the back buffer and creates its render target view.
+bool easywin32::SwapChain::createBackBufferViews()
+{
+	if (FAILED(m_swapChain->GetBuffer(0, IID_PPV_ARGS(m_backBuffer.ReleaseAndGetAddressOf()))))
+		return false;
+
+	if (FAILED(m_device->CreateRenderTargetView(m_backBuffer.Get(), nullptr, m_renderTargetView.ReleaseAndGetAddressOf())))
+		return false;
+
+	return true;
+}
+
+
+/**
+ *	@brief		Resizes the swap chain buffers.
+ *	@details	All references to the back buffers must be released before `ResizeBuffers`, they are
+ *				acquired again afterwards. Does nothing if the extent is unchanged.
+ */
+void easywin32::SwapChain::resize(int width, int height)
+{
+	if ((m_swapChain == nullptr) || (width <= 0) || (height <= 0))
+		return;
+
+	if ((width == m_extent.cx) && (height == m_extent.cy))
+		return;
+
+	m_context->OMSetRenderTargets(0, nullptr, nullptr);
+
+	m_renderTargetView.Reset();
+
+	m_backBuffer.Reset();
+
+	UINT flags = m_tearingEnabled ? DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING : 0;
+
+	if (SUCCEEDED(m_swapChain->ResizeBuffers(m_bufferCount, static_cast<UINT>(width), static_cast<UINT>(height), DXGI_FORMAT_B8G8R8A8_UNORM, flags)))
+	{
+		m_extent = Size{ width, height };
+	}
+
+	this->createBackBufferViews();
+}
+
+
+//!	@brief	Makes sure the upload texture has the requested extent.
+bool easywin32::SwapChain::prepareUploadTexture(int width, int height)
+{
+	if ((m_uploadTexture != nullptr) && (m_uploadExtent.cx == width) && (m_uploadExtent.cy == height))
+		return true;
+
+	m_uploadView.Reset();
+
+	m_uploadTexture.Reset();
+
+	m_uploadExtent = Size{ 0, 0 };
+
+	D3D11_TEXTURE2D_DESC desc = {};
+	desc.Width					= static_cast<UINT>(width);
+	desc.Height					= static_cast<UINT>(height);
+	desc.MipLevels				= 1;
+	desc.ArraySize				= 1;
+	desc.Format					= DXGI_FORMAT_B8G8R8A8_UNORM;
+	desc.SampleDesc.Count		= 1;
+	desc.Usage					= D3D11_USAGE_DYNAMIC;
+	desc.BindFlags				= D3D11_BIND_SHADER_RESOURCE;
+	desc.CPUAccessFlags			= D3D11_CPU_ACCESS_WRITE;
+
+	if (FAILED(m_device->CreateTexture2D(&desc, nullptr, m_uploadTexture.GetAddressOf())))
+		return false;
+
+	m_uploadExtent = Size{ width, height };
+
+	return true;
+}
+
+
+//!	@brief	Maps the upload texture for writing a CPU frame in place.
+easywin32::ColorBGRA * easywin32::SwapChain::beginFrame(int width, int height, size_t & pitch)
+{
+	pitch = 0;
+
+	if ((m_swapChain == nullptr) || m_mapped || (width <= 0) || (height <= 0))
+		return nullptr;
+
+	if (!this->prepareUploadTexture(width, height))
+		return nullptr;
+
+	D3D11_MAPPED_SUBRESOURCE mapped = {};
+
+	if (FAILED(m_context->Map(m_uploadTexture.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped)))
+		return nullptr;
+
+	m_mapped = true;
+
+	pitch = mapped.RowPitch;
+
+	return static_cast<ColorBGRA*>(mapped.pData);
+}
+
+
+/**
+ *	@brief		Unmaps the upload texture, places it into the back buffer and presents.
+ *	@details	`ScaleMode::None` copies the frame with `CopySubresourceRegion`, the other modes draw it (see `drawScaled`).
+ */
+HRESULT easywin32::SwapChain::endFrame(UINT syncInterval)
+{
+	if (!m_mapped)
+		return E_FAIL;
+
+	m_context->Unmap(m_uploadTexture.Get(), 0);
+
+	m_mapped = false;
+
+	if (m_scaleMode == ScaleMode::None)
+	{
+		m_frameRect = SwapChain::computeFrameRect(ScaleMode::None, m_uploadExtent, m_extent);
+
+		if (SwapChain::leavesBars(ScaleMode::None, m_uploadExtent, m_extent))		// E.g. the window grew, the frame did not yet
+		{
+			const FLOAT color[4] = { m_clearColor.r / 255.0f, m_clearColor.g / 255.0f, m_clearColor.b / 255.0f, m_clearColor.a / 255.0f };
+
+			m_context->ClearRenderTargetView(m_renderTargetView.Get(), color);
+		}
+
+		D3D11_BOX box = {};
+		box.right	= static_cast<UINT>(m_frameRect.right);
+		box.bottom	= static_cast<UINT>(m_frameRect.bottom);
+		box.back	= 1;
+
+		m_context->CopySubresourceRegion(m_backBuffer.Get(), 0, 0, 0, 0, m_uploadTexture.Get(), 0, &box);
+	}
+	else if (!this->drawScaled())
+	{
+		return E_FAIL;
+	}
+
+	return this->present(syncInterval);
+}
+
+
+//!	@brief	Selects how CPU frames are scaled to the back buffer.
+void easywin32::SwapChain::setScaleMode(ScaleMode mode, ScaleFilter filter, ColorBGRA clearColor)
+{
+	m_clearColor = clearColor;
+	m_scaleFilter = filter;
+	m_scaleMode = mode;
+}
+
+
+//!	@brief	Computes where a frame lands in the back buffer with the given scale mode.
+easywin32::Rect easywin32::SwapChain::computeFrameRect(ScaleMode mode, Size frame, Size target)
+{
+	if ((frame.cx <= 0) || (frame.cy <= 0) || (target.cx <= 0) || (target.cy <= 0))
+		return Rect{ 0, 0, 0, 0 };
+
+	Size extent = target;
+
+	switch (mode)
+	{
+		case ScaleMode::Stretch:
+		{
+			break;
+		}
+		case ScaleMode::IntegerFit:
+		{
+			const LONG scaleX = target.cx / frame.cx;
+			const LONG scaleY = target.cy / frame.cy;
+			const LONG scale = scaleX < scaleY ? scaleX : scaleY;
+
+			if (scale >= 1)
+			{
+				extent = Size{ frame.cx * scale, frame.cy * scale };
+
+				break;
+			}
+
+			[[fallthrough]];	// Larger than the target: scale down as `Letterbox`
+		}
+		case ScaleMode::Letterbox:
+		{
+			// Compares the aspect ratios without rounding: frame.cx / frame.cy > target.cx / target.cy
+			if (static_cast<long long>(frame.cx) * target.cy > static_cast<long long>(target.cx) * frame.cy)
+				extent.cy = static_cast<LONG>(static_cast<long long>(target.cx) * frame.cy / frame.cx);
+			else
+				extent.cx = static_cast<LONG>(static_cast<long long>(target.cy) * frame.cx / frame.cy);
+
+			break;
+		}
+		default:		// ScaleMode::None, top-left aligned and cropped
+		{
+			return Rect{ 0, 0, frame.cx < target.cx ? frame.cx : target.cx, frame.cy < target.cy ? frame.cy : target.cy };
+		}
+	}
+
+	const LONG left = (target.cx - extent.cx) / 2;
+	const LONG top = (target.cy - extent.cy) / 2;
+
+	return Rect{ left, top, left + extent.cx, top + extent.cy };
+}
+
+
+//!	@brief	Whether the frame leaves part of the back buffer uncovered.
+bool easywin32::SwapChain::leavesBars(ScaleMode mode, Size frame, Size target)
+{
+	const Rect rect = SwapChain::computeFrameRect(mode, frame, target);
+
+	return (rect.left != 0) || (rect.top != 0) || (rect.right != target.cx) || (rect.bottom != target.cy);
+}
+
+
+/**
+ *	@brief		Compiles the shaders and creates the samplers used by scaled presentation.
+ *	@details	The vertex shader generates a triangle covering the viewport from `SV_VertexID`, so neither a
+ *				vertex buffer nor an input layout is needed. Shader model 4.0 matches the lowest feature level (10.0).
+ */
+bool easywin32::SwapChain::createScalingPipeline()
+{
+	static const char s_source[] =
+		"Texture2D<float4> frame : register(t0);\n"
+		"SamplerState frameSampler : register(s0);\n"
+		"struct Varyings { float4 position : SV_Position; float2 uv : TEXCOORD0; };\n"
+		"Varyings vsMain(uint id : SV_VertexID)\n"
+		"{\n"
+		"	Varyings output;\n"
+		"	output.uv = float2((id << 1) & 2, id & 2);\n"
+		"	output.position = float4(output.uv * float2(2.0, -2.0) + float2(-1.0, 1.0), 0.0, 1.0);\n"
+		"	return output;\n"
+		"}\n"
+		"float4 psMain(Varyings input) : SV_Target { return frame.Sample(frameSampler, input.uv); }\n";
+
+	ComPtr<ID3DBlob> vertexCode, pixelCode;
+
+	if (FAILED(::D3DCompile(s_source, sizeof(s_source) - 1, "easywin32_scale", nullptr, nullptr, "vsMain", "vs_4_0", D3DCOMPILE_OPTIMIZATION_LEVEL3, 0, vertexCode.GetAddressOf(), nullptr)) ||
+		FAILED(::D3DCompile(s_source, sizeof(s_source) - 1, "easywin32_scale", nullptr, nullptr, "psMain", "ps_4_0", D3DCOMPILE_OPTIMIZATION_LEVEL3, 0, pixelCode.GetAddressOf(), nullptr)))
+	{
+		return false;
+	}
+
+	if (FAILED(m_device->CreateVertexShader(vertexCode->GetBufferPointer(), vertexCode->GetBufferSize(), nullptr, m_vertexShader.ReleaseAndGetAddressOf())) ||
+		FAILED(m_device->CreatePixelShader(pixelCode->GetBufferPointer(), pixelCode->GetBufferSize(), nullptr, m_pixelShader.ReleaseAndGetAddressOf())))
+	{
+		m_vertexShader.Reset();
+
+		return false;
+	}
+
+	D3D11_SAMPLER_DESC desc = {};
+	desc.Filter				= D3D11_FILTER_MIN_MAG_MIP_POINT;
+	desc.AddressU			= D3D11_TEXTURE_ADDRESS_CLAMP;
+	desc.AddressV			= D3D11_TEXTURE_ADDRESS_CLAMP;
+	desc.AddressW			= D3D11_TEXTURE_ADDRESS_CLAMP;
+	desc.ComparisonFunc		= D3D11_COMPARISON_NEVER;
+	desc.MaxLOD				= D3D11_FLOAT32_MAX;
+
+	if (FAILED(m_device->CreateSamplerState(&desc, m_pointSampler.ReleaseAndGetAddressOf())))
+		return false;
+
+	desc.Filter				= D3D11_FILTER_MIN_MAG_MIP_LINEAR;
+
+	if (FAILED(m_device->CreateSamplerState(&desc, m_linearSampler.ReleaseAndGetAddressOf())))
+		return false;
+
+	return true;
+}
+
+
+//!	@brief	Draws the upload texture into the back buffer according to the scale mode.
+bool easywin32::SwapChain::drawScaled()
+{
+	if ((m_linearSampler == nullptr) && !this->createScalingPipeline())
+		return false;
+
+	if ((m_uploadView == nullptr) && FAILED(m_device->CreateShaderResourceView(m_uploadTexture.Get(), nullptr, m_uploadView.GetAddressOf())))
+		return false;
+
+	m_frameRect = SwapChain::computeFrameRect(m_scaleMode, m_uploadExtent, m_extent);
+
+	if (SwapChain::leavesBars(m_scaleMode, m_uploadExtent, m_extent))
+	{
+		const FLOAT color[4] = { m_clearColor.r / 255.0f, m_clearColor.g / 255.0f, m_clearColor.b / 255.0f, m_clearColor.a / 255.0f };
+
+		m_context->ClearRenderTargetView(m_renderTargetView.Get(), color);
+	}
+
+	D3D11_VIEWPORT viewport = {};
+	viewport.TopLeftX	= static_cast<FLOAT>(m_frameRect.left);
+	viewport.TopLeftY	= static_cast<FLOAT>(m_frameRect.top);
+	viewport.Width		= static_cast<FLOAT>(m_frameRect.right - m_frameRect.left);
+	viewport.Height		= static_cast<FLOAT>(m_frameRect.bottom - m_frameRect.top);
+	viewport.MaxDepth	= 1.0f;
+
+	ID3D11SamplerState * sampler = (m_scaleFilter == ScaleFilter::Nearest) ? m_pointSampler.Get() : m_linearSampler.Get();
+
+	ID3D11ShaderResourceView * view = m_uploadView.Get();
+
+	m_context->OMSetRenderTargets(1, m_renderTargetView.GetAddressOf(), nullptr);
+	m_context->RSSetViewports(1, &viewport);
+	m_context->IASetInputLayout(nullptr);
+	m_context->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+	m_context->VSSetShader(m_vertexShader.Get(), nullptr, 0);
+	m_context->PSSetShader(m_pixelShader.Get(), nullptr, 0);
+	m_context->PSSetShaderResources(0, 1, &view);
+	m_context->PSSetSamplers(0, 1, &sampler);
+	m_context->Draw(3, 0);
+
+	view = nullptr;
+
+	m_context->PSSetShaderResources(0, 1, &view);		// Unbound before the next frame maps the texture again
+
+	return true;
+}
+
+
+//!	@brief	Uploads a CPU frame and presents it.
+HRESULT easywin32::SwapChain::present(const ColorBGRA * pixels, int width, int height, size_t pitch, UINT syncInterval)
+{
+	if (pitch == 0)		pitch = static_cast<size_t>(width) * sizeof(ColorBGRA);
+
+	size_t dstPitch = 0;
+
+	auto dst = reinterpret_cast<Byte*>(this->beginFrame(width, height, dstPitch));
+
+	if (dst == nullptr)
+		return E_FAIL;
+
+	auto src = reinterpret_cast<const Byte*>(pixels);
+
+	size_t rowBytes = static_cast<size_t>(width) * sizeof(ColorBGRA);
+
+	if ((pitch == rowBytes) && (dstPitch == rowBytes))
+	{
+		std::memcpy(dst, src, rowBytes * height);
+	}
+	else
+	{
+		for (int y = 0; y < height; y++)
+		{
+			std::memcpy(dst + y * dstPitch, src + y * pitch, rowBytes);
+		}
+	}
+
+	return this->endFrame(syncInterval);
+}
+
+
+//!	@brief	Presents the current back buffer.
+HRESULT easywin32::SwapChain::present(UINT syncInterval)
+{
+	if (m_swapChain == nullptr)
+		return E_FAIL;
+
+	// Tearing is only allowed without vsync and outside of exclusive fullscreen
+	UINT flags = (m_tearingEnabled && (syncInterval == 0)) ? DXGI_PRESENT_ALLOW_TEARING : 0;
+
+	HRESULT hr = m_swapChain->Present(syncInterval, flags);
+
+	if ((m_window != nullptr) && ((hr == S_OK) || (hr == DXGI_STATUS_OCCLUDED)))
+	{
+		m_window->setOccluded(hr == DXGI_STATUS_OCCLUDED);
+	}
+
+	return hr;
+}
+
+
+//!	@brief	Tests whether the window is occluded, without presenting.
+bool easywin32::SwapChain::testOcclusion()
+{
+	return (m_swapChain != nullptr) && (m_swapChain->Present(0, DXGI_PRESENT_TEST) == DXGI_STATUS_OCCLUDED);
+}
+
+#endif
@@ -0,0 +1,180 @@
+﻿/**
+ *	Copyright (c) 2025 Wenchao Huang <physhuangwenchao@gmail.com>
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ * 
+ *	Repo URL: https://github.com/WenchaoHuang/easywin32.git
+ */
+#pragma once
+
+/**
+ *	Forward declarations of EasyWin32, for translation units that only name its types
+ *	(members, parameters, pointers and references) without calling into it.
+ *	Does not include <Windows.h>: include "easywin32.h" wherever a definition is needed.
+ */
+
+// C++ headers
+#include <stdint.h>
+
+// Win32 geometry (see <Windows.h>)
+struct tagSIZE;
+struct tagRECT;
+struct tagPOINT;
+
+/*********************************************************************************
+********************************    EasyWin32    *********************************
+*********************************************************************************/
+
+namespace easywin32
+{
+	class Window;
+	class Framebuffer;
+	class SharedFramebufferWriter;
+	class FrameQueue;
+	class Presenter;
+	class EventRecorder;
+	class InputQueue;
+	class WindowThreadPool;
+	class WindowPool;
+	class DispatchProfiler;
+	class FrameCapture;
+	class FrameEncoder;
+	class RawFrameWriter;
+
+	struct Event;
+	struct FrameStats;
+	struct WaitResult;
+	struct InputState;
+	struct WindowDesc;
+	struct SharedFramebufferHeader;
+	struct DispatchStats;
+
+	template<typename EnumType> struct Flags;
+	template<typename Signature> class Callback;
+
+	namespace ThreadWindows {}
+
+	using Byte = unsigned char;
+	using Size = tagSIZE;
+	using Rect = tagRECT;
+	using Point = tagPOINT;
+#ifdef _WIN64
+	using Result = long long;		// LRESULT
+#else
+	using Result = long;			// LRESULT
+#endif
+
+	/*****************************************************************************
+	********************************    Enums    *********************************
+	*****************************************************************************/
+
+	enum class Key;
+	enum class Style;
+	enum class ExStyle : unsigned long;
+	enum class Cursor : uint64_t;
+	enum class Backdrop;
+	enum class KeyAction;
+	enum class MouseState;
+	enum class WaitSource;
+	enum class Visibility;
+	enum class MouseAction;
+	enum class MouseButton;
+	enum class CornerStyle;
+	enum class HitTestResult : Result;
+	enum class RawMouseButton;
+	enum class NonClientRenderingPolicy;
+
+	/*****************************************************************************
+	********************************    Color    *********************************
+	*****************************************************************************/
+
+	//!	@brief	Represents an RGB color with 8-bit channels.
+	struct ColorRGB
+	{
+		uint8_t		r;	//!< Red channel component (0–255)
+		uint8_t		g;	//!< Green channel component (0–255)
+		uint8_t		b;	//!< Blue channel component (0–255)
+	};
+
+	//!	@brief	Represents an RGBA color with 8-bit channels.
+	struct ColorRGBA : public ColorRGB
+	{
+		uint8_t		a;	//!< Alpha channel component (0–255)
+	};
+
+	//!	@brief	Represents a 32-bit BGRA color, matching the native memory layout of GDI/DXGI surfaces.
+	struct ColorBGRA
+	{
+		uint8_t		b;	//!< Blue channel component (0–255)
+		uint8_t		g;	//!< Green channel component (0–255)
+		uint8_t		r;	//!< Red channel component (0–255)
+		uint8_t		a;	//!< Alpha channel component (0–255), ignored by opaque presentation
+	};
+}
+
+/*********************************************************************************
+********************************    Type alias    ********************************
+*********************************************************************************/
+
+using EzKey = easywin32::Key;
+using EzByte = easywin32::Byte;
+using EzSize = easywin32::Size;
+using EzRect = easywin32::Rect;
+using EzPoint = easywin32::Point;
+using EzStyle = easywin32::Style;
+using EzResult = easywin32::Result;
+using EzWindow = easywin32::Window;
+using EzWindowDesc = easywin32::WindowDesc;
+using EzWindowPool = easywin32::WindowPool;
+using EzCursor = easywin32::Cursor;
+using EzExStyle = easywin32::ExStyle;
+using EzBackdrop = easywin32::Backdrop;
+using EzColorRGB = easywin32::ColorRGB;
+using EzColorRGBA = easywin32::ColorRGBA;
+using EzColorBGRA = easywin32::ColorBGRA;
+using EzPresenter = easywin32::Presenter;
+using EzFrameStats = easywin32::FrameStats;
+using EzFramebuffer = easywin32::Framebuffer;
+using EzSharedFramebufferWriter = easywin32::SharedFramebufferWriter;
+using EzSharedFramebufferHeader = easywin32::SharedFramebufferHeader;
+using EzFrameQueue = easywin32::FrameQueue;
+using EzFrameCapture = easywin32::FrameCapture;
+using EzFrameEncoder = easywin32::FrameEncoder;
+using EzRawFrameWriter = easywin32::RawFrameWriter;
+using EzEvent = easywin32::Event;
+using EzEventRecorder = easywin32::EventRecorder;
+using EzInputQueue = easywin32::InputQueue;
+using EzInputState = easywin32::InputState;
+using EzWindowThreadPool = easywin32::WindowThreadPool;
+using EzDispatchStats = easywin32::DispatchStats;
+using EzDispatchProfiler = easywin32::DispatchProfiler;
+using EzWaitSource = easywin32::WaitSource;
+using EzVisibility = easywin32::Visibility;
+using EzWaitResult = easywin32::WaitResult;
+using EzKeyAction = easywin32::KeyAction;
+using EzMouseState = easywin32::MouseState;
+using EzMouseAction = easywin32::MouseAction;
+using EzMouseButton = easywin32::MouseButton;
+using EzCornerStyle = easywin32::CornerStyle;
+using EzHitTestResult = easywin32::HitTestResult;
+using EzMouseStateFlags = easywin32::Flags<easywin32::MouseState>;
+using EzRawMouseButton = easywin32::RawMouseButton;
+using EzNonClientRenderingPolicy = easywin32::NonClientRenderingPolicy;
+template<typename EnumType> using EzFlags = easywin32::Flags<EnumType>;
+namespace EzThreadWindows = easywin32::ThreadWindows;
\ No newline at end of file
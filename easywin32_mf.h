@@ -0,0 +1,324 @@
+﻿/**
+ *	Copyright (c) 2025 Wenchao Huang <physhuangwenchao@gmail.com>
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ *
+ *	Repo URL: https://github.com/WenchaoHuang/easywin32.git
+ */
+#pragma once
+
+#include "easywin32.h"
+
+// C headers
+#include <mfapi.h>
+#include <mfidl.h>
+#include <mfreadwrite.h>
+
+// C++ headers
+#include <wrl/client.h>
+
+// Link Media Foundation (only consumers of this header get load-time imports of the MF DLLs, missing on N editions
+// without the Media Feature Pack: the implementation is compiled by easywin32_mf.cpp, see `EZWIN32_WITH_MEDIA_FOUNDATION`)
+#pragma comment(lib, "mfplat.lib")
+#pragma comment(lib, "mfreadwrite.lib")
+#pragma comment(lib, "mfuuid.lib")
+
+/*********************************************************************************
+*******************************    VideoEncoder    *******************************
+*********************************************************************************/
+
+namespace easywin32
+{
+	class VideoEncoder;
+
+	//!	@brief	Compression format of `VideoEncoder`.
+	enum class VideoCodec
+	{
+		H264,			//!< H.264 / AVC.
+		HEVC,			//!< H.265 / HEVC (requires the HEVC video extension on Windows 10 and later).
+	};
+}
+
+using EzVideoEncoder = easywin32::VideoEncoder;
+using EzVideoCodec = easywin32::VideoCodec;
+
+/**
+ *	@brief		Frame encoder compressing the captured frames to an MP4 file with the Media Foundation sink writer.
+ *	@details	The stream extent is the one of the first frame (rounded down to even, as required by the codecs):
+ *				later frames of another extent are cropped or padded with black. Samples are timestamped with their
+ *				capture time, so dropped frames show up as longer frames instead of shifting the timeline.
+ *				Hardware encoders are used when available, the sink writer converts BGRA to the codec input format.
+ *	@note		Media Foundation and COM are initialized on the thread of the first `encode` (the encoder thread of
+ *				`FrameCapture`), and released by `finish` on that thread. If the encoder is destroyed on another thread
+ *				without `finish`, the file is still finalized but COM is left to the encoding thread.
+ */
+class easywin32::VideoEncoder : public easywin32::FrameEncoder
+{
+	template<typename Type> using ComPtr = Microsoft::WRL::ComPtr<Type>;
+
+public:
+
+	/**
+	 *	@param[in]	path - Output file, in MP4 format.
+	 *	@param[in]	codec - Compression format.
+	 *	@param[in]	frameRate - Nominal frame rate of the stream, in frames per second.
+	 *	@param[in]	bitrate - Average bitrate, in bits per second.
+	 */
+	explicit VideoEncoder(string_type path, VideoCodec codec = VideoCodec::H264, UINT frameRate = 60, UINT bitrate = 8000000)
+		: m_path(std::move(path)), m_codec(codec), m_frameRate(frameRate > 0 ? frameRate : 60), m_bitrate(bitrate) {}
+
+	VideoEncoder(const VideoEncoder&) = delete;
+
+	void operator=(const VideoEncoder&) = delete;
+
+	~VideoEncoder() { this->finish(); }
+
+public:
+
+	void encode(const FrameQueue::Frame & frame) override;
+
+	//!	@brief	Finalizes the file and shuts Media Foundation down.
+	void finish() override;
+
+	//!	@brief	Whether the sink writer could not be created or a sample was rejected (the following frames are then skipped).
+	bool failed() const { return m_failed; }
+
+	//!	@brief	Returns the extent of the stream, 0x0 before the first frame.
+	Size getExtent() const { return Size{ m_width, m_height }; }
+
+private:
+
+	//!	@brief	Starts Media Foundation and the sink writer for a stream of the given extent.
+	bool initialize(int width, int height);
+
+private:
+
+	string_type					m_path;
+	VideoCodec					m_codec;
+	UINT						m_frameRate;
+	UINT						m_bitrate;
+	ComPtr<IMFSinkWriter>		m_writer;
+	DWORD						m_stream = 0;
+	int							m_width = 0;
+	int							m_height = 0;
+	int64_t						m_frequency = 0;		// QPC frequency
+	int64_t						m_startTime = 0;		// QPC timestamp of the first frame
+	LONGLONG					m_lastSampleTime = -1;	// 100 ns units
+	bool						m_comInitialized = false;
+	DWORD						m_comThreadId = 0;		// Thread that initialized COM, the only one allowed to release it
+	bool						m_mfStarted = false;
+	bool						m_failed = false;
+};
+
+/*********************************************************************************
+******************************    Implementation    ******************************
+*********************************************************************************/
+
+#ifdef EZWIN32_MF_IMPLEMENTATION
+
+/**
+ *	@brief		Starts Media Foundation and the sink writer for a stream of the given extent.
+ *	@details	The output type is the codec at the requested bitrate and frame rate, the input type is top-down
+ *				RGB32 (a positive default stride), which matches the layout of `ColorBGRA` frames.
+ */
+bool easywin32::VideoEncoder::initialize(int width, int height)
+{
+	HRESULT hr = ::CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+
+	m_comInitialized = SUCCEEDED(hr);		// RPC_E_CHANGED_MODE: already initialized by the caller, not ours to release
+
+	m_comThreadId = ::GetCurrentThreadId();
+
+	if (FAILED(hr) && (hr != RPC_E_CHANGED_MODE))
+		return false;
+
+	if (FAILED(::MFStartup(MF_VERSION, MFSTARTUP_LITE)))
+		return false;
+
+	m_mfStarted = true;
+
+#ifdef UNICODE
+	const std::wstring & path = m_path;
+#else
+	std::wstring path(::MultiByteToWideChar(CP_ACP, 0, m_path.c_str(), -1, nullptr, 0), L'\0');
+
+	::MultiByteToWideChar(CP_ACP, 0, m_path.c_str(), -1, path.data(), static_cast<int>(path.size()));
+#endif
+
+	ComPtr<IMFAttributes> attributes;
+
+	if (FAILED(::MFCreateAttributes(attributes.GetAddressOf(), 2)) ||
+		FAILED(attributes->SetUINT32(MF_READWRITE_ENABLE_HARDWARE_TRANSFORMS, TRUE)) ||
+		FAILED(attributes->SetUINT32(MF_SINK_WRITER_DISABLE_THROTTLING, TRUE)) ||
+		FAILED(::MFCreateSinkWriterFromURL(path.c_str(), nullptr, attributes.Get(), m_writer.GetAddressOf())))
+	{
+		return false;
+	}
+
+	const UINT32 stride = static_cast<UINT32>(width * sizeof(ColorBGRA));
+
+	ComPtr<IMFMediaType> outputType;
+	ComPtr<IMFMediaType> inputType;
+
+	hr = ::MFCreateMediaType(outputType.GetAddressOf());
+
+	if (SUCCEEDED(hr))	hr = outputType->SetGUID(MF_MT_MAJOR_TYPE, MFMediaType_Video);
+	if (SUCCEEDED(hr))	hr = outputType->SetGUID(MF_MT_SUBTYPE, (m_codec == VideoCodec::HEVC) ? MFVideoFormat_HEVC : MFVideoFormat_H264);
+	if (SUCCEEDED(hr))	hr = outputType->SetUINT32(MF_MT_AVG_BITRATE, m_bitrate);
+	if (SUCCEEDED(hr))	hr = outputType->SetUINT32(MF_MT_INTERLACE_MODE, MFVideoInterlace_Progressive);
+	if (SUCCEEDED(hr))	hr = ::MFSetAttributeSize(outputType.Get(), MF_MT_FRAME_SIZE, static_cast<UINT32>(width), static_cast<UINT32>(height));
+	if (SUCCEEDED(hr))	hr = ::MFSetAttributeRatio(outputType.Get(), MF_MT_FRAME_RATE, m_frameRate, 1);
+	if (SUCCEEDED(hr))	hr = ::MFSetAttributeRatio(outputType.Get(), MF_MT_PIXEL_ASPECT_RATIO, 1, 1);
+	if (SUCCEEDED(hr))	hr = m_writer->AddStream(outputType.Get(), &m_stream);
+
+	if (SUCCEEDED(hr))	hr = ::MFCreateMediaType(inputType.GetAddressOf());
+	if (SUCCEEDED(hr))	hr = inputType->SetGUID(MF_MT_MAJOR_TYPE, MFMediaType_Video);
+	if (SUCCEEDED(hr))	hr = inputType->SetGUID(MF_MT_SUBTYPE, MFVideoFormat_RGB32);
+	if (SUCCEEDED(hr))	hr = inputType->SetUINT32(MF_MT_INTERLACE_MODE, MFVideoInterlace_Progressive);
+	if (SUCCEEDED(hr))	hr = inputType->SetUINT32(MF_MT_DEFAULT_STRIDE, stride);
+	if (SUCCEEDED(hr))	hr = ::MFSetAttributeSize(inputType.Get(), MF_MT_FRAME_SIZE, static_cast<UINT32>(width), static_cast<UINT32>(height));
+	if (SUCCEEDED(hr))	hr = ::MFSetAttributeRatio(inputType.Get(), MF_MT_FRAME_RATE, m_frameRate, 1);
+	if (SUCCEEDED(hr))	hr = ::MFSetAttributeRatio(inputType.Get(), MF_MT_PIXEL_ASPECT_RATIO, 1, 1);
+	if (SUCCEEDED(hr))	hr = m_writer->SetInputMediaType(m_stream, inputType.Get(), nullptr);
+
+	if (SUCCEEDED(hr))	hr = m_writer->BeginWriting();
+
+	if (FAILED(hr))
+	{
+		m_writer.Reset();
+
+		return false;
+	}
+
+	LARGE_INTEGER frequency = {};		::QueryPerformanceFrequency(&frequency);
+
+	m_frequency = frequency.QuadPart;
+
+	m_width = width;
+
+	m_height = height;
+
+	return true;
+}
+
+
+void easywin32::VideoEncoder::encode(const FrameQueue::Frame & frame)
+{
+	if (m_failed)	return;
+
+	if (m_writer == nullptr)
+	{
+		if ((frame.width < 2) || (frame.height < 2) || !this->initialize(frame.width & ~1, frame.height & ~1))
+		{
+			m_failed = true;
+
+			return;
+		}
+
+		m_startTime = frame.time;
+	}
+
+	// Capture time in 100 ns units, kept strictly increasing
+	const int64_t ticks = frame.time - m_startTime;
+
+	LONGLONG sampleTime = (ticks / m_frequency) * 10000000 + (ticks % m_frequency) * 10000000 / m_frequency;
+
+	sampleTime = (sampleTime > m_lastSampleTime) ? sampleTime : m_lastSampleTime + 1;
+
+	m_lastSampleTime = sampleTime;
+
+	// Copy into a buffer of the stream extent, cropping or padding the frame
+	const DWORD stride = static_cast<DWORD>(m_width * sizeof(ColorBGRA));
+
+	const DWORD size = stride * static_cast<DWORD>(m_height);
+
+	ComPtr<IMFMediaBuffer> buffer;
+	ComPtr<IMFSample> sample;
+	BYTE * data = nullptr;
+
+	HRESULT hr = ::MFCreateMemoryBuffer(size, buffer.GetAddressOf());
+
+	if (SUCCEEDED(hr))	hr = buffer->Lock(&data, nullptr, nullptr);
+
+	if (SUCCEEDED(hr))
+	{
+		const int width = (frame.width < m_width) ? frame.width : m_width;
+
+		const int height = (frame.height < m_height) ? frame.height : m_height;
+
+		if ((width != m_width) || (height != m_height))
+		{
+			std::memset(data, 0, size);
+		}
+
+		const BYTE * src = reinterpret_cast<const BYTE*>(frame.pixels.data());
+
+		::MFCopyImage(data, static_cast<LONG>(stride), src, static_cast<LONG>(frame.getPitch()), static_cast<DWORD>(width * sizeof(ColorBGRA)), static_cast<DWORD>(height));
+
+		buffer->Unlock();
+
+		hr = buffer->SetCurrentLength(size);
+	}
+
+	if (SUCCEEDED(hr))	hr = ::MFCreateSample(sample.GetAddressOf());
+	if (SUCCEEDED(hr))	hr = sample->AddBuffer(buffer.Get());
+	if (SUCCEEDED(hr))	hr = sample->SetSampleTime(sampleTime);
+	if (SUCCEEDED(hr))	hr = sample->SetSampleDuration(10000000 / m_frameRate);
+	if (SUCCEEDED(hr))	hr = m_writer->WriteSample(m_stream, sample.Get());
+
+	m_failed = FAILED(hr);
+}
+
+
+//!	@brief	Finalizes the file and shuts Media Foundation down.
+void easywin32::VideoEncoder::finish()
+{
+	const bool onComThread = (::GetCurrentThreadId() == m_comThreadId);
+
+	//	Called from another thread (e.g. by the destructor): a balanced MTA reference for the duration of the call
+	const bool localCom = !onComThread && (m_writer != nullptr) && SUCCEEDED(::CoInitializeEx(nullptr, COINIT_MULTITHREADED));
+
+	if (m_writer != nullptr)
+	{
+		m_writer->Finalize();
+
+		m_writer.Reset();
+	}
+
+	if (m_mfStarted)
+	{
+		::MFShutdown();
+
+		m_mfStarted = false;
+	}
+
+	if (localCom)
+	{
+		::CoUninitialize();
+	}
+
+	if (m_comInitialized && onComThread)
+	{
+		::CoUninitialize();
+
+		m_comInitialized = false;
+	}
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,966 @@
+﻿/**
+ *	Copyright (c) 2025 Wenchao Huang <physhuangwenchao@gmail.com>
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ *
+ *	Repo URL: https://github.com/WenchaoHuang/easywin32.git
+ */
+#pragma once
+
+#include "easywin32.h"
+
+/*********************************************************************************
+*********************************    PixelOps    *********************************
+*********************************************************************************/
+
+/**
+ *	@brief		CPU pixel kernels on the library's color types: fill, blit, format conversion, alpha blending and scaling.
+ *	@details	Each kernel runs with the best instruction set available (AVX2, then SSE4.1 on x86, NEON on ARM64),
+ *				selected once at runtime, and falls back to scalar code. All instruction sets produce bit-identical
+ *				results. Images are top-down and row-major, a pitch of `0` means tightly packed rows.
+ *	@note		The `Framebuffer` overloads clip the destination rectangle to the framebuffer bounds.
+ */
+namespace easywin32
+{
+	namespace PixelOps
+	{
+		//!	@brief	Instruction sets the kernels can run with.
+		enum class Isa
+		{
+			Scalar,			//!< Portable C++ code, also used as the reference by tests and benchmarks.
+			SSE41,			//!< SSE4.1 (x86).
+			AVX2,			//!< AVX2 (x86).
+			NEON,			//!< NEON (ARM64).
+		};
+
+		//!	@brief	Converts an `Isa` enum value to a string representation.
+		inline const char * to_string(Isa isa)
+		{
+			switch (isa)
+			{
+				EZWIN32_CASE_TO_STR(Isa::Scalar);
+				EZWIN32_CASE_TO_STR(Isa::SSE41);
+				EZWIN32_CASE_TO_STR(Isa::AVX2);
+				EZWIN32_CASE_TO_STR(Isa::NEON);
+				default:	return "Isa::Unknown";
+			}
+		}
+
+		//!	@brief	Filters used by `scale`.
+		enum class Filter
+		{
+			Nearest,		//!< Nearest neighbour, center-aligned.
+			Bilinear,		//!< Bilinear with 8-bit fixed-point weights, center-aligned, edges clamped.
+		};
+
+		//!	@brief	Whether the kernels can run with the given instruction set on this CPU.
+		bool isSupported(Isa isa);
+
+		//!	@brief	Returns the instruction set currently used by the kernels (the best supported one by default).
+		Isa getIsa();
+
+		/**
+		 *	@brief		Forces the instruction set used by the kernels, intended for tests and benchmarks.
+		 *	@return		`false` (and no change) if `isa` is not supported on this CPU.
+		 */
+		bool setIsa(Isa isa);
+
+		//!	@brief	Fills an image with a color.
+		void fill(ColorBGRA * dst, int width, int height, size_t dstPitch, ColorBGRA color);
+
+		//!	@brief	Copies an image.
+		void blit(const ColorBGRA * src, size_t srcPitch, ColorBGRA * dst, size_t dstPitch, int width, int height);
+
+		//!	@brief	Converts an RGB image to BGRX (alpha is set to 255), see `convertPixels`.
+		void convert(const ColorRGB * src, size_t srcPitch, ColorBGRA * dst, size_t dstPitch, int width, int height);
+
+		/**
+		 *	@brief		Composites a straight-alpha image over an image (source-over).
+		 *	@details	Each channel becomes `(s * a + d * (255 - a)) / 255` rounded to nearest, and the destination alpha
+		 *				becomes `a + d.a * (255 - a) / 255`, so opaque destinations stay opaque.
+		 */
+		void blend(const ColorRGBA * src, size_t srcPitch, ColorBGRA * dst, size_t dstPitch, int width, int height);
+
+		//!	@brief	Composites a straight-alpha image over an RGB image (source-over), with the rounding of the `ColorBGRA` overload.
+		void blend(const ColorRGBA * src, size_t srcPitch, ColorRGB * dst, size_t dstPitch, int width, int height);
+
+		//!	@brief	Resamples an image to another extent.
+		void scale(const ColorBGRA * src, int srcWidth, int srcHeight, size_t srcPitch,
+				   ColorBGRA * dst, int dstWidth, int dstHeight, size_t dstPitch, Filter filter = Filter::Bilinear);
+
+		//!	@brief	Fills the framebuffer with a color.
+		void fill(Framebuffer & dst, ColorBGRA color);
+
+		//!	@brief	Copies an image into the framebuffer at the given position.
+		void blit(const ColorBGRA * src, int width, int height, size_t pitch, Framebuffer & dst, int dstX = 0, int dstY = 0);
+
+		//!	@brief	Converts an RGB image into the framebuffer at the given position.
+		void convert(const ColorRGB * src, int width, int height, size_t pitch, Framebuffer & dst, int dstX = 0, int dstY = 0);
+
+		//!	@brief	Composites a straight-alpha image (e.g. a sprite) over the framebuffer at the given position.
+		void blend(const ColorRGBA * src, int width, int height, size_t pitch, Framebuffer & dst, int dstX = 0, int dstY = 0);
+
+		//!	@brief	Resamples an image to fill the whole framebuffer (e.g. to fit the client area).
+		void scale(const ColorBGRA * src, int width, int height, size_t pitch, Framebuffer & dst, Filter filter = Filter::Bilinear);
+	}
+}
+
+namespace EzPixelOps = easywin32::PixelOps;
+
+/*********************************************************************************
+******************************    Implementation    ******************************
+*********************************************************************************/
+
+#ifdef EZWIN32_IMPLEMENTATION
+
+#include <atomic>
+#include <cstring>
+#include <type_traits>
+
+#if defined(_M_ARM64) || defined(__aarch64__)
+	#define EZWIN32_ARCH_ARM64
+	#include <arm_neon.h>
+#endif
+
+namespace easywin32
+{
+	namespace PixelOps
+	{
+		namespace details
+		{
+			//!	@brief	Returns the best instruction set supported by the CPU.
+			static Isa detectIsa()
+			{
+			#if defined(EZWIN32_ARCH_X86)
+				const auto & features = easywin32::details::CpuFeatures::get();
+
+				if (features.avx2)		return Isa::AVX2;
+				if (features.sse41)		return Isa::SSE41;
+			#elif defined(EZWIN32_ARCH_ARM64)
+				return Isa::NEON;		// Mandatory on ARM64
+			#endif
+				return Isa::Scalar;
+			}
+
+			//!	@brief	Instruction set used by the kernels.
+			static std::atomic<Isa> & activeIsa() { static std::atomic<Isa> s_isa(detectIsa());	return s_isa; }
+
+			//!	@brief	Returns `pitch`, or the pitch of tightly packed rows if `pitch` is `0`.
+			template<typename Type> static size_t pitchOf(size_t pitch, int width) { return pitch != 0 ? pitch : static_cast<size_t>(width) * sizeof(Type); }
+
+			//!	@brief	Returns the pointer to the first pixel of row `y`.
+			template<typename Type> static Type * rowOf(Type * pixels, size_t pitch, int y)
+			{
+				using Bytes = std::conditional_t<std::is_const_v<Type>, const Byte, Byte>;
+
+				return reinterpret_cast<Type*>(reinterpret_cast<Bytes*>(pixels) + pitch * static_cast<size_t>(y));
+			}
+
+			//!	@brief	Exact `(s * a + d * (255 - a)) / 255`, rounded to nearest.
+			static inline uint8_t lerp(unsigned int s, unsigned int d, unsigned int a)
+			{
+				unsigned int t = s * a + d * (255 - a) + 128;
+
+				return static_cast<uint8_t>((t + (t >> 8)) >> 8);
+			}
+
+			//!	@brief	Bilinear tap: `(c0 * (256 - f) + c1 * f + 128) / 256`, the rounding used by every kernel.
+			static inline unsigned int tap(unsigned int c0, unsigned int c1, unsigned int f) { return (c0 * (256 - f) + c1 * f + 128) >> 8; }
+
+			//!	@brief	Bilinear sample of one pixel, vertical pass first.
+			static inline ColorBGRA bilinear(const ColorBGRA & l0, const ColorBGRA & r0, const ColorBGRA & l1, const ColorBGRA & r1, unsigned int fx, unsigned int fy)
+			{
+				return ColorBGRA{ static_cast<uint8_t>(tap(tap(l0.b, l1.b, fy), tap(r0.b, r1.b, fy), fx)),
+								  static_cast<uint8_t>(tap(tap(l0.g, l1.g, fy), tap(r0.g, r1.g, fy), fx)),
+								  static_cast<uint8_t>(tap(tap(l0.r, l1.r, fy), tap(r0.r, r1.r, fy), fx)),
+								  static_cast<uint8_t>(tap(tap(l0.a, l1.a, fy), tap(r0.a, r1.a, fy), fx)) };
+			}
+
+			/**
+			 *	@brief		Source position of the center of destination pixel `i`, in 1/256 source pixels.
+			 *	@details	Returns the integer index in `index` and the 8-bit fraction in `frac`, clamped to `[0, srcSize - 1]`.
+			 */
+			static inline void sourcePos(int i, int srcSize, int dstSize, int & index, int & frac)
+			{
+				long long pos = ((2LL * i + 1) * srcSize * 128) / dstSize - 128;
+
+				if (pos < 0)	pos = 0;
+
+				index = static_cast<int>(pos >> 8);
+				frac = static_cast<int>(pos & 255);
+
+				if (index >= srcSize - 1)
+				{
+					index = srcSize - 1;
+					frac = 0;
+				}
+			}
+
+			/*************************************************************************
+			********************************    Scalar    ****************************
+			*************************************************************************/
+
+			static void fillScalar(ColorBGRA * dst, size_t count, ColorBGRA color)
+			{
+				for (size_t i = 0; i < count; i++)		dst[i] = color;
+			}
+
+			static void blendScalar(const ColorRGBA * src, ColorBGRA * dst, size_t count)
+			{
+				for (size_t i = 0; i < count; i++)
+				{
+					const unsigned int a = src[i].a;
+
+					dst[i] = ColorBGRA{ lerp(src[i].b, dst[i].b, a), lerp(src[i].g, dst[i].g, a), lerp(src[i].r, dst[i].r, a), lerp(255, dst[i].a, a) };
+				}
+			}
+
+			static void blendScalar(const ColorRGBA * src, ColorRGB * dst, size_t count)
+			{
+				for (size_t i = 0; i < count; i++)
+				{
+					const unsigned int a = src[i].a;
+
+					dst[i] = ColorRGB{ lerp(src[i].r, dst[i].r, a), lerp(src[i].g, dst[i].g, a), lerp(src[i].b, dst[i].b, a) };
+				}
+			}
+
+			static void nearestScalar(const ColorBGRA * src, const int * index, ColorBGRA * dst, size_t count)
+			{
+				for (size_t i = 0; i < count; i++)		dst[i] = src[index[i]];
+			}
+
+			static void bilinearScalar(const ColorBGRA * row0, const ColorBGRA * row1, unsigned int fy, const int * index, const int * frac, int srcWidth, ColorBGRA * dst, size_t count)
+			{
+				for (size_t i = 0; i < count; i++)
+				{
+					const int x0 = index[i];
+					const int x1 = (x0 + 1 < srcWidth) ? x0 + 1 : x0;
+
+					dst[i] = bilinear(row0[x0], row0[x1], row1[x0], row1[x1], static_cast<unsigned int>(frac[i]), fy);
+				}
+			}
+
+			/*************************************************************************
+			*********************************    x86    ******************************
+			*************************************************************************/
+
+		#ifdef EZWIN32_ARCH_X86
+			EZWIN32_TARGET("sse4.1") static void fillSSE41(ColorBGRA * dst, size_t count, ColorBGRA color)
+			{
+				int value = 0;		std::memcpy(&value, &color, sizeof(value));
+
+				const __m128i v = _mm_set1_epi32(value);
+
+				size_t i = 0;
+
+				for (; i + 4 <= count; i += 4)		_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), v);
+
+				fillScalar(dst + i, count - i, color);
+			}
+
+
+			EZWIN32_TARGET("avx2") static void fillAVX2(ColorBGRA * dst, size_t count, ColorBGRA color)
+			{
+				int value = 0;		std::memcpy(&value, &color, sizeof(value));
+
+				const __m256i v = _mm256_set1_epi32(value);
+
+				size_t i = 0;
+
+				for (; i + 8 <= count; i += 8)		_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), v);
+
+				fillScalar(dst + i, count - i, color);
+			}
+
+
+			//!	@brief	`lerp` on 16-bit lanes, `s`, `d` and `a` hold one channel value per lane.
+			EZWIN32_TARGET("sse4.1") static inline __m128i lerpSSE41(__m128i s, __m128i d, __m128i a)
+			{
+				const __m128i ia = _mm_sub_epi16(_mm_set1_epi16(255), a);
+
+				__m128i t = _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(s, a), _mm_mullo_epi16(d, ia)), _mm_set1_epi16(128));
+
+				return _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+			}
+
+
+			//!	@brief	SSE4.1 kernel: 4 pixels per iteration.
+			EZWIN32_TARGET("sse4.1") static void blendSSE41(const ColorRGBA * src, ColorBGRA * dst, size_t count)
+			{
+				const __m128i swizzle = _mm_setr_epi8(2, 1, 0, -1, 6, 5, 4, -1, 10, 9, 8, -1, 14, 13, 12, -1);	// RGBA -> BGR0
+				const __m128i broadcast = _mm_setr_epi8(3, 3, 3, 3, 7, 7, 7, 7, 11, 11, 11, 11, 15, 15, 15, 15);
+				const __m128i opaque = _mm_set1_epi32(static_cast<int>(0xFF000000));		// Source alpha channel blends as 255
+				const __m128i zero = _mm_setzero_si128();
+
+				size_t i = 0;
+
+				for (; i + 4 <= count; i += 4)
+				{
+					__m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+					__m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+
+					__m128i a = _mm_shuffle_epi8(s, broadcast);
+
+					s = _mm_or_si128(_mm_shuffle_epi8(s, swizzle), opaque);
+
+					__m128i lo = lerpSSE41(_mm_unpacklo_epi8(s, zero), _mm_unpacklo_epi8(d, zero), _mm_unpacklo_epi8(a, zero));
+					__m128i hi = lerpSSE41(_mm_unpackhi_epi8(s, zero), _mm_unpackhi_epi8(d, zero), _mm_unpackhi_epi8(a, zero));
+
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packus_epi16(lo, hi));
+				}
+
+				blendScalar(src + i, dst + i, count - i);
+			}
+
+
+			//!	@brief	Loads 4 `ColorRGB` (12 bytes) into the low bytes, without reading past them.
+			EZWIN32_TARGET("sse4.1") static inline __m128i loadRGB4(const ColorRGB * src)
+			{
+				int tail = 0;		std::memcpy(&tail, reinterpret_cast<const uint8_t*>(src) + 8, sizeof(tail));
+
+				return _mm_insert_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src)), tail, 2);
+			}
+
+
+			//!	@brief	Stores the low 12 bytes as 4 `ColorRGB`, without writing past them.
+			EZWIN32_TARGET("sse4.1") static inline void storeRGB4(ColorRGB * dst, __m128i v)
+			{
+				_mm_storel_epi64(reinterpret_cast<__m128i*>(dst), v);
+
+				const int tail = _mm_extract_epi32(v, 2);		std::memcpy(reinterpret_cast<uint8_t*>(dst) + 8, &tail, sizeof(tail));
+			}
+
+
+			//!	@brief	SSE4.1 kernel over an RGB image: 4 pixels per iteration, widened to 32 bits for the same `lerpSSE41`.
+			EZWIN32_TARGET("sse4.1") static void blendSSE41(const ColorRGBA * src, ColorRGB * dst, size_t count)
+			{
+				const __m128i expand = _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);			// RGB -> RGB0
+				const __m128i compact = _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);		// RGBx -> RGB
+				const __m128i broadcast = _mm_setr_epi8(3, 3, 3, 3, 7, 7, 7, 7, 11, 11, 11, 11, 15, 15, 15, 15);
+				const __m128i zero = _mm_setzero_si128();
+
+				size_t i = 0;
+
+				for (; i + 4 <= count; i += 4)
+				{
+					__m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+					__m128i d = _mm_shuffle_epi8(loadRGB4(dst + i), expand);
+
+					__m128i a = _mm_shuffle_epi8(s, broadcast);
+
+					__m128i lo = lerpSSE41(_mm_unpacklo_epi8(s, zero), _mm_unpacklo_epi8(d, zero), _mm_unpacklo_epi8(a, zero));
+					__m128i hi = lerpSSE41(_mm_unpackhi_epi8(s, zero), _mm_unpackhi_epi8(d, zero), _mm_unpackhi_epi8(a, zero));
+
+					storeRGB4(dst + i, _mm_shuffle_epi8(_mm_packus_epi16(lo, hi), compact));
+				}
+
+				blendScalar(src + i, dst + i, count - i);
+			}
+
+
+			//!	@brief	`lerp` on 16-bit lanes, `s`, `d` and `a` hold one channel value per lane.
+			EZWIN32_TARGET("avx2") static inline __m256i lerpAVX2(__m256i s, __m256i d, __m256i a)
+			{
+				const __m256i ia = _mm256_sub_epi16(_mm256_set1_epi16(255), a);
+
+				__m256i t = _mm256_add_epi16(_mm256_add_epi16(_mm256_mullo_epi16(s, a), _mm256_mullo_epi16(d, ia)), _mm256_set1_epi16(128));
+
+				return _mm256_srli_epi16(_mm256_add_epi16(t, _mm256_srli_epi16(t, 8)), 8);
+			}
+
+
+			//!	@brief	AVX2 kernel: 8 pixels per iteration (unpack and pack work per 128-bit lane, so they cancel out).
+			EZWIN32_TARGET("avx2") static void blendAVX2(const ColorRGBA * src, ColorBGRA * dst, size_t count)
+			{
+				const __m256i swizzle = _mm256_setr_epi8(2, 1, 0, -1, 6, 5, 4, -1, 10, 9, 8, -1, 14, 13, 12, -1,
+														 2, 1, 0, -1, 6, 5, 4, -1, 10, 9, 8, -1, 14, 13, 12, -1);
+				const __m256i broadcast = _mm256_setr_epi8(3, 3, 3, 3, 7, 7, 7, 7, 11, 11, 11, 11, 15, 15, 15, 15,
+														   3, 3, 3, 3, 7, 7, 7, 7, 11, 11, 11, 11, 15, 15, 15, 15);
+				const __m256i opaque = _mm256_set1_epi32(static_cast<int>(0xFF000000));
+				const __m256i zero = _mm256_setzero_si256();
+
+				size_t i = 0;
+
+				for (; i + 8 <= count; i += 8)
+				{
+					__m256i s = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+					__m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));
+
+					__m256i a = _mm256_shuffle_epi8(s, broadcast);
+
+					s = _mm256_or_si256(_mm256_shuffle_epi8(s, swizzle), opaque);
+
+					__m256i lo = lerpAVX2(_mm256_unpacklo_epi8(s, zero), _mm256_unpacklo_epi8(d, zero), _mm256_unpacklo_epi8(a, zero));
+					__m256i hi = lerpAVX2(_mm256_unpackhi_epi8(s, zero), _mm256_unpackhi_epi8(d, zero), _mm256_unpackhi_epi8(a, zero));
+
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_packus_epi16(lo, hi));
+				}
+
+				blendScalar(src + i, dst + i, count - i);
+			}
+
+
+			//!	@brief	AVX2 kernel over an RGB image: 8 pixels per iteration, 4 RGB pixels per 128-bit lane.
+			EZWIN32_TARGET("avx2") static void blendAVX2(const ColorRGBA * src, ColorRGB * dst, size_t count)
+			{
+				const __m256i expand = _mm256_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1,
+														0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+				const __m256i compact = _mm256_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1,
+														 0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+				const __m256i broadcast = _mm256_setr_epi8(3, 3, 3, 3, 7, 7, 7, 7, 11, 11, 11, 11, 15, 15, 15, 15,
+														   3, 3, 3, 3, 7, 7, 7, 7, 11, 11, 11, 11, 15, 15, 15, 15);
+				const __m256i zero = _mm256_setzero_si256();
+
+				size_t i = 0;
+
+				for (; i + 8 <= count; i += 8)
+				{
+					__m256i s = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+					__m256i d = _mm256_inserti128_si256(_mm256_castsi128_si256(loadRGB4(dst + i)), loadRGB4(dst + i + 4), 1);
+
+					__m256i a = _mm256_shuffle_epi8(s, broadcast);
+
+					d = _mm256_shuffle_epi8(d, expand);
+
+					__m256i lo = lerpAVX2(_mm256_unpacklo_epi8(s, zero), _mm256_unpacklo_epi8(d, zero), _mm256_unpacklo_epi8(a, zero));
+					__m256i hi = lerpAVX2(_mm256_unpackhi_epi8(s, zero), _mm256_unpackhi_epi8(d, zero), _mm256_unpackhi_epi8(a, zero));
+
+					__m256i out = _mm256_shuffle_epi8(_mm256_packus_epi16(lo, hi), compact);
+
+					storeRGB4(dst + i, _mm256_castsi256_si128(out));
+					storeRGB4(dst + i + 4, _mm256_extracti128_si256(out, 1));
+				}
+
+				blendSSE41(src + i, dst + i, count - i);
+			}
+
+
+			//!	@brief	AVX2 kernel: 8 pixels gathered per iteration.
+			EZWIN32_TARGET("avx2") static void nearestAVX2(const ColorBGRA * src, const int * index, ColorBGRA * dst, size_t count)
+			{
+				size_t i = 0;
+
+				for (; i + 8 <= count; i += 8)
+				{
+					__m256i idx = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(index + i));
+
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_i32gather_epi32(reinterpret_cast<const int*>(src), idx, 4));
+				}
+
+				nearestScalar(src, index + i, dst + i, count - i);
+			}
+
+
+			/**
+			 *	@brief		SSE4.1 kernel: one pixel per iteration, both horizontal neighbours are read by a single 64-bit load.
+			 *	@note		Only valid while `index[i] + 1 < srcWidth`, the caller runs the scalar kernel on the rest of the row.
+			 */
+			EZWIN32_TARGET("sse4.1") static void bilinearSSE41(const ColorBGRA * row0, const ColorBGRA * row1, unsigned int fy, const int * index, const int * frac, ColorBGRA * dst, size_t count)
+			{
+				const __m128i wy0 = _mm_set1_epi16(static_cast<short>(256 - fy));
+				const __m128i wy1 = _mm_set1_epi16(static_cast<short>(fy));
+				const __m128i half = _mm_set1_epi16(128);
+
+				for (size_t i = 0; i < count; i++)
+				{
+					__m128i top = _mm_cvtepu8_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(row0 + index[i])));		// [L R] of row 0
+					__m128i bottom = _mm_cvtepu8_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(row1 + index[i])));	// [L R] of row 1
+
+					__m128i v = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(top, wy0), _mm_mullo_epi16(bottom, wy1)), half), 8);
+
+					const short w1 = static_cast<short>(frac[i]), w0 = static_cast<short>(256 - frac[i]);
+
+					__m128i m = _mm_mullo_epi16(v, _mm_setr_epi16(w0, w0, w0, w0, w1, w1, w1, w1));
+
+					__m128i h = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(m, _mm_srli_si128(m, 8)), half), 8);
+
+					const int pixel = _mm_cvtsi128_si32(_mm_packus_epi16(h, h));
+
+					std::memcpy(dst + i, &pixel, sizeof(pixel));
+				}
+			}
+
+
+			/**
+			 *	@brief		AVX2 kernel: two pixels per iteration, one per 128-bit lane.
+			 *	@note		Only valid while `index[i] + 1 < srcWidth`, the caller runs the scalar kernel on the rest of the row.
+			 */
+			EZWIN32_TARGET("avx2") static void bilinearAVX2(const ColorBGRA * row0, const ColorBGRA * row1, unsigned int fy, const int * index, const int * frac, ColorBGRA * dst, size_t count)
+			{
+				const __m256i wy0 = _mm256_set1_epi16(static_cast<short>(256 - fy));
+				const __m256i wy1 = _mm256_set1_epi16(static_cast<short>(fy));
+				const __m256i half = _mm256_set1_epi16(128);
+
+				size_t i = 0;
+
+				for (; i + 2 <= count; i += 2)
+				{
+					__m128i top = _mm_unpacklo_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(row0 + index[i])),
+													 _mm_loadl_epi64(reinterpret_cast<const __m128i*>(row0 + index[i + 1])));
+					__m128i bottom = _mm_unpacklo_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(row1 + index[i])),
+														_mm_loadl_epi64(reinterpret_cast<const __m128i*>(row1 + index[i + 1])));
+
+					__m256i v = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_cvtepu8_epi16(top), wy0), _mm256_mullo_epi16(_mm256_cvtepu8_epi16(bottom), wy1));
+
+					v = _mm256_srli_epi16(_mm256_add_epi16(v, half), 8);
+
+					const short a1 = static_cast<short>(frac[i]), a0 = static_cast<short>(256 - frac[i]);
+					const short b1 = static_cast<short>(frac[i + 1]), b0 = static_cast<short>(256 - frac[i + 1]);
+
+					__m256i m = _mm256_mullo_epi16(v, _mm256_setr_epi16(a0, a0, a0, a0, a1, a1, a1, a1, b0, b0, b0, b0, b1, b1, b1, b1));
+
+					__m256i h = _mm256_srli_epi16(_mm256_add_epi16(_mm256_add_epi16(m, _mm256_srli_si256(m, 8)), half), 8);
+
+					h = _mm256_packus_epi16(h, h);
+
+					const int pixels[2] = { _mm_cvtsi128_si32(_mm256_castsi256_si128(h)), _mm_cvtsi128_si32(_mm256_extracti128_si256(h, 1)) };
+
+					std::memcpy(dst + i, pixels, sizeof(pixels));
+				}
+
+				bilinearSSE41(row0, row1, fy, index + i, frac + i, dst + i, count - i);
+			}
+		#endif
+
+			/*************************************************************************
+			********************************    ARM64    *****************************
+			*************************************************************************/
+
+		#ifdef EZWIN32_ARCH_ARM64
+			static void fillNEON(ColorBGRA * dst, size_t count, ColorBGRA color)
+			{
+				uint32_t value = 0;		std::memcpy(&value, &color, sizeof(value));
+
+				const uint32x4_t v = vdupq_n_u32(value);
+
+				size_t i = 0;
+
+				for (; i + 4 <= count; i += 4)		vst1q_u32(reinterpret_cast<uint32_t*>(dst + i), v);
+
+				fillScalar(dst + i, count - i, color);
+			}
+
+
+			//!	@brief	`lerp` on 8 channel values.
+			static inline uint8x8_t lerpNEON(uint8x8_t s, uint8x8_t d, uint8x8_t a)
+			{
+				uint16x8_t t = vmlal_u8(vmull_u8(s, a), d, vsub_u8(vdup_n_u8(255), a));
+
+				t = vaddq_u16(t, vdupq_n_u16(128));
+
+				return vshrn_n_u16(vaddq_u16(t, vshrq_n_u16(t, 8)), 8);
+			}
+
+
+			//!	@brief	NEON kernel: 8 pixels per iteration, deinterleaved into planes by `vld4`.
+			static void blendNEON(const ColorRGBA * src, ColorBGRA * dst, size_t count)
+			{
+				size_t i = 0;
+
+				for (; i + 8 <= count; i += 8)
+				{
+					uint8x8x4_t s = vld4_u8(reinterpret_cast<const uint8_t*>(src + i));		// r, g, b, a
+					uint8x8x4_t d = vld4_u8(reinterpret_cast<const uint8_t*>(dst + i));		// b, g, r, a
+
+					uint8x8x4_t out;
+					out.val[0] = lerpNEON(s.val[2], d.val[0], s.val[3]);
+					out.val[1] = lerpNEON(s.val[1], d.val[1], s.val[3]);
+					out.val[2] = lerpNEON(s.val[0], d.val[2], s.val[3]);
+					out.val[3] = lerpNEON(vdup_n_u8(255), d.val[3], s.val[3]);
+
+					vst4_u8(reinterpret_cast<uint8_t*>(dst + i), out);
+				}
+
+				blendScalar(src + i, dst + i, count - i);
+			}
+
+
+			//!	@brief	NEON kernel over an RGB image: 8 pixels per iteration, deinterleaved by `vld4` and `vld3`.
+			static void blendNEON(const ColorRGBA * src, ColorRGB * dst, size_t count)
+			{
+				size_t i = 0;
+
+				for (; i + 8 <= count; i += 8)
+				{
+					uint8x8x4_t s = vld4_u8(reinterpret_cast<const uint8_t*>(src + i));		// r, g, b, a
+					uint8x8x3_t d = vld3_u8(reinterpret_cast<const uint8_t*>(dst + i));		// r, g, b
+
+					d.val[0] = lerpNEON(s.val[0], d.val[0], s.val[3]);
+					d.val[1] = lerpNEON(s.val[1], d.val[1], s.val[3]);
+					d.val[2] = lerpNEON(s.val[2], d.val[2], s.val[3]);
+
+					vst3_u8(reinterpret_cast<uint8_t*>(dst + i), d);
+				}
+
+				blendScalar(src + i, dst + i, count - i);
+			}
+
+
+			/**
+			 *	@brief		NEON kernel: one pixel per iteration, both horizontal neighbours are read by a single 64-bit load.
+			 *	@note		Only valid while `index[i] + 1 < srcWidth`, the caller runs the scalar kernel on the rest of the row.
+			 */
+			static void bilinearNEON(const ColorBGRA * row0, const ColorBGRA * row1, unsigned int fy, const int * index, const int * frac, ColorBGRA * dst, size_t count)
+			{
+				const uint16_t wy0 = static_cast<uint16_t>(256 - fy);
+				const uint16_t wy1 = static_cast<uint16_t>(fy);
+
+				for (size_t i = 0; i < count; i++)
+				{
+					uint16x8_t top = vmovl_u8(vld1_u8(reinterpret_cast<const uint8_t*>(row0 + index[i])));
+					uint16x8_t bottom = vmovl_u8(vld1_u8(reinterpret_cast<const uint8_t*>(row1 + index[i])));
+
+					uint16x8_t v = vshrq_n_u16(vaddq_u16(vmlaq_n_u16(vmulq_n_u16(top, wy0), bottom, wy1), vdupq_n_u16(128)), 8);
+
+					const uint16_t fx = static_cast<uint16_t>(frac[i]);
+
+					uint16x4_t h = vmla_n_u16(vmul_n_u16(vget_low_u16(v), static_cast<uint16_t>(256 - fx)), vget_high_u16(v), fx);
+
+					h = vshr_n_u16(vadd_u16(h, vdup_n_u16(128)), 8);
+
+					vst1_lane_u32(reinterpret_cast<uint32_t*>(dst + i), vreinterpret_u32_u8(vmovn_u16(vcombine_u16(h, h))), 0);
+				}
+			}
+		#endif
+
+			/*************************************************************************
+			*******************************    Dispatch    ***************************
+			*************************************************************************/
+
+			static void fillRow(ColorBGRA * dst, size_t count, ColorBGRA color)
+			{
+				switch (activeIsa().load(std::memory_order_relaxed))
+				{
+				#if defined(EZWIN32_ARCH_X86)
+					case Isa::AVX2:		fillAVX2(dst, count, color);		return;
+					case Isa::SSE41:	fillSSE41(dst, count, color);		return;
+				#elif defined(EZWIN32_ARCH_ARM64)
+					case Isa::NEON:		fillNEON(dst, count, color);		return;
+				#endif
+					default:			fillScalar(dst, count, color);		return;
+				}
+			}
+
+
+			static void blendRow(const ColorRGBA * src, ColorBGRA * dst, size_t count)
+			{
+				switch (activeIsa().load(std::memory_order_relaxed))
+				{
+				#if defined(EZWIN32_ARCH_X86)
+					case Isa::AVX2:		blendAVX2(src, dst, count);			return;
+					case Isa::SSE41:	blendSSE41(src, dst, count);		return;
+				#elif defined(EZWIN32_ARCH_ARM64)
+					case Isa::NEON:		blendNEON(src, dst, count);			return;
+				#endif
+					default:			blendScalar(src, dst, count);		return;
+				}
+			}
+
+
+			static void blendRow(const ColorRGBA * src, ColorRGB * dst, size_t count)
+			{
+				switch (activeIsa().load(std::memory_order_relaxed))
+				{
+				#if defined(EZWIN32_ARCH_X86)
+					case Isa::AVX2:		blendAVX2(src, dst, count);			return;
+					case Isa::SSE41:	blendSSE41(src, dst, count);		return;
+				#elif defined(EZWIN32_ARCH_ARM64)
+					case Isa::NEON:		blendNEON(src, dst, count);			return;
+				#endif
+					default:			blendScalar(src, dst, count);		return;
+				}
+			}
+
+
+			//!	@brief	Without gathers, SSE4.1 and NEON are not faster than the scalar table lookup.
+			static void nearestRow(const ColorBGRA * src, const int * index, ColorBGRA * dst, size_t count)
+			{
+			#if defined(EZWIN32_ARCH_X86)
+				if (activeIsa().load(std::memory_order_relaxed) == Isa::AVX2)
+				{
+					nearestAVX2(src, index, dst, count);
+
+					return;
+				}
+			#endif
+				nearestScalar(src, index, dst, count);
+			}
+
+
+			/**
+			 *	@brief		Bilinear row, `simdCount` leading pixels have both horizontal neighbours within the row.
+			 */
+			static void bilinearRow(const ColorBGRA * row0, const ColorBGRA * row1, unsigned int fy, const int * index, const int * frac, int srcWidth, ColorBGRA * dst, size_t count, size_t simdCount)
+			{
+				switch (activeIsa().load(std::memory_order_relaxed))
+				{
+				#if defined(EZWIN32_ARCH_X86)
+					case Isa::AVX2:		bilinearAVX2(row0, row1, fy, index, frac, dst, simdCount);		break;
+					case Isa::SSE41:	bilinearSSE41(row0, row1, fy, index, frac, dst, simdCount);		break;
+				#elif defined(EZWIN32_ARCH_ARM64)
+					case Isa::NEON:		bilinearNEON(row0, row1, fy, index, frac, dst, simdCount);		break;
+				#endif
+					default:			simdCount = 0;		break;
+				}
+
+				bilinearScalar(row0, row1, fy, index + simdCount, frac + simdCount, srcWidth, dst + simdCount, count - simdCount);
+			}
+
+
+			//!	@brief	Clips a `width` x `height` image placed at (`dstX`, `dstY`) to the framebuffer, returns `false` if nothing is left.
+			static bool clip(const Framebuffer & dst, int & dstX, int & dstY, int & srcX, int & srcY, int & width, int & height)
+			{
+				srcX = dstX < 0 ? -dstX : 0;
+				srcY = dstY < 0 ? -dstY : 0;
+
+				dstX += srcX;		width -= srcX;
+				dstY += srcY;		height -= srcY;
+
+				if (dstX + width > dst.getWidth())		width = dst.getWidth() - dstX;
+				if (dstY + height > dst.getHeight())	height = dst.getHeight() - dstY;
+
+				return dst.isValid() && (width > 0) && (height > 0);
+			}
+		}
+	}
+}
+
+
+//!	@brief	Whether the kernels can run with the given instruction set on this CPU.
+bool easywin32::PixelOps::isSupported(Isa isa)
+{
+	switch (isa)
+	{
+		case Isa::Scalar:	return true;
+	#if defined(EZWIN32_ARCH_X86)
+		case Isa::SSE41:	return easywin32::details::CpuFeatures::get().sse41;
+		case Isa::AVX2:		return easywin32::details::CpuFeatures::get().avx2;
+	#elif defined(EZWIN32_ARCH_ARM64)
+		case Isa::NEON:		return true;
+	#endif
+		default:			return false;
+	}
+}
+
+
+//!	@brief	Returns the instruction set currently used by the kernels.
+easywin32::PixelOps::Isa easywin32::PixelOps::getIsa()
+{
+	return details::activeIsa().load(std::memory_order_relaxed);
+}
+
+
+//!	@brief	Forces the instruction set used by the kernels.
+bool easywin32::PixelOps::setIsa(Isa isa)
+{
+	if (!PixelOps::isSupported(isa))
+		return false;
+
+	details::activeIsa().store(isa, std::memory_order_relaxed);
+
+	return true;
+}
+
+
+//!	@brief	Fills an image with a color.
+void easywin32::PixelOps::fill(ColorBGRA * dst, int width, int height, size_t dstPitch, ColorBGRA color)
+{
+	dstPitch = details::pitchOf<ColorBGRA>(dstPitch, width);
+
+	for (int y = 0; y < height; y++)
+	{
+		details::fillRow(details::rowOf(dst, dstPitch, y), static_cast<size_t>(width), color);
+	}
+}
+
+
+//!	@brief	Copies an image, `memcpy` is already vectorized by the C runtime.
+void easywin32::PixelOps::blit(const ColorBGRA * src, size_t srcPitch, ColorBGRA * dst, size_t dstPitch, int width, int height)
+{
+	srcPitch = details::pitchOf<ColorBGRA>(srcPitch, width);
+	dstPitch = details::pitchOf<ColorBGRA>(dstPitch, width);
+
+	for (int y = 0; y < height; y++)
+	{
+		std::memcpy(details::rowOf(dst, dstPitch, y), details::rowOf(src, srcPitch, y), static_cast<size_t>(width) * sizeof(ColorBGRA));
+	}
+}
+
+
+//!	@brief	Converts an RGB image to BGRX, row by row with `convertPixels`.
+void easywin32::PixelOps::convert(const ColorRGB * src, size_t srcPitch, ColorBGRA * dst, size_t dstPitch, int width, int height)
+{
+	srcPitch = details::pitchOf<ColorRGB>(srcPitch, width);
+	dstPitch = details::pitchOf<ColorBGRA>(dstPitch, width);
+
+	for (int y = 0; y < height; y++)
+	{
+		easywin32::convertPixels(details::rowOf(src, srcPitch, y), details::rowOf(dst, dstPitch, y), static_cast<size_t>(width));
+	}
+}
+
+
+//!	@brief	Composites a straight-alpha image over an image (source-over).
+void easywin32::PixelOps::blend(const ColorRGBA * src, size_t srcPitch, ColorBGRA * dst, size_t dstPitch, int width, int height)
+{
+	srcPitch = details::pitchOf<ColorRGBA>(srcPitch, width);
+	dstPitch = details::pitchOf<ColorBGRA>(dstPitch, width);
+
+	for (int y = 0; y < height; y++)
+	{
+		details::blendRow(details::rowOf(src, srcPitch, y), details::rowOf(dst, dstPitch, y), static_cast<size_t>(width));
+	}
+}
+
+
+//!	@brief	Composites a straight-alpha image over an RGB image (source-over).
+void easywin32::PixelOps::blend(const ColorRGBA * src, size_t srcPitch, ColorRGB * dst, size_t dstPitch, int width, int height)
+{
+	srcPitch = details::pitchOf<ColorRGBA>(srcPitch, width);
+	dstPitch = details::pitchOf<ColorRGB>(dstPitch, width);
+
+	for (int y = 0; y < height; y++)
+	{
+		details::blendRow(details::rowOf(src, srcPitch, y), details::rowOf(dst, dstPitch, y), static_cast<size_t>(width));
+	}
+}
+
+
+/**
+ *	@brief		Resamples an image to another extent.
+ *	@details	Source columns are computed once into a reused per-thread table, source rows per destination row.
+ */
+void easywin32::PixelOps::scale(const ColorBGRA * src, int srcWidth, int srcHeight, size_t srcPitch,
+								ColorBGRA * dst, int dstWidth, int dstHeight, size_t dstPitch, Filter filter)
+{
+	if ((srcWidth <= 0) || (srcHeight <= 0) || (dstWidth <= 0) || (dstHeight <= 0))
+		return;
+
+	srcPitch = details::pitchOf<ColorBGRA>(srcPitch, srcWidth);
+	dstPitch = details::pitchOf<ColorBGRA>(dstPitch, dstWidth);
+
+	thread_local std::vector<int> s_index, s_frac;
+
+	s_index.resize(static_cast<size_t>(dstWidth));
+	s_frac.resize(static_cast<size_t>(dstWidth));
+
+	if (filter == Filter::Nearest)
+	{
+		for (int x = 0; x < dstWidth; x++)
+		{
+			s_index[x] = static_cast<int>(((2LL * x + 1) * srcWidth) / (2LL * dstWidth));
+		}
+
+		for (int y = 0; y < dstHeight; y++)
+		{
+			const int sy = static_cast<int>(((2LL * y + 1) * srcHeight) / (2LL * dstHeight));
+
+			details::nearestRow(details::rowOf(src, srcPitch, sy), s_index.data(), details::rowOf(dst, dstPitch, y), static_cast<size_t>(dstWidth));
+		}
+	}
+	else
+	{
+		size_t simdCount = 0;		// The table is monotonic: leading pixels whose right neighbour is inside the row
+
+		for (int x = 0; x < dstWidth; x++)
+		{
+			details::sourcePos(x, srcWidth, dstWidth, s_index[x], s_frac[x]);
+
+			if (s_index[x] + 1 < srcWidth)		simdCount = static_cast<size_t>(x) + 1;
+		}
+
+		for (int y = 0; y < dstHeight; y++)
+		{
+			int sy = 0, fy = 0;
+
+			details::sourcePos(y, srcHeight, dstHeight, sy, fy);
+
+			const ColorBGRA * row0 = details::rowOf(src, srcPitch, sy);
+			const ColorBGRA * row1 = details::rowOf(src, srcPitch, sy + 1 < srcHeight ? sy + 1 : sy);
+
+			details::bilinearRow(row0, row1, static_cast<unsigned int>(fy), s_index.data(), s_frac.data(), srcWidth,
+								 details::rowOf(dst, dstPitch, y), static_cast<size_t>(dstWidth), simdCount);
+		}
+	}
+}
+
+
+//!	@brief	Fills the framebuffer with a color.
+void easywin32::PixelOps::fill(Framebuffer & dst, ColorBGRA color)
+{
+	if (dst.isValid())
+	{
+		PixelOps::fill(dst.getPixels(), dst.getWidth(), dst.getHeight(), dst.getPitch(), color);
+	}
+}
+
+
+//!	@brief	Copies an image into the framebuffer at the given position.
+void easywin32::PixelOps::blit(const ColorBGRA * src, int width, int height, size_t pitch, Framebuffer & dst, int dstX, int dstY)
+{
+	int srcX = 0, srcY = 0;
+
+	pitch = details::pitchOf<ColorBGRA>(pitch, width);
+
+	if (details::clip(dst, dstX, dstY, srcX, srcY, width, height))
+	{
+		PixelOps::blit(details::rowOf(src, pitch, srcY) + srcX, pitch, dst.getRow(dstY) + dstX, dst.getPitch(), width, height);
+	}
+}
+
+
+//!	@brief	Converts an RGB image into the framebuffer at the given position.
+void easywin32::PixelOps::convert(const ColorRGB * src, int width, int height, size_t pitch, Framebuffer & dst, int dstX, int dstY)
+{
+	int srcX = 0, srcY = 0;
+
+	pitch = details::pitchOf<ColorRGB>(pitch, width);
+
+	if (details::clip(dst, dstX, dstY, srcX, srcY, width, height))
+	{
+		PixelOps::convert(details::rowOf(src, pitch, srcY) + srcX, pitch, dst.getRow(dstY) + dstX, dst.getPitch(), width, height);
+	}
+}
+
+
+//!	@brief	Composites a straight-alpha image over the framebuffer at the given position.
+void easywin32::PixelOps::blend(const ColorRGBA * src, int width, int height, size_t pitch, Framebuffer & dst, int dstX, int dstY)
+{
+	int srcX = 0, srcY = 0;
+
+	pitch = details::pitchOf<ColorRGBA>(pitch, width);
+
+	if (details::clip(dst, dstX, dstY, srcX, srcY, width, height))
+	{
+		PixelOps::blend(details::rowOf(src, pitch, srcY) + srcX, pitch, dst.getRow(dstY) + dstX, dst.getPitch(), width, height);
+	}
+}
+
+
+//!	@brief	Resamples an image to fill the whole framebuffer.
+void easywin32::PixelOps::scale(const ColorBGRA * src, int width, int height, size_t pitch, Framebuffer & dst, Filter filter)
+{
+	if (dst.isValid())
+	{
+		PixelOps::scale(src, width, height, pitch, dst.getPixels(), dst.getWidth(), dst.getHeight(), dst.getPitch(), filter);
+	}
+}
+
+#endif
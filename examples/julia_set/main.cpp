@@ -20,8 +20,8 @@
  *	SOFTWARE.
  */
 
-#include <chrono>
-#include <vector>
+#include <atomic>
+#include <thread>
 #include <easywin32.h>
 
 /*********************************************************************************
@@ -43,7 +43,7 @@ Complex complex_sqr(Complex z)
 }
 
 
-void paint_kernel(EzColorRGB * pixels, int width, float invN, float t, int num)
+void paint_kernel(EzColorBGRA * pixels, int width, float invN, float t, int num)
 {
 #pragma omp parallel for
 	for (int tid = 0; tid < num; tid++)
@@ -70,7 +70,7 @@ void paint_kernel(EzColorRGB * pixels, int width, float invN, float t, int num)
 		float value = 1.0f - iterations * 0.02f;
 		unsigned char color255 = static_cast<unsigned char>(value * 255);
 
-		pixels[tid] = EzColorRGB{ color255, color255, color255 };
+		pixels[tid] = EzColorBGRA{ color255, color255, color255, 255 };
 	}
 }
 
@@ -80,20 +80,16 @@ int main()
 	const int n = 512;
 	const int width = n * 2;
 	const int height = n;
-	const size_t num_pixels = width * height;
-	std::vector<EzColorRGB>		pixels(num_pixels);
 
 	EzWindow window;
 	window.open("Julia Set", width, height);
 	window.centerToScreen();
 	window.show();
 
-	window.onPaint = [&]()
-	{
-		window.drawBitmap(pixels.data(), width, height);
-
-		return 0;
-	};
+	EzFrameQueue frameQueue;
+	std::atomic<bool> running = true;
+	std::atomic<int> targetWidth = width;
+	std::atomic<int> targetHeight = height;
 
 	window.onKeyboardPress = [&](EzKey key, EzKeyAction action)
 	{
@@ -105,40 +101,107 @@ int main()
 		return 0;
 	};
 
-	int i = 0;
-	int frames = 0;
-	using namespace std::chrono_literals;
-	auto t0 = std::chrono::steady_clock::now();
-	
-	while (window.isOpen())
+	window.onResize = [&](int w, int h)
+	{
+		targetWidth = w;
+		targetHeight = h;
+
+		return 0;
+	};
+
+	//	Signaled while the window can be seen: while it is minimized or the session is locked, the render thread sleeps instead of drawing.
+	HANDLE hVisible = ::CreateEvent(nullptr, TRUE, TRUE, nullptr);
+
+	window.onVisibilityChanged = [&](EzVisibility visibility)
 	{
-		window.processEvents();
+		if (visibility == EzVisibility::Visible)
+			::SetEvent(hVisible);
+		else
+			::ResetEvent(hVisible);
+	};
+
+	//	Render thread: keeps producing frames even while the UI thread is inside a modal move/resize loop.
+	std::thread renderThread([&]()
+	{
+		for (int i = 0; running; i++)
+		{
+			::WaitForSingleObject(hVisible, INFINITE);
+
+			float t = i * 0.03f;
+
+			int w = targetWidth;
+			int h = targetHeight;
+
+			if ((w <= 0) || (h <= 0))
+			{
+				std::this_thread::yield();
+
+				continue;
+			}
+
+			auto & frame = frameQueue.beginWrite();
 
-		////////////////////////////////////////////////////////////
+			frame.resize(w, h);
 
-		float t = (i++) * 0.03f;
+			paint_kernel(frame.pixels.data(), w, 1.0f / h, t, w * h);
 
-		paint_kernel(pixels.data(), width, 1.0f / height, t, num_pixels);
+			frameQueue.endWrite();
 
-		window.requestRedraw();
+			window.requestRedrawAsync();
+		}
+	});
+
+	uint64_t presentedIndex = 0;
+
+	//	UI thread: presents the latest completed frame.
+	window.onPaint = [&]()
+	{
+		if (auto frame = frameQueue.acquire())
+		{
+			window.drawBitmap(frame->pixels.data(), frame->width, frame->height, frame->getPitch());
+
+			presentedIndex = frame->index;
+		}
+		else
+		{
+			::ValidateRect(window.nativeHandle(), nullptr);
+		}
 
-		frames++;
+		return 0;
+	};
+
+	uint64_t lastIndex = 0;
+	double lastTime = 0.0;
 
-		auto t1 = std::chrono::steady_clock::now();
+	//	Keeps the frame loop (and the FPS in the title) ticking while the border or the caption is dragged.
+	window.enableLiveResize(true);
 
-		if (t1 - t0 > 0.5s)
+	//	Paced to the display refresh rate: the UI thread sleeps between frames instead of spinning.
+	window.runFrameLoop(0, [&](const EzFrameStats & stats)
+	{
+		if (stats.time - lastTime > 0.5)
 		{
-			int fps = int(frames * 1e9f / (t1 - t0).count());
+			int fps = int((presentedIndex - lastIndex) / (stats.time - lastTime));
 
 			std::string text = "Julia Set (" + std::to_string(fps) + " FPS)";
 
 			window.setTitle(text);
 
-			frames = 0;
+			lastIndex = presentedIndex;
 
-			t0 = t1;
+			lastTime = stats.time;
 		}
-	};
+
+		return true;
+	});
+
+	running = false;
+
+	::SetEvent(hVisible);
+
+	renderThread.join();
+
+	::CloseHandle(hVisible);
 
 	return 0;
 }
\ No newline at end of file
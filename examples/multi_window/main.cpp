@@ -28,22 +28,40 @@
 
 int main()
 {
-	EzWindow window0;
-	EzWindow window1;
-	EzWindow window2;
+	EzWindow windows[3];
 
-	window0.open("Window 0", 800, 600, EzStyle::OverlappedWindow | EzStyle::Visible);
-	window1.open("Window 1", 800, 600, EzStyle::OverlappedWindow | EzStyle::Visible);
-	window2.open("Window 2", 800, 600, EzStyle::OverlappedWindow | EzStyle::Visible);
+	const char * titles[3] = { "Window 0", "Window 1", "Window 2" };
 
-	window0.onHitTest = [](int x, int y) { return EzHitTestResult::Caption; };
-	window1.onHitTest = [](int x, int y) { return EzHitTestResult::Caption; };
-	window2.onHitTest = [](int x, int y) { return EzHitTestResult::Caption; };
+	//	Signaled by each window on close, its pool thread owns the window state
+	HANDLE hClosed[3] = {};
 
-	while (window0.isOpen() || window1.isOpen() || window2.isOpen())
+	for (auto & hEvent : hClosed)
 	{
-		EzThreadWindows::waitEvent();
-	};
+		hEvent = ::CreateEvent(nullptr, TRUE, FALSE, nullptr);
+	}
+
+	//	One UI thread per window: a slow callback in one window does not stall the others
+	EzWindowThreadPool pool(3);
+
+	for (int i = 0; i < 3; i++)
+	{
+		pool.invoke(i, [&, i]()
+		{
+			auto & window = windows[i];
+
+			window.setQuitOnClose(false);
+			window.open(titles[i], 800, 600, EzStyle::OverlappedWindow | EzStyle::Visible);
+			window.onHitTest = [](int x, int y) { return EzHitTestResult::Caption; };
+			window.onClose = [&, i]() { ::SetEvent(hClosed[i]);	return -1; };		// -1: closed by `DefWindowProc`
+		});
+	}
+
+	::WaitForMultipleObjects(3, hClosed, TRUE, INFINITE);
+
+	for (auto & hEvent : hClosed)
+	{
+		::CloseHandle(hEvent);
+	}
 
 	return 0;
 }
\ No newline at end of file
@@ -0,0 +1,142 @@
+/**
+ *	Copyright (c) 2025 Wenchao Huang <physhuangwenchao@gmail.com>
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include <memory>
+#include <functional>
+#include <easywin32.h>
+
+/*********************************************************************************
+*******************************    callbackTest    *******************************
+*********************************************************************************/
+
+/**
+ *	@brief		Checks the storage, copy and move semantics of `Callback<Signature>`.
+ *	@details	Covers both small callables (stored inline) and large ones (heap fallback),
+ *				and verifies that every stored callable is destroyed exactly once.
+ */
+void callbackTest()
+{
+	printf("=== Callback Test Start ===\n");
+
+	using IntCallback = easywin32::Callback<int(int)>;
+
+	static_assert(sizeof(IntCallback) <= 48, "Callback should stay smaller than std::function");
+
+	//	Empty
+	IntCallback empty;
+
+	assert(!empty);
+
+	empty = nullptr;
+
+	assert(!empty);
+
+	int (*nullFunction)(int) = nullptr;
+
+	assert(!IntCallback(nullFunction));
+
+	std::function<int(int)> emptyFunction;
+
+	assert(!IntCallback(emptyFunction));
+
+	IntCallback reassigned = [](int x) { return x; };
+
+	reassigned = emptyFunction;
+
+	assert(!reassigned);
+
+	reassigned = [](int x) { return x; };
+
+	reassigned = nullFunction;
+
+	assert(!reassigned);
+
+	assert(IntCallback(std::function<int(int)>([](int x) { return x + 1; }))(1) == 2);
+
+	//	Inline storage, state is kept between calls
+	int counter = 0;
+
+	IntCallback small = [&counter](int x) { return counter += x; };
+
+	assert(small && (small(2) == 2) && (small(3) == 5));
+
+	//	Heap storage (capture larger than the inline buffer)
+	struct Large { int values[16]; };
+
+	Large large = {};
+
+	large.values[15] = 7;
+
+	IntCallback big = [large](int x) { return large.values[15] * x; };
+
+	assert(big(3) == 21);
+
+	//	Copies are independent, moves leave the source empty
+	IntCallback bigCopy = big;
+
+	IntCallback bigMoved = std::move(big);
+
+	assert(!big && (bigCopy(2) == 14) && (bigMoved(1) == 7));
+
+	IntCallback smallCopy;
+
+	smallCopy = small;
+
+	assert(smallCopy(1) == 6);
+
+	//	Function pointers and return type conversion
+	IntCallback pointer = +[](int x) { return x * x; };
+
+	assert(pointer(3) == 9);
+
+	easywin32::Callback<EzResult(int)> function = [](int x) { return x * 2; };
+
+	assert(function(4) == 8);
+
+	easywin32::Callback<void()> task = []() { return 1; };
+
+	task();
+
+	//	Lifetime: every copy of the captured object is released
+	auto token = std::make_shared<int>(0);
+
+	{
+		easywin32::Callback<void()> a = [token]() { (*token)++; };
+
+		easywin32::Callback<void()> b = a;
+
+		easywin32::Callback<void()> c = std::move(a);
+
+		b();	c();
+
+		assert(token.use_count() == 3);
+
+		c = nullptr;
+
+		assert(token.use_count() == 2);
+	}
+
+	assert((token.use_count() == 1) && (*token == 2));
+
+	printf("All assertions passed!\n");
+	printf("==== Callback Test End ====\n\n");
+}
@@ -0,0 +1,142 @@
+/**
+ *	Copyright (c) 2025 Wenchao Huang <physhuangwenchao@gmail.com>
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include <easywin32.h>
+
+/*********************************************************************************
+****************************    eventRecorderTest    *****************************
+*********************************************************************************/
+
+/**
+ *	@brief		Checks the ring buffer of `EventRecorder` and the replay of recorded messages.
+ */
+void eventRecorderTest(EzWindow & window)
+{
+	printf("=== Event Recorder Test Start ===\n");
+
+	//	Ring buffer: only the last `capacity()` events are kept
+	EzEventRecorder ring(5);
+
+	assert(ring.capacity() == 8);
+
+	for (int i = 0; i < 20; i++)
+	{
+		ring.record(WM_KEYDOWN, 'A' + i, 0);
+	}
+
+	assert((ring.size() == 8) && (ring.getDroppedCount() == 12));
+
+	for (size_t i = 0; i < ring.size(); i++)
+	{
+		assert(ring[i].key() == static_cast<EzKey>('A' + 12 + i));
+
+		assert((i == 0) || (ring[i].time >= ring[i - 1].time));
+	}
+
+	//	Decoding
+	ring.clear();
+
+	ring.record(WM_XBUTTONDBLCLK, MAKEWPARAM(MK_XBUTTON2 | MK_SHIFT, XBUTTON2), MAKELPARAM(-3, 40));
+
+	ring.record(WM_SYSKEYUP, 'F', 0);
+
+	assert(ring[0].isMouse() && !ring[0].isKey());
+	assert(ring[0].mouseButton() == EzMouseButton::XButton2);
+	assert(ring[0].mouseAction() == EzMouseAction::DoubleClick);
+	assert(ring[0].mouseState().has(EzMouseState::XButton2 | EzMouseState::Shift) && !ring[0].mouseState().has(EzMouseState::Left));
+	assert((ring[0].mousePos().x == -3) && (ring[0].mousePos().y == 40));
+	assert(ring[1].isKey() && (ring[1].key() == EzKey::F) && (ring[1].keyAction() == EzKeyAction::Release));
+
+	//	Live recording, then replay through the same callbacks
+	EzEventRecorder recorder;
+
+	int numKeys = 0;
+
+	window.onKeyboardPress = [&](EzKey key, EzKeyAction action)
+	{
+		assert((key == EzKey::Space) && (action == EzKeyAction::Press));
+
+		numKeys++;
+
+		return 0;
+	};
+
+	window.setRecorder(&recorder);
+
+	for (int i = 0; i < 3; i++)
+	{
+		::SendMessage(window.nativeHandle(), WM_KEYDOWN, VK_SPACE, 0);
+
+		::SendMessage(window.nativeHandle(), WM_NCHITTEST, 0, 0);		// Not recorded
+	}
+
+	window.setRecorder(nullptr);
+
+	for (size_t i = 0; i < recorder.size(); i++)
+	{
+		assert(EzEventRecorder::isRecorded(recorder[i].message));
+	}
+
+	//	Messages acting on the live window are not replayed, even when loaded from a file
+	const EzEvent timer = { 0, WM_TIMER, 1, 0 };
+
+	assert(window.replay(&timer, 1) == 0);
+
+	assert((numKeys == 3) && (recorder.size() >= 3));
+
+	size_t numReplayed = window.replay(recorder);
+
+	assert((numReplayed == recorder.size()) && (numKeys == 6));
+
+	//	Save / load round trip
+	assert(recorder.save(TEXT("events.bin")));
+
+	EzEventRecorder loaded(1);
+
+	assert(loaded.load(TEXT("events.bin")) && (loaded.size() == recorder.size()));
+
+	assert((loaded[0].message == recorder[0].message) && (loaded[0].time == recorder[0].time));
+
+	//	A header claiming more events than the file holds is rejected (count is at offset 16)
+	{
+		HANDLE hFile = ::CreateFile(TEXT("events.bin"), GENERIC_WRITE, 0, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+		assert(hFile != INVALID_HANDLE_VALUE);
+
+		const uint64_t bogusCount = ~0ull;
+
+		DWORD bytes = 0;
+
+		assert((::SetFilePointer(hFile, 16, nullptr, FILE_BEGIN) == 16) && ::WriteFile(hFile, &bogusCount, sizeof(bogusCount), &bytes, nullptr));
+
+		::CloseHandle(hFile);
+	}
+
+	assert(!loaded.load(TEXT("events.bin")) && (loaded.size() == recorder.size()));
+
+	::DeleteFile(TEXT("events.bin"));
+
+	window.onKeyboardPress = nullptr;
+
+	printf("All assertions passed!\n");
+	printf("==== Event Recorder Test End ====\n\n");
+}
@@ -0,0 +1,143 @@
+/**
+ *	Copyright (c) 2025 Wenchao Huang <physhuangwenchao@gmail.com>
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include <chrono>
+#include <thread>
+#include <easywin32.h>
+
+/*********************************************************************************
+*****************************    frameCaptureTest    *****************************
+*********************************************************************************/
+
+//!	@brief	Checks that frames arrive in order, untorn, on the encoder thread.
+struct CheckingEncoder : public EzFrameEncoder
+{
+	std::thread::id		producerId = std::this_thread::get_id();
+	uint64_t			lastIndex = 0;
+	uint64_t			numEncoded = 0;
+	bool				finished = false;
+
+	void encode(const EzFrameQueue::Frame & frame) override
+	{
+		assert(std::this_thread::get_id() != producerId);
+
+		assert(frame.index > lastIndex);
+
+		for (int k = 0; k < frame.width * frame.height; k++)
+		{
+			assert(frame.pixels[k].b == uint8_t(frame.index - 1));
+		}
+
+		lastIndex = frame.index;
+
+		numEncoded++;
+	}
+
+	void finish() override { finished = true; }
+};
+
+
+/**
+ *	@brief		Captures frames faster than the encoder can process them, then from the window present path.
+ *	@details	Every pixel of a frame is filled with its capture index, so a slot overwritten while
+ *				the encoder reads it would show up as mixed values.
+ */
+void frameCaptureTest()
+{
+	printf("=== Frame Capture Test Start ===\n");
+
+	std::vector<EzColorBGRA> pixels(64 * 32);
+
+	// Standalone, the producer never waits for the encoder
+	{
+		EzFrameCapture capture(4);
+
+		struct SlowEncoder : public CheckingEncoder
+		{
+			void encode(const EzFrameQueue::Frame & frame) override
+			{
+				CheckingEncoder::encode(frame);
+
+				std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			}
+		} encoder;
+
+		assert(!capture.capture(pixels.data(), 64, 32));		// Not running
+
+		assert(capture.start(&encoder));
+		assert(!capture.start(&encoder));
+
+		uint64_t numQueued = 0;
+
+		for (int i = 0; i < 1000; i++)
+		{
+			std::fill(pixels.begin(), pixels.end(), EzColorBGRA{ uint8_t(capture.getCapturedCount()), 0, 0, 255 });
+
+			numQueued += capture.capture(pixels.data(), 64, 32) ? 1 : 0;
+		}
+
+		capture.stop();
+
+		assert(encoder.finished);
+		assert(!capture.isRunning());
+		assert(capture.getDroppedCount() > 0);
+		assert(capture.getCapturedCount() == numQueued);
+		assert(capture.getCapturedCount() + capture.getDroppedCount() == 1000);
+		assert(encoder.numEncoded == numQueued);
+	}
+
+	// Attached to a window framebuffer
+	{
+		EzWindow window;
+		window.setQuitOnClose(false);
+		window.open("EasyWin32-Capture", 64, 32);
+		window.enableFramebuffer(true);
+
+		EzFrameCapture capture;
+		CheckingEncoder encoder;
+
+		capture.start(&encoder);
+
+		window.setFrameCapture(&capture);
+
+		for (int i = 0; i < 3; i++)
+		{
+			auto & framebuffer = window.getFramebuffer();
+
+			std::fill(framebuffer.getPixels(), framebuffer.getPixels() + framebuffer.getWidth() * framebuffer.getHeight(), EzColorBGRA{ uint8_t(i), 0, 0, 255 });
+
+			window.presentFramebuffer();		// The next frame overwrites the framebuffer, not the captured copy
+		}
+
+		window.setFrameCapture(nullptr);
+
+		window.presentFramebuffer();		// Detached: not captured
+
+		capture.stop();
+
+		assert(capture.getCapturedCount() == 3);
+		assert(encoder.numEncoded == 3);
+	}
+
+	printf("All assertions passed!\n");
+	printf("==== Frame Capture Test End ====\n\n");
+}
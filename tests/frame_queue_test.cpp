@@ -0,0 +1,92 @@
+/**
+ *	Copyright (c) 2025 Wenchao Huang <physhuangwenchao@gmail.com>
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include <thread>
+#include <easywin32.h>
+
+/*********************************************************************************
+******************************    frameQueueTest    ******************************
+*********************************************************************************/
+
+/**
+ *	@brief		Runs a producer thread against the consumer and checks frame ordering and integrity.
+ *	@details	Every pixel of a frame is filled with its sequence number, so a frame torn by a
+ *				concurrent write would show up as mixed values.
+ */
+void frameQueueTest()
+{
+	printf("=== Frame Queue Test Start ===\n");
+
+	EzFrameQueue queue;
+
+	assert(queue.acquire() == nullptr);
+
+	const uint32_t frameCount = 20000;
+
+	std::thread producer([&]()
+	{
+		for (uint32_t i = 1; i <= frameCount; i++)
+		{
+			auto & frame = queue.beginWrite();
+
+			frame.resize(8 + i % 8, 4);
+
+			for (int k = 0; k < frame.width * frame.height; k++)
+			{
+				frame.pixels[k] = EzColorBGRA{ uint8_t(i), uint8_t(i >> 8), uint8_t(i >> 16), 255 };
+			}
+
+			queue.endWrite();
+		}
+	});
+
+	uint64_t last = 0;
+
+	while (last < frameCount)
+	{
+		const EzFrameQueue::Frame * frame = queue.acquire();
+
+		if (frame == nullptr)		continue;
+
+		assert(frame->index >= last);
+
+		assert(frame->width == 8 + int(frame->index % 8));
+
+		for (int k = 0; k < frame->width * frame->height; k++)
+		{
+			const EzColorBGRA & c = frame->pixels[k];
+
+			assert(uint64_t(c.b | (c.g << 8) | (c.r << 16)) == frame->index);
+		}
+
+		last = frame->index;
+	}
+
+	producer.join();
+
+	assert(!queue.hasNewFrame());
+
+	assert(queue.acquire()->index == frameCount);
+
+	printf("All assertions passed!\n");
+	printf("==== Frame Queue Test End ====\n\n");
+}
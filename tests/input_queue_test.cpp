@@ -0,0 +1,112 @@
+/**
+ *	Copyright (c) 2025 Wenchao Huang <physhuangwenchao@gmail.com>
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include <easywin32.h>
+
+/*********************************************************************************
+******************************    inputQueueTest    ******************************
+*********************************************************************************/
+
+/**
+ *	@brief		Sends key and mouse messages to a window with an input queue, then polls it.
+ *	@details	Checks the order of the events, the state snapshot, overflow and focus loss.
+ */
+void inputQueueTest()
+{
+	printf("=== Input Queue Test Start ===\n");
+
+	EzWindow window;
+	window.setQuitOnClose(false);
+	window.open("EasyWin32-Input", 200, 100);
+
+	EzInputQueue queue(4);
+
+	window.setInputQueue(&queue);
+
+	HWND hWnd = window.nativeHandle();
+
+	::SendMessage(hWnd, WM_KEYDOWN, 'A', 0);
+	::SendMessage(hWnd, WM_CHAR, 'a', 0);					// Ignored
+	::SendMessage(hWnd, WM_KEYDOWN, VK_SHIFT, 0);
+	::SendMessage(hWnd, WM_MOUSEMOVE, MK_LBUTTON | MK_SHIFT, MAKELPARAM(10, 20));
+
+	EzInputQueue::Span events = queue.poll();
+
+	assert(events.size == 3);
+	assert(events[0].key() == EzKey::A && events[0].keyAction() == EzKeyAction::Press);
+	assert(events[1].key() == EzKey::Shift);
+	assert(events[2].isMouse() && (events[2].mousePos().x == 10) && (events[2].mousePos().y == 20));
+	assert((events[0].time <= events[1].time) && (events[1].time <= events[2].time));
+
+	const EzInputState & state = queue.getState();
+
+	assert(state.isKeyDown(EzKey::A));
+	assert(state.isKeyDown(EzKey::Shift));
+	assert(!state.isKeyDown(EzKey::B));
+	assert(state.mouseState.has(EzMouseState::Left | EzMouseState::Shift));
+	assert((state.mousePos.x == 10) && (state.mousePos.y == 20));
+
+	// State changes are only visible after the next poll
+	::SendMessage(hWnd, WM_KEYUP, 'A', (LPARAM)0xC0000001);
+
+	assert(state.isKeyDown(EzKey::A));
+
+	events = queue.poll();
+
+	assert(events.size == 1 && events[0].keyAction() == EzKeyAction::Release);
+	assert(!state.isKeyDown(EzKey::A));
+
+	// Overflow drops the newest events, but keeps the state up to date
+	for (int i = 0; i < 6; i++)
+	{
+		::SendMessage(hWnd, WM_MOUSEMOVE, 0, MAKELPARAM(i, i));
+	}
+
+	events = queue.poll();
+
+	assert(events.size == queue.capacity());
+	assert(queue.getDroppedCount() == 2);
+	assert(events[3].mousePos().x == 3);
+	assert(state.mousePos.x == 5);
+
+	// Releases are not received once the focus is lost
+	::SendMessage(hWnd, WM_KEYDOWN, 'B', 0);
+	::SendMessage(hWnd, WM_KILLFOCUS, 0, 0);
+
+	events = queue.poll();
+
+	assert(events.size == 1);
+	assert(!state.isKeyDown(EzKey::B));
+	assert(!state.isKeyDown(EzKey::Shift));
+	assert(state.mouseState.none());
+
+	window.setInputQueue(nullptr);
+
+	::SendMessage(hWnd, WM_KEYDOWN, 'C', 0);
+
+	assert(queue.poll().empty());
+
+	window.close();
+
+	printf("All assertions passed!\n");
+	printf("==== Input Queue Test End ====\n\n");
+}
@@ -0,0 +1,90 @@
+/**
+ *	Copyright (c) 2025 Wenchao Huang <physhuangwenchao@gmail.com>
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include <easywin32.h>
+
+/*********************************************************************************
+********************************    layoutTest    ********************************
+*********************************************************************************/
+
+/**
+ *	@brief		Moves, resizes and restyles two windows in a (nested) layout transaction.
+ *	@details	Checks that nothing changes before the outermost `commitLayout`, and that the client
+ *				rectangles requested last are applied afterwards.
+ */
+void layoutTest()
+{
+	printf("=== Layout Test Start ===\n");
+
+	EzWindow windows[2];
+
+	windows[0].setQuitOnClose(false);
+	windows[1].setQuitOnClose(false);
+
+	windows[0].open("EasyWin32-Layout", EzRect{ 100, 100, 420, 340 });
+	windows[1].open("EasyWin32-Layout", EzRect{ 500, 100, 820, 340 });
+
+	const EzPoint pos0 = windows[0].getClientPos();
+
+	EzThreadWindows::beginLayout();
+	{
+		windows[0].setPos(150, 120);
+		windows[0].setPos(160, 130, 560, 430);		// Overrides the pending move, adds a resize
+		windows[1].setPos(600, 200, 840, 380);
+
+		EzThreadWindows::beginLayout();
+		{
+			windows[1].setStyle(EzStyle::HeaderlessWindow);
+		}
+		assert(EzThreadWindows::commitLayout());
+
+		// Still pending: only the outermost commit applies the batch
+		assert(windows[0].getClientPos().x == pos0.x);
+		assert(windows[0].getClientPos().y == pos0.y);
+	}
+	EzThreadWindows::commitLayout();
+
+	assert(windows[0].getClientPos().x == 160);
+	assert(windows[0].getClientPos().y == 130);
+	assert(windows[0].getClientExtent().cx == 400);
+	assert(windows[0].getClientExtent().cy == 300);
+
+	assert(windows[1].getClientPos().x == 600);
+	assert(windows[1].getClientPos().y == 200);
+	assert(windows[1].getClientExtent().cx == 240);
+	assert(windows[1].getClientExtent().cy == 180);
+
+	assert(!windows[1].getStyleFlags().has(EzStyle::Caption));
+
+	// Outside of a transaction, changes are applied at once
+	windows[0].setPos(200, 200);
+
+	assert(windows[0].getClientPos().x == 200);
+
+	windows[0].close();
+	windows[1].close();
+
+	EzThreadWindows::processEvents();
+
+	printf("All assertions passed!\n");
+	printf("==== Layout Test End ====\n\n");
+}
@@ -30,6 +30,24 @@
 *********************************************************************************/
 
 extern void flagsTest();
+extern void callbackTest();
+extern void pixelFormatTest();
+extern void pixelOpsTest();
+extern void swapChainTest();
+extern void frameQueueTest();
+extern void frameCaptureTest();
+extern void sharedFramebufferTest();
+extern void waitEventsTest();
+extern void preciseTimerTest();
+extern void windowThreadPoolTest();
+extern void layoutTest();
+extern void windowStateTest();
+extern void visibilityTest();
+extern void windowPoolTest();
+extern void inputQueueTest();
+extern void postTest(EzWindow & window);
+extern void eventRecorderTest(EzWindow & window);
+extern void profilerTest(EzWindow & window);
 extern void mouseEventTest(EzWindow & window);
 extern void keyboardEventTest(EzWindow & window);
 
@@ -60,6 +78,17 @@ int main()
 		return -1;
 	};
 
+	//	Allocation-free variant, replaces `onDropFiles` while set
+	window.onDropPaths = [](const easywin32::string_view_type * filePaths, size_t count)
+	{
+		for (size_t i = 0; i < count; i++)
+		{
+			printf("Drop file[%zu]: %s\n", i, filePaths[i].data());
+		}
+
+		return -1;
+	};
+
 	auto t0 = std::chrono::steady_clock::now();
 
 	window.onTimer = [&](UINT_PTR id)
@@ -74,6 +103,24 @@ int main()
 	window.setTimer(0, 1000);
 
 	flagsTest();
+	callbackTest();
+	pixelFormatTest();
+	pixelOpsTest();
+	swapChainTest();
+	frameQueueTest();
+	frameCaptureTest();
+	sharedFramebufferTest();
+	waitEventsTest();
+	preciseTimerTest();
+	windowThreadPoolTest();
+	layoutTest();
+	windowStateTest();
+	visibilityTest();
+	windowPoolTest();
+	inputQueueTest();
+	postTest(window);
+	eventRecorderTest(window);
+	profilerTest(window);
 	mouseEventTest(window);
 	keyboardEventTest(window);
 
@@ -61,6 +61,38 @@ void mouseEventTest(EzWindow & window)
 		return 0;
 	};
 
+	// Raw mouse callback: accumulates unaccelerated motion, printed on each button transition
+	long long rawX = 0, rawY = 0;
+
+	window.onRawMouse = [&](int dx, int dy, EzFlags<EzRawMouseButton> buttonFlags)
+	{
+		rawX += dx;		rawY += dy;
+
+		if (buttonFlags)
+		{
+			printf("Raw mouse: %s, accumulated motion { %lld, %lld }.\n", easywin32::to_string(buttonFlags).c_str(), rawX, rawY);
+		}
+	};
+
+	window.enableRawInput(true, false);
+
+	//	Registrations are counted per process: closing another registered window gives the input back to this one
+	{
+		EzWindow other;
+		other.setQuitOnClose(false);
+		other.open("EasyWin32-RawInput", 160, 120);
+		other.enableRawInput(true, false);
+		other.close();
+
+		RAWINPUTDEVICE devices[4] = {};
+
+		UINT numDevices = 4;
+
+		numDevices = ::GetRegisteredRawInputDevices(devices, &numDevices, sizeof(RAWINPUTDEVICE));
+
+		assert((numDevices == 1) && (devices[0].hwndTarget == window.nativeHandle()));
+	}
+
 	// Keyboard callback: waits for Escape key to end the test
 	window.onKeyboardPress = [&](EzKey key, EzKeyAction action)
 	{
@@ -82,6 +114,8 @@ void mouseEventTest(EzWindow & window)
 	printf("Mouse event test finished.\n\n");
 
 	// Cleanup callbacks
+	window.enableRawInput(false, false);
+	window.onRawMouse = nullptr;
 	window.onKeyboardPress = nullptr;
 	window.onWheelScroll = nullptr;
 	window.onMouseClick = nullptr;
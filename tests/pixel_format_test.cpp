@@ -0,0 +1,87 @@
+/**
+ *	Copyright (c) 2025 Wenchao Huang <physhuangwenchao@gmail.com>
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include <vector>
+#include <easywin32.h>
+
+/*********************************************************************************
+*****************************    pixelFormatTest    ******************************
+*********************************************************************************/
+
+/**
+ *	@brief		Checks `convertPixels` against the expected RGB -> BGRX mapping, and `premultiplyPixels` against exact rounding.
+ *	@details	Covers every length up to a few SIMD blocks so that both the vector body
+ *				and the scalar tail are exercised, whichever kernel the CPU selects.
+ */
+void pixelFormatTest()
+{
+	printf("=== Pixel Format Test Start ===\n");
+
+	for (size_t count = 0; count < 100; count++)
+	{
+		std::vector<EzColorRGB> src(count);
+		std::vector<EzColorBGRA> dst(count + 1, EzColorBGRA{ 1, 2, 3, 4 });
+
+		for (size_t i = 0; i < count; i++)
+		{
+			src[i] = EzColorRGB{ uint8_t(i * 3 + 0), uint8_t(i * 3 + 1), uint8_t(i * 3 + 2) };
+		}
+
+		easywin32::convertPixels(src.data(), dst.data(), count);
+
+		for (size_t i = 0; i < count; i++)
+		{
+			assert(dst[i].r == src[i].r);
+			assert(dst[i].g == src[i].g);
+			assert(dst[i].b == src[i].b);
+			assert(dst[i].a == 255);
+		}
+
+		// Must not write past the end
+		assert((dst[count].b == 1) && (dst[count].g == 2) && (dst[count].r == 3) && (dst[count].a == 4));
+	}
+
+	// Premultiplication must round `c * a / 255` to nearest for every channel / alpha pair
+	for (int a = 0; a < 256; a++)
+	{
+		std::vector<EzColorRGBA> src(256);
+		std::vector<EzColorBGRA> dst(256);
+
+		for (int c = 0; c < 256; c++)
+		{
+			src[c] = EzColorRGBA{ { uint8_t(c), uint8_t(255 - c), uint8_t(c) }, uint8_t(a) };
+		}
+
+		easywin32::premultiplyPixels(src.data(), dst.data(), src.size());
+
+		for (int c = 0; c < 256; c++)
+		{
+			assert(dst[c].r == (c * a * 2 + 255) / 510);
+			assert(dst[c].g == ((255 - c) * a * 2 + 255) / 510);
+			assert(dst[c].b == dst[c].r);
+			assert(dst[c].a == a);
+		}
+	}
+
+	printf("All assertions passed!\n");
+	printf("==== Pixel Format Test End ====\n\n");
+}
@@ -0,0 +1,190 @@
+/**
+ *	Copyright (c) 2025 Wenchao Huang <physhuangwenchao@gmail.com>
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include <vector>
+#include <cstring>
+#include <easywin32_pixelops.h>
+
+/*********************************************************************************
+******************************    pixelOpsTest    ********************************
+*********************************************************************************/
+
+//!	@brief	Deterministic pseudo-random bytes (LCG), so every instruction set sees the same inputs.
+static uint8_t nextByte(uint32_t & state)
+{
+	state = state * 1664525u + 1013904223u;
+
+	return static_cast<uint8_t>(state >> 24);
+}
+
+
+//!	@brief	Runs every kernel with the given instruction set and returns all the outputs, one after the other.
+static std::vector<EzColorBGRA> runKernels(EzPixelOps::Isa isa)
+{
+	EzPixelOps::setIsa(isa);
+
+	uint32_t state = 12345;
+
+	const int width = 37, height = 11;		// Odd extents exercise the scalar tails of every kernel
+
+	std::vector<EzColorRGBA> sprite(static_cast<size_t>(width) * height);
+	std::vector<EzColorBGRA> image(static_cast<size_t>(width) * height);
+
+	for (size_t i = 0; i < sprite.size(); i++)
+	{
+		sprite[i] = EzColorRGBA{ { nextByte(state), nextByte(state), nextByte(state) }, nextByte(state) };
+		image[i] = EzColorBGRA{ nextByte(state), nextByte(state), nextByte(state), nextByte(state) };
+	}
+
+	std::vector<EzColorBGRA> result;
+
+	// Blend over the image
+	std::vector<EzColorBGRA> blended = image;
+
+	EzPixelOps::blend(sprite.data(), 0, blended.data(), 0, width, height);
+
+	result.insert(result.end(), blended.begin(), blended.end());
+
+	// Blend over an RGB image (widened to BGRA to share the comparison)
+	std::vector<EzColorRGB> rgb(image.size());
+
+	for (size_t i = 0; i < rgb.size(); i++)		rgb[i] = EzColorRGB{ image[i].r, image[i].g, image[i].b };
+
+	EzPixelOps::blend(sprite.data(), 0, rgb.data(), 0, width, height);
+
+	for (const EzColorRGB & pixel : rgb)		result.push_back(EzColorBGRA{ pixel.b, pixel.g, pixel.r, 0 });
+
+	// Fill with a padded pitch
+	std::vector<EzColorBGRA> filled(static_cast<size_t>(width + 3) * height, EzColorBGRA{ 1, 2, 3, 4 });
+
+	EzPixelOps::fill(filled.data(), width, height, (width + 3) * sizeof(EzColorBGRA), EzColorBGRA{ 10, 20, 30, 40 });
+
+	result.insert(result.end(), filled.begin(), filled.end());
+
+	// Scaling up and down, both filters
+	const EzSize extents[] = { { 101, 29 }, { 13, 5 }, { width, height }, { 1, 1 } };
+
+	for (const EzSize & extent : extents)
+	{
+		for (auto filter : { EzPixelOps::Filter::Nearest, EzPixelOps::Filter::Bilinear })
+		{
+			std::vector<EzColorBGRA> scaled(static_cast<size_t>(extent.cx) * extent.cy);
+
+			EzPixelOps::scale(image.data(), width, height, 0, scaled.data(), extent.cx, extent.cy, 0, filter);
+
+			result.insert(result.end(), scaled.begin(), scaled.end());
+		}
+	}
+
+	EzPixelOps::setIsa(EzPixelOps::Isa::Scalar);
+
+	return result;
+}
+
+
+/**
+ *	@brief		Checks the pixel kernels against exact expectations with the scalar code, then checks that
+ *				every instruction set supported by the CPU produces bit-identical results.
+ */
+void pixelOpsTest()
+{
+	printf("=== Pixel Ops Test Start ===\n");
+
+	const auto defaultIsa = EzPixelOps::getIsa();
+
+	printf("Default instruction set: %s.\n", EzPixelOps::to_string(defaultIsa));
+
+	assert(EzPixelOps::isSupported(defaultIsa));
+	assert(EzPixelOps::setIsa(EzPixelOps::Isa::Scalar));
+
+	// Transparent pixels keep the destination, opaque pixels replace it
+	{
+		const EzColorRGBA sprite[2] = { { { 10, 20, 30 }, 0 }, { { 10, 20, 30 }, 255 } };
+
+		EzColorBGRA image[2] = { { 1, 2, 3, 255 }, { 1, 2, 3, 0 } };
+
+		EzPixelOps::blend(sprite, 0, image, 0, 2, 1);
+
+		assert((image[0].b == 1) && (image[0].g == 2) && (image[0].r == 3) && (image[0].a == 255));
+		assert((image[1].b == 30) && (image[1].g == 20) && (image[1].r == 10) && (image[1].a == 255));
+	}
+
+	// Scaling to the same extent is a copy, whatever the filter
+	{
+		uint32_t state = 1;
+
+		std::vector<EzColorBGRA> src(7 * 5), dst(7 * 5);
+
+		for (auto & pixel : src)	pixel = EzColorBGRA{ nextByte(state), nextByte(state), nextByte(state), nextByte(state) };
+
+		for (auto filter : { EzPixelOps::Filter::Nearest, EzPixelOps::Filter::Bilinear })
+		{
+			EzPixelOps::scale(src.data(), 7, 5, 0, dst.data(), 7, 5, 0, filter);
+
+			assert(memcmp(src.data(), dst.data(), src.size() * sizeof(EzColorBGRA)) == 0);
+		}
+	}
+
+	// Framebuffer overloads clip to the framebuffer bounds
+	{
+		EzFramebuffer framebuffer;
+
+		assert(framebuffer.resize(4, 4));
+
+		EzPixelOps::fill(framebuffer, EzColorBGRA{ 0, 0, 0, 255 });
+
+		const EzColorBGRA white[9] = { { 255, 255, 255, 255 }, { 255, 255, 255, 255 }, { 255, 255, 255, 255 },
+									   { 255, 255, 255, 255 }, { 255, 255, 255, 255 }, { 255, 255, 255, 255 },
+									   { 255, 255, 255, 255 }, { 255, 255, 255, 255 }, { 255, 255, 255, 255 } };
+
+		EzPixelOps::blit(white, 3, 3, 0, framebuffer, -1, 2);		// Only the 2 x 2 top-right pixels land at (0, 2)
+
+		for (int y = 0; y < 4; y++)
+		{
+			for (int x = 0; x < 4; x++)
+			{
+				assert(framebuffer.getRow(y)[x].r == (((x < 2) && (y >= 2)) ? 255 : 0));
+			}
+		}
+	}
+
+	// Every instruction set must match the scalar reference
+	const auto reference = runKernels(EzPixelOps::Isa::Scalar);
+
+	for (auto isa : { EzPixelOps::Isa::SSE41, EzPixelOps::Isa::AVX2, EzPixelOps::Isa::NEON })
+	{
+		if (EzPixelOps::isSupported(isa))
+		{
+			const auto result = runKernels(isa);
+
+			assert(result.size() == reference.size());
+			assert(memcmp(result.data(), reference.data(), result.size() * sizeof(EzColorBGRA)) == 0);
+
+			printf("%s matches the scalar kernels.\n", EzPixelOps::to_string(isa));
+		}
+	}
+
+	EzPixelOps::setIsa(defaultIsa);
+
+	printf("All assertions passed!\n");
+	printf("==== Pixel Ops Test End ====\n\n");
+}
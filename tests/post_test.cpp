@@ -0,0 +1,105 @@
+/**
+ *	Copyright (c) 2025 Wenchao Huang <physhuangwenchao@gmail.com>
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include <thread>
+#include <easywin32.h>
+
+/*********************************************************************************
+*********************************    postTest    *********************************
+*********************************************************************************/
+
+/**
+ *	@brief		Posts tasks from several threads and checks that all of them run on the window thread, in order,
+ *				and that no task is accepted nor run once the window is closed.
+ */
+void postTest(EzWindow & window)
+{
+	printf("=== Post Test Start ===\n");
+
+	const int numThreads = 4;
+	const int numTasks = 10000;
+
+	const DWORD windowThreadId = ::GetCurrentThreadId();
+
+	int lastValues[numThreads] = {};
+	int numCompleted = 0;
+
+	std::thread producers[numThreads];
+
+	for (int t = 0; t < numThreads; t++)
+	{
+		producers[t] = std::thread([&, t]()
+		{
+			for (int i = 1; i <= numTasks; i++)
+			{
+				bool posted = window.post([&, t, i]()
+				{
+					assert(::GetCurrentThreadId() == windowThreadId);
+
+					assert(lastValues[t] + 1 == i);		// FIFO per producer
+
+					lastValues[t] = i;
+
+					numCompleted++;
+				});
+
+				assert(posted);
+			}
+		});
+	}
+
+	while (numCompleted < numThreads * numTasks)
+	{
+		window.waitEvents(nullptr, 0, 100);
+	}
+
+	for (int t = 0; t < numThreads; t++)
+	{
+		producers[t].join();
+
+		assert(lastValues[t] == numTasks);
+	}
+
+	//	A task that closes the window drops the rest of its batch, and `post` fails once the window is closed
+	{
+		EzWindow other;
+		other.setQuitOnClose(false);
+		other.open("EasyWin32-Post", 160, 120);
+
+		bool lateTaskRan = false;
+
+		assert(other.post([&]() { other.close(); }));
+		assert(other.post([&]() { lateTaskRan = true; }));
+
+		while (other.isOpen())
+		{
+			other.waitEvents(nullptr, 0, 100);
+		}
+
+		assert(!lateTaskRan);
+
+		assert(!other.post([&]() { lateTaskRan = true; }));
+	}
+
+	printf("All assertions passed!\n");
+	printf("==== Post Test End ====\n\n");
+}
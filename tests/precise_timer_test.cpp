@@ -0,0 +1,103 @@
+/**
+ *	Copyright (c) 2025 Wenchao Huang <physhuangwenchao@gmail.com>
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include <easywin32.h>
+
+/*********************************************************************************
+*****************************    preciseTimerTest    *****************************
+*********************************************************************************/
+
+/**
+ *	@brief		Runs two precise timers for half a second and checks their tick count, period and thread.
+ *	@details	The bounds are loose (ticks can be skipped on a loaded machine), but a timer rounded to the
+ *				system tick like `WM_TIMER` would run at 64 Hz instead of 120 Hz.
+ */
+void preciseTimerTest()
+{
+	printf("=== Precise Timer Test Start ===\n");
+
+	EzWindow window;
+	window.setQuitOnClose(false);
+	window.open("EasyWin32-Timer", 200, 100);
+
+	LARGE_INTEGER frequency = {};		::QueryPerformanceFrequency(&frequency);
+
+	const DWORD threadId = ::GetCurrentThreadId();
+
+	std::vector<LONGLONG> ticks[2];
+
+	window.onPreciseTimer = [&](UINT_PTR id)
+	{
+		assert(::GetCurrentThreadId() == threadId);
+
+		LARGE_INTEGER counter = {};		::QueryPerformanceCounter(&counter);
+
+		ticks[id].push_back(counter.QuadPart);
+	};
+
+	assert(!window.setPreciseTimer(0, 0.0));
+
+	assert(window.setPreciseTimer(0, 1.0 / 120));
+	assert(window.setPreciseTimer(1, 1.0 / 120));
+
+	window.killPreciseTimer(1);
+
+	LARGE_INTEGER start = {}, counter = {};		::QueryPerformanceCounter(&start);
+
+	do
+	{
+		EzThreadWindows::waitEvents(nullptr, 0, 10);
+
+		::QueryPerformanceCounter(&counter);
+
+	} while (counter.QuadPart - start.QuadPart < frequency.QuadPart / 2);
+
+	window.killPreciseTimer(0);
+
+	assert(ticks[1].empty());
+	assert(ticks[0].size() >= 40);
+	assert(ticks[0].size() <= 61);
+
+	//	Mean period: never faster than requested, and well below the 15.6 ms of the system tick (skipped ticks
+	//	on a loaded machine only lengthen it, the wall-clock time of each tick is too noisy to check the grid)
+	double elapsed = double(ticks[0].back() - ticks[0].front()) / frequency.QuadPart;
+
+	double meanPeriod = elapsed / (ticks[0].size() - 1);
+
+	assert((meanPeriod > 0.9 / 120) && (meanPeriod < 1.0 / 80));
+
+	printf("%zu ticks, mean period %.3f ms.\n", ticks[0].size(), 1e3 * meanPeriod);
+
+	//	Nothing is delivered once killed
+	size_t count = ticks[0].size();
+
+	::Sleep(50);
+
+	window.processEvents();
+
+	assert(ticks[0].size() == count);
+
+	window.close();
+
+	printf("All assertions passed!\n");
+	printf("==== Precise Timer Test End ====\n\n");
+}
@@ -0,0 +1,88 @@
+/**
+ *	Copyright (c) 2025 Wenchao Huang <physhuangwenchao@gmail.com>
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include <easywin32.h>
+
+/*********************************************************************************
+*******************************    profilerTest    *******************************
+*********************************************************************************/
+
+/**
+ *	@brief		Dispatches a few messages through the window and checks the statistics of the dispatch profiler.
+ *	@note		Does nothing unless the library is built with `EZWIN32_ENABLE_PROFILER`.
+ */
+void profilerTest(EzWindow & window)
+{
+	printf("=== Profiler Test Start ===\n");
+
+#ifdef EZWIN32_ENABLE_PROFILER
+	const int numMessages = 100;
+
+	window.onKeyboardPress = [](EzKey, EzKeyAction)
+	{
+		::Sleep(0);
+
+		return 0;
+	};
+
+	window.resetDispatchStats();
+
+	for (int i = 0; i < numMessages; i++)
+	{
+		::SendMessage(window.nativeHandle(), WM_KEYDOWN, 'A', 0);
+	}
+
+	bool found = false;
+
+	for (const EzDispatchStats & stats : window.getDispatchStats())
+	{
+		if (stats.message == WM_KEYDOWN)
+		{
+			assert(stats.count == numMessages);
+
+			assert(stats.p50 <= stats.p99);
+
+			assert(stats.p99 <= stats.max);
+
+			assert(stats.max <= stats.total);
+
+			found = true;
+		}
+	}
+
+	assert(found);
+
+	window.resetDispatchStats();
+
+	assert(window.getDispatchStats().empty());
+
+	window.onKeyboardPress = nullptr;
+
+	printf("All assertions passed!\n");
+#else
+	(void)window;
+
+	printf("Skipped (EZWIN32_ENABLE_PROFILER is not defined).\n");
+#endif
+
+	printf("==== Profiler Test End ====\n\n");
+}
@@ -0,0 +1,127 @@
+/**
+ *	Copyright (c) 2025 Wenchao Huang <physhuangwenchao@gmail.com>
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include <easywin32.h>
+
+/*********************************************************************************
+**************************    sharedFramebufferTest    ***************************
+*********************************************************************************/
+
+/**
+ *	@brief		Writes frames into a shared window framebuffer, as another process would, and presents them.
+ *	@details	Checks the handoff (sequence, events), the zero-copy path (the viewer sees the pixels written through
+ *				its own mapping), the clamping to the capacity and the frames discarded by a resize.
+ */
+void sharedFramebufferTest()
+{
+	printf("=== Shared Framebuffer Test Start ===\n");
+
+	const easywin32::string_type name = TEXT("Local\\EasyWin32-SharedFramebufferTest");
+
+	EzWindow window;
+	window.setQuitOnClose(false);
+	window.open("EasyWin32-Shared", 200, 100);
+
+	assert(window.shareFramebuffer(name, 256, 256));
+	assert(window.framebufferShared());
+	assert(window.getFramebuffer().getWidth() == window.getClientExtent().cx);
+	assert(window.getFramebuffer().getHeight() == window.getClientExtent().cy);
+
+	// The name is owned by the first viewer
+	EzWindow other;
+	other.setQuitOnClose(false);
+	other.open("EasyWin32-Shared", 200, 100);
+
+	assert(!other.shareFramebuffer(name, 256, 256));
+
+	other.close();
+
+	EzSharedFramebufferWriter writer;
+
+	assert(writer.open(name));
+	assert(!window.presentSharedFrame());		// Nothing written yet
+
+	int width = 0, height = 0;
+
+	EzColorBGRA * pixels = writer.beginWrite(width, height);
+
+	assert(pixels != nullptr);
+	assert(width == window.getFramebuffer().getWidth());
+	assert(height == window.getFramebuffer().getHeight());
+	assert(writer.getHeader()->sequence & 1);
+
+	for (int i = 0; i < width * height; i++)
+	{
+		pixels[i] = EzColorBGRA{ 0, 128, 255, 255 };
+	}
+
+	assert(!window.presentSharedFrame());		// Being written
+
+	writer.endWrite();
+
+	// Same pages, different mappings
+	assert(window.getFramebuffer().getPixels() != pixels);
+	assert(window.getFramebuffer().getRow(height - 1)[width - 1].g == 128);
+
+	HANDLE hFrameEvent = window.getSharedFrameEvent();
+
+	assert(::WaitForSingleObject(hFrameEvent, 0) == WAIT_OBJECT_0);
+	assert(window.presentSharedFrame());
+	assert(!window.presentSharedFrame());		// Already presented
+	assert(writer.waitPresented(0));
+	assert(writer.getHeader()->presented == writer.getHeader()->sequence);
+
+	// Frames written before a resize are discarded, the extent is clamped to the capacity
+	pixels = writer.beginWrite(width, height);
+
+	window.setPos(100, 100, 600, 500);
+
+	writer.endWrite();
+
+	assert(!window.presentSharedFrame());
+
+	assert(window.getFramebuffer().getWidth() == (window.getClientExtent().cx < 256 ? window.getClientExtent().cx : 256));
+	assert(window.getFramebuffer().getHeight() == (window.getClientExtent().cy < 256 ? window.getClientExtent().cy : 256));
+
+	pixels = writer.beginWrite(width, height);
+
+	assert((width == window.getFramebuffer().getWidth()) && (height == window.getFramebuffer().getHeight()));
+
+	writer.endWrite();
+
+	assert(window.presentSharedFrame());
+
+	// Back to private memory
+	window.unshareFramebuffer();
+
+	assert(!window.framebufferShared());
+	assert(window.getFramebuffer().isValid());
+
+	writer.close();
+
+	assert(!writer.open(name));
+
+	window.close();
+
+	printf("All assertions passed!\n");
+	printf("==== Shared Framebuffer Test End ====\n\n");
+}
@@ -0,0 +1,91 @@
+/**
+ *	Copyright (c) 2025 Wenchao Huang <physhuangwenchao@gmail.com>
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include <easywin32_d3d11.h>
+
+/*********************************************************************************
+******************************    swapChainTest    *******************************
+*********************************************************************************/
+
+/**
+ *	@brief		Checks `SwapChain::computeFrameRect` and `SwapChain::leavesBars` against a table of frame and back buffer extents.
+ *	@details	Covers odd extents (centering rounds down), frames larger than the back buffer and empty extents.
+ *				No device is needed: the placement is computed on the CPU.
+ */
+void swapChainTest()
+{
+	printf("=== Swap Chain Test Start ===\n");
+
+	struct Case
+	{
+		EzScaleMode		mode;
+		EzSize			frame;
+		EzSize			target;
+		EzRect			expected;
+		bool			bars;			// Part of the back buffer is left to the clear color
+	};
+
+	const Case cases[] =
+	{
+		//	1:1, top-left aligned and cropped
+		{ EzScaleMode::None,		{ 100, 50 },	{ 200, 200 },		{ 0, 0, 100, 50 },		true },
+		{ EzScaleMode::None,		{ 640, 480 },	{ 800, 600 },		{ 0, 0, 640, 480 },		true },		// Window grown before the frame
+		{ EzScaleMode::None,		{ 800, 600 },	{ 800, 600 },		{ 0, 0, 800, 600 },		false },
+		{ EzScaleMode::None,		{ 300, 300 },	{ 200, 101 },		{ 0, 0, 200, 101 },		false },
+
+		//	Whole back buffer, whatever the aspect ratio
+		{ EzScaleMode::Stretch,		{ 37, 21 },		{ 101, 55 },		{ 0, 0, 101, 55 },		false },
+		{ EzScaleMode::Stretch,		{ 4000, 3000 },	{ 101, 55 },		{ 0, 0, 101, 55 },		false },
+
+		//	Aspect ratio kept, odd extents
+		{ EzScaleMode::Letterbox,	{ 100, 50 },	{ 201, 201 },		{ 0, 50, 201, 150 },		true },
+		{ EzScaleMode::Letterbox,	{ 50, 100 },	{ 201, 201 },		{ 50, 0, 150, 201 },		true },
+		{ EzScaleMode::Letterbox,	{ 160, 90 },	{ 1920, 1080 },		{ 0, 0, 1920, 1080 },		false },
+		{ EzScaleMode::Letterbox,	{ 400, 300 },	{ 200, 100 },		{ 33, 0, 166, 100 },		true },
+
+		//	Integer multiples, letterboxed when the frame is larger than the back buffer
+		{ EzScaleMode::IntegerFit,	{ 64, 48 },		{ 201, 151 },		{ 4, 3, 196, 147 },		true },
+		{ EzScaleMode::IntegerFit,	{ 320, 240 },	{ 320, 240 },		{ 0, 0, 320, 240 },		false },
+		{ EzScaleMode::IntegerFit,	{ 321, 240 },	{ 320, 240 },		{ 0, 0, 320, 239 },		true },
+		{ EzScaleMode::IntegerFit,	{ 400, 300 },	{ 200, 100 },		{ 33, 0, 166, 100 },		true },
+
+		//	Empty extents
+		{ EzScaleMode::None,		{ 0, 50 },		{ 200, 200 },		{ 0, 0, 0, 0 },		true },
+		{ EzScaleMode::Stretch,		{ 100, 50 },	{ 200, 0 },			{ 0, 0, 0, 0 },		true },
+		{ EzScaleMode::Letterbox,	{ 100, 0 },		{ 200, 200 },		{ 0, 0, 0, 0 },		true },
+		{ EzScaleMode::IntegerFit,	{ 100, 50 },	{ 0, 200 },			{ 0, 0, 0, 0 },		true },
+		{ EzScaleMode::IntegerFit,	{ -8, 50 },		{ 200, 200 },		{ 0, 0, 0, 0 },		true },
+	};
+
+	for (const Case & test : cases)
+	{
+		EzRect rect = EzSwapChain::computeFrameRect(test.mode, test.frame, test.target);
+
+		assert((rect.left == test.expected.left) && (rect.top == test.expected.top) &&
+			   (rect.right == test.expected.right) && (rect.bottom == test.expected.bottom));
+
+		assert(EzSwapChain::leavesBars(test.mode, test.frame, test.target) == test.bars);
+	}
+
+	printf("All assertions passed!\n");
+	printf("==== Swap Chain Test End ====\n\n");
+}
\ No newline at end of file
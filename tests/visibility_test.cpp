@@ -0,0 +1,120 @@
+/**
+ *	Copyright (c) 2025 Wenchao Huang <physhuangwenchao@gmail.com>
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include <easywin32.h>
+
+/*********************************************************************************
+******************************    visibilityTest    ******************************
+*********************************************************************************/
+
+/**
+ *	@brief		Checks the visibility changes reported by `onVisibilityChanged`, and that `runFrameLoop` pauses while minimized.
+ *	@details	Session lock is simulated by sending `WM_WTSSESSION_CHANGE`, occlusion by calling `setOccluded` as a presenter would.
+ */
+void visibilityTest()
+{
+	printf("=== Visibility Test Start ===\n");
+
+	EzWindow window;
+	window.setQuitOnClose(false);
+	window.open("EasyWin32-Visibility", 200, 100);
+
+	assert(window.getVisibility() == EzVisibility::Hidden);
+
+	std::vector<EzVisibility> changes;
+
+	window.onVisibilityChanged = [&](EzVisibility visibility)
+	{
+		assert(visibility == window.getVisibility());
+
+		changes.push_back(visibility);
+	};
+
+	window.show();							assert(window.getVisibility() == EzVisibility::Visible);
+	window.minimize();						assert(window.getVisibility() == EzVisibility::Minimized);
+	window.restore();						assert(window.getVisibility() == EzVisibility::Visible);
+	window.setOccluded(true);				assert(window.getVisibility() == EzVisibility::Occluded);
+	window.setOccluded(true);				// No change
+	window.setOccluded(false);				assert(window.getVisibility() == EzVisibility::Visible);
+
+	::SendMessage(window.nativeHandle(), WM_WTSSESSION_CHANGE, WTS_SESSION_LOCK, 0);
+
+	assert(window.getVisibility() == EzVisibility::SessionLocked);
+
+	::SendMessage(window.nativeHandle(), WM_WTSSESSION_CHANGE, WTS_SESSION_UNLOCK, 0);
+
+	assert(window.getVisibility() == EzVisibility::Visible);
+
+	const EzVisibility expected[] =
+	{
+		EzVisibility::Visible, EzVisibility::Minimized, EzVisibility::Visible, EzVisibility::Occluded,
+		EzVisibility::Visible, EzVisibility::SessionLocked, EzVisibility::Visible
+	};
+
+	assert(changes.size() == std::size(expected));
+
+	for (size_t i = 0; i < changes.size(); i++)
+	{
+		assert(changes[i] == expected[i]);
+	}
+
+	// No frame is produced while minimized: the loop sleeps until the timer restores the window
+	window.onTimer = [&](UINT_PTR id)
+	{
+		window.killTimer(id);
+
+		window.restore();
+
+		return 0;
+	};
+
+	double minimizedTime = 0.0;
+
+	window.runFrameLoop(100.0, [&](const EzFrameStats & stats)
+	{
+		assert(window.getVisibility() == EzVisibility::Visible);
+
+		if (stats.frameIndex == 0)
+		{
+			window.minimize();
+
+			window.setTimer(1, 200);
+
+			minimizedTime = stats.time;
+		}
+		else
+		{
+			assert(stats.time - minimizedTime > 0.15);
+		}
+
+		return stats.frameIndex == 0;
+	});
+
+	assert(window.getVisibility() == EzVisibility::Visible);
+
+	window.close();
+
+	assert(window.getVisibility() == EzVisibility::Hidden);
+
+	printf("All assertions passed!\n");
+	printf("==== Visibility Test End ====\n\n");
+}
@@ -0,0 +1,91 @@
+/**
+ *	Copyright (c) 2025 Wenchao Huang <physhuangwenchao@gmail.com>
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include <thread>
+#include <easywin32.h>
+
+/*********************************************************************************
+******************************    waitEventsTest    ******************************
+*********************************************************************************/
+
+/**
+ *	@brief		Skips over message wake-ups, returning the first non-message wait result.
+ */
+static EzWaitResult waitForHandles(const HANDLE * handles, size_t count, DWORD timeout)
+{
+	EzWaitResult result = EzThreadWindows::waitEvents(handles, count, timeout);
+
+	while (result.source == EzWaitSource::Message)
+	{
+		result = EzThreadWindows::waitEvents(handles, count, timeout);
+	}
+
+	return result;
+}
+
+
+/**
+ *	@brief		Checks that `waitEvents` reports the handle that was signaled, and times out otherwise.
+ */
+void waitEventsTest()
+{
+	printf("=== Wait Events Test Start ===\n");
+
+	HANDLE events[2] = { ::CreateEvent(nullptr, FALSE, FALSE, nullptr), ::CreateEvent(nullptr, FALSE, FALSE, nullptr) };
+
+	//	Nothing signaled
+	EzWaitResult result = waitForHandles(events, 2, 10);
+
+	assert(result.source == EzWaitSource::Timeout);
+
+	//	Signaled before waiting
+	::SetEvent(events[1]);
+
+	result = waitForHandles(events, 2, 0);
+
+	assert((result.source == EzWaitSource::Handle) && (result.index == 1));
+
+	//	Signaled from another thread while sleeping
+	std::thread worker([&]()
+	{
+		::Sleep(20);
+
+		::SetEvent(events[0]);
+	});
+
+	result = waitForHandles(events, 2, INFINITE);
+
+	assert((result.source == EzWaitSource::Handle) && (result.index == 0));
+
+	worker.join();
+
+	//	Auto-reset events are consumed by the wait
+	result = waitForHandles(events, 2, 0);
+
+	assert(result.source == EzWaitSource::Timeout);
+
+	::CloseHandle(events[0]);
+	::CloseHandle(events[1]);
+
+	printf("All assertions passed!\n");
+	printf("==== Wait Events Test End ====\n\n");
+}
@@ -0,0 +1,105 @@
+/**
+ *	Copyright (c) 2025 Wenchao Huang <physhuangwenchao@gmail.com>
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include <easywin32.h>
+
+/*********************************************************************************
+******************************    windowPoolTest    ******************************
+*********************************************************************************/
+
+/**
+ *	@brief		Checks `Window::open(const WindowDesc&)` and the reuse of hidden windows by `WindowPool`.
+ */
+void windowPoolTest()
+{
+	printf("=== Window Pool Test Start ===\n");
+
+	EzWindowDesc desc;
+	desc.title = "EasyWin32-Pool";
+	desc.width = 320;
+	desc.height = 240;
+	desc.pos = EzPoint{ 120, 140 };
+	desc.immersiveDarkMode = true;
+	desc.cornerStyle = EzCornerStyle::RoundSmall;
+
+	// Descriptor without `Style::Visible`: opened hidden, with its attributes
+	{
+		EzWindow window;
+		window.setQuitOnClose(false);
+		window.open(desc);
+
+		assert(window.isOpen());
+		assert(!window.isVisible());
+		assert(window.immersiveDarkModeEnabled());
+		assert(window.getClientExtent().cx == 320);
+		assert(window.getClientExtent().cy == 240);
+		assert(window.getClientPos().x == 120);
+		assert(window.getClientPos().y == 140);
+		assert(!window.getStyleFlags().has(EzStyle::Visible));
+	}
+
+	// Pool of hidden windows
+	{
+		desc.styleFlags |= EzStyle::Visible;		// Stripped by the pool
+
+		EzWindowPool pool(desc);
+		pool.reserve(3);
+
+		assert(pool.size() == 3);
+		assert(pool.idleCount() == 3);
+
+		EzWindow & a = pool.acquire(100, 100);
+		EzWindow & b = pool.acquire(500, 100);
+
+		assert(pool.size() == 3);
+		assert(pool.idleCount() == 1);
+		assert(&a != &b);
+		assert(a.isVisible() && b.isVisible());
+		assert(b.getClientPos().x == 500);
+		assert(b.getClientPos().y == 100);
+
+		pool.recycle(a);
+		pool.recycle(a);		// Recycling twice is harmless
+
+		assert(!a.isVisible());
+		assert(pool.idleCount() == 2);
+
+		// A window closed while acquired is reopened on reuse
+		b.close();
+		pool.recycle(b);
+
+		EzWindow & c = pool.acquire(200, 300);
+
+		assert(&c == &b);
+		assert(c.isOpen() && c.isVisible());
+		assert(c.getClientPos().y == 300);
+
+		pool.acquire(0, 0);
+		pool.acquire(0, 0);		// Grows the pool
+
+		assert(pool.size() == 4);
+		assert(pool.idleCount() == 0);
+	}
+
+	printf("All assertions passed!\n");
+	printf("==== Window Pool Test End ====\n\n");
+}
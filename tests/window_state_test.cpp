@@ -0,0 +1,92 @@
+/**
+ *	Copyright (c) 2025 Wenchao Huang <physhuangwenchao@gmail.com>
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include <easywin32.h>
+
+/*********************************************************************************
+*****************************    windowStateTest    ******************************
+*********************************************************************************/
+
+//!	@brief	Compares the cached state of `window` with the values queried from Win32.
+static void checkCachedState(EzWindow & window)
+{
+	HWND hWnd = window.nativeHandle();
+
+	RECT rect = {};		::GetClientRect(hWnd, &rect);
+
+	POINT pos = { 0, 0 };		::ClientToScreen(hWnd, &pos);
+
+	assert(window.getClientExtent().cx == rect.right);
+	assert(window.getClientExtent().cy == rect.bottom);
+	assert(::IsIconic(hWnd) || (window.getClientPos().x == pos.x));		// Minimized windows are parked off-screen
+	assert(::IsIconic(hWnd) || (window.getClientPos().y == pos.y));
+	assert(window.isVisible() == (::IsWindowVisible(hWnd) != FALSE));
+	assert(window.isMinimized() == (::IsIconic(hWnd) != FALSE));
+	assert(window.isMaximized() == (::IsZoomed(hWnd) != FALSE));
+	assert(window.getDpi() == ::GetDpiForWindow(hWnd));
+}
+
+
+/**
+ *	@brief		Checks that the cached size, position, visibility and style follow the window.
+ *	@details	Changes are made both through `Window` and directly through Win32, bypassing it.
+ */
+void windowStateTest()
+{
+	printf("=== Window State Test Start ===\n");
+
+	EzWindow window;
+	window.setQuitOnClose(false);
+	window.open("EasyWin32-State", EzRect{ 100, 100, 500, 400 });
+
+	checkCachedState(window);
+
+	assert(window.getClientExtent().cx == 400);		// Requested client extent, whatever the DPI of the monitor
+	assert(window.getClientExtent().cy == 300);
+
+	window.show();				checkCachedState(window);
+	window.setPos(150, 160);	checkCachedState(window);
+	window.minimize();			checkCachedState(window);
+	window.maximize();			checkCachedState(window);
+	window.restore();			checkCachedState(window);
+	window.hide();				checkCachedState(window);
+
+	// Changes made outside of `Window`
+	HWND hWnd = window.nativeHandle();
+
+	::SetWindowPos(hWnd, nullptr, 200, 220, 640, 480, SWP_NOZORDER | SWP_SHOWWINDOW);
+
+	checkCachedState(window);
+
+	LONG_PTR style = ::GetWindowLongPtr(hWnd, GWL_STYLE);
+
+	::SetWindowLongPtr(hWnd, GWL_STYLE, style & ~static_cast<LONG_PTR>(WS_MAXIMIZEBOX));
+
+	assert(!window.getStyleFlags().has(EzStyle::MaximizeBox));
+
+	::DestroyWindow(hWnd);
+
+	assert(!window.isOpen());
+
+	printf("All assertions passed!\n");
+	printf("==== Window State Test End ====\n\n");
+}
@@ -0,0 +1,115 @@
+/**
+ *	Copyright (c) 2025 Wenchao Huang <physhuangwenchao@gmail.com>
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining a copy
+ *	of this software and associated documentation files (the "Software"), to deal
+ *	in the Software without restriction, including without limitation the rights
+ *	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *	copies of the Software, and to permit persons to whom the Software is
+ *	furnished to do so, subject to the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be included in all
+ *	copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *	SOFTWARE.
+ */
+
+#include <easywin32.h>
+
+/*********************************************************************************
+***************************    windowThreadPoolTest    ***************************
+*********************************************************************************/
+
+/**
+ *	@brief		Opens windows on pool threads and checks their thread affinity, posting and cross-thread closing.
+ *	@details	Also checks that a window with `setQuitOnClose(false)` does not post `WM_QUIT` when destroyed.
+ */
+void windowThreadPoolTest()
+{
+	printf("=== Window Thread Pool Test Start ===\n");
+
+	EzWindow windows[2];
+
+	{
+		EzWindowThreadPool pool(2);
+
+		assert(pool.size() == 2);
+
+		assert(pool.getThreadId(0) != pool.getThreadId(1));
+
+		assert(pool.getThreadId(0) != ::GetCurrentThreadId());
+
+		for (size_t i = 0; i < pool.size(); i++)
+		{
+			bool invoked = pool.invoke(i, [&, i]()
+			{
+				assert(::GetCurrentThreadId() == pool.getThreadId(i));
+
+				windows[i].open("EasyWin32-Pool", 320, 240);
+			});
+
+			assert(invoked);
+
+			assert(windows[i].isOpen());
+
+			assert(::GetWindowThreadProcessId(windows[i].nativeHandle(), nullptr) == pool.getThreadId(i));
+		}
+
+		//	Tasks posted to a pooled window run on its pool thread
+		DWORD taskThreadId = 0;
+
+		HANDLE hDone = ::CreateEvent(nullptr, TRUE, FALSE, nullptr);
+
+		windows[1].post([&]() { taskThreadId = ::GetCurrentThreadId();	::SetEvent(hDone); });
+
+		::WaitForSingleObject(hDone, INFINITE);
+
+		::CloseHandle(hDone);
+
+		assert(taskThreadId == pool.getThreadId(1));
+
+		//	A task that does not return in time fails the wait, and still runs to completion afterwards
+		HANDLE hRelease = ::CreateEvent(nullptr, TRUE, FALSE, nullptr);
+
+		assert(!pool.invoke(1, [hRelease]() { ::WaitForSingleObject(hRelease, INFINITE); }, 50));
+
+		::SetEvent(hRelease);
+
+		assert(pool.invoke(1, []() {}, INFINITE));
+
+		::CloseHandle(hRelease);
+
+		assert(EzWindow::fromHandle(windows[0].nativeHandle()) == &windows[0]);
+
+		assert(EzWindow::fromHandle(::GetDesktopWindow()) == nullptr);
+
+		//	Closing from this thread is forwarded to the owning thread
+		windows[0].close();
+
+		assert(!windows[0].isOpen());
+
+		assert(windows[1].isOpen());
+	}
+
+	//	The pool destroys the windows left on its threads
+	assert(!windows[1].isOpen());
+
+	//	No WM_QUIT posted by a window that does not quit on close
+	EzWindow window;
+	window.setQuitOnClose(false);
+	window.open("EasyWin32-Pool", 320, 240);
+	window.close();
+
+	MSG msg = {};
+
+	assert(::PeekMessage(&msg, nullptr, WM_QUIT, WM_QUIT, PM_NOREMOVE) == FALSE);
+
+	printf("All assertions passed!\n");
+	printf("==== Window Thread Pool Test End ====\n\n");
+}